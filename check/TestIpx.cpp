@@ -1,17 +1,24 @@
 #include "HighsStatus.h"
 #include "catch.hpp"
+#include "ipm/basiclu/include/basiclu.h"
 #include "ipm/ipx/include/ipx_status.h"
 #include "ipm/ipx/src/lp_solver.h"
 #include "lp_data/HConst.h"
 #include "lp_data/HighsLp.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // No commas i// Copyright (c) 2018 ERGO-Code. See license.txt for license.
 //
 // Example for using IPX from its C++ interface. The program solves the Netlib
 // problem afiro.
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <vector>
 
 #include "lp_solver.h"
 
@@ -73,3 +80,367 @@ TEST_CASE("afiro", "[highs_ipx]") {
 
   (void)(info);  // surpress unused variable.
 }
+
+TEST_CASE("afiro-cholesky", "[highs_ipx]") {
+  // Solve with and without the Cholesky factorization in the initial IPM,
+  // which must give the same basic solution in no more iterations. The
+  // normal matrices of afiro are nonsingular, so no pivot is dropped.
+  double col_value[2][num_var], row_value[num_constr];
+  double row_dual[num_constr], col_dual[num_var];
+  Int row_status[num_constr], col_status[num_var];
+  Int iter[2];
+  for (Int cholesky = 0; cholesky <= 1; cholesky++) {
+    ipx::LpSolver lps;
+    ipx::Parameters parameters;
+    parameters.display = 0;
+    parameters.cholesky = cholesky;
+    lps.SetParameters(parameters);
+    Int status = lps.Solve(num_var, obj, lb, ub, num_constr, Ap, Ai, Ax, rhs,
+                           constr_type);
+    REQUIRE(status == IPX_STATUS_solved);
+    ipx::Info info = lps.GetInfo();
+    REQUIRE((info.chol_nnz > 0) == (cholesky > 0));
+    REQUIRE((info.time_chol_factorize > 0.0) == (cholesky > 0));
+    REQUIRE(info.chol_dropped == 0);
+    iter[cholesky] = info.iter;
+    lps.GetBasicSolution(col_value[cholesky], row_value, row_dual, col_dual,
+                         row_status, col_status);
+  }
+  REQUIRE(iter[1] <= iter[0]);
+  for (Int j = 0; j < num_var; j++)
+    REQUIRE(fabs(col_value[0][j] - col_value[1][j]) < 1e-6);
+}
+
+TEST_CASE("afiro-cholesky-dropped", "[highs_ipx]") {
+  // Repeating the equality row 5 of afiro makes its normal matrices
+  // singular, so the Cholesky factorization drops a pivot, which CR
+  // resolves without changing the optimum.
+  std::vector<Int> ap(1, 0), ai;
+  std::vector<double> ax;
+  for (Int j = 0; j < num_var; j++) {
+    for (Int p = Ap[j]; p < Ap[j+1]; p++) {
+      ai.push_back(Ai[p]);
+      ax.push_back(Ax[p]);
+      if (Ai[p] == 5) {
+        ai.push_back(num_constr);
+        ax.push_back(Ax[p]);
+      }
+    }
+    ap.push_back(ai.size());
+  }
+  std::vector<double> b(rhs, rhs + num_constr);
+  b.push_back(rhs[5]);
+  std::vector<char> ct(constr_type, constr_type + num_constr);
+  ct.push_back(constr_type[5]);
+
+  ipx::LpSolver lps;
+  ipx::Parameters parameters;
+  parameters.display = 0;
+  parameters.cholesky = 1;
+  lps.SetParameters(parameters);
+  Int status = lps.Solve(num_var, obj, lb, ub, num_constr + 1, ap.data(),
+                         ai.data(), ax.data(), b.data(), ct.data());
+  REQUIRE(status == IPX_STATUS_solved);
+  ipx::Info info = lps.GetInfo();
+  REQUIRE(info.chol_dropped > 0);
+  REQUIRE(info.time_chol_factorize > 0.0);
+  REQUIRE(fabs(info.objval - (-464.7531428571)) < 1e-6);
+}
+
+TEST_CASE("afiro-correctors", "[highs_ipx]") {
+  // Centrality correctors are counted only if they are allowed, at most
+  // max_correctors per iteration, and then save iterations.
+  Int iter[2];
+  for (Int max_correctors = 0; max_correctors <= 2; max_correctors += 2) {
+    ipx::LpSolver lps;
+    ipx::Parameters parameters;
+    parameters.display = 0;
+    parameters.ipm_correctors = max_correctors;
+    lps.SetParameters(parameters);
+    Int status = lps.Solve(num_var, obj, lb, ub, num_constr, Ap, Ai, Ax, rhs,
+                           constr_type);
+    REQUIRE(status == IPX_STATUS_solved);
+    ipx::Info info = lps.GetInfo();
+    REQUIRE((info.correctors > 0) == (max_correctors > 0));
+    REQUIRE(info.correctors <= max_correctors * info.iter);
+    REQUIRE((info.correctors_iter_saved > 0.0) == (max_correctors > 0));
+    REQUIRE(fabs(info.objval - (-464.7531428571)) < 1e-6);
+    iter[max_correctors / 2] = info.iter;
+  }
+  REQUIRE(iter[1] <= iter[0]);
+}
+
+TEST_CASE("afiro-warm-start", "[highs_ipx]") {
+  // Solve afiro, change its right-hand side and solve it again, once from
+  // the default starting point and once warm started from the first solve.
+  ipx::Parameters parameters;
+  parameters.display = 0;
+  ipx::LpSolver lps;
+  lps.SetParameters(parameters);
+  Int status = lps.Solve(num_var, obj, lb, ub, num_constr, Ap, Ai, Ax, rhs,
+                         constr_type);
+  REQUIRE(status == IPX_STATUS_solved);
+  double x[num_var], slack[num_constr], y[num_constr], z[num_var];
+  REQUIRE(lps.GetIPMWarmStartPoint(x, slack, y, z) == 0);
+
+  double new_rhs[num_constr];
+  for (Int i = 0; i < num_constr; i++) new_rhs[i] = 1.01 * rhs[i];
+
+  ipx::LpSolver cold;
+  cold.SetParameters(parameters);
+  status = cold.Solve(num_var, obj, lb, ub, num_constr, Ap, Ai, Ax, new_rhs,
+                      constr_type);
+  REQUIRE(status == IPX_STATUS_solved);
+
+  lps.LoadIPMStartingPoint(num_var, num_constr, x, slack, y, z);
+  status = lps.Solve(num_var, obj, lb, ub, num_constr, Ap, Ai, Ax, new_rhs,
+                     constr_type);
+  REQUIRE(status == IPX_STATUS_solved);
+  ipx::Info info = lps.GetInfo();
+  REQUIRE(info.iter < cold.GetInfo().iter);
+  REQUIRE(fabs(info.objval - cold.GetInfo().objval) < 1e-6);
+}
+
+TEST_CASE("afiro-crossover-batch", "[highs_ipx]") {
+  // Crossover with and without batched pushes must give the same basic
+  // solution after the same pushes. Batching does all but one of them in
+  // batches, which take one solve each instead of one per push.
+  double col_value[2][num_var], row_value[num_constr];
+  double row_dual[num_constr], col_dual[num_var];
+  Int row_status[num_constr], col_status[num_var];
+  Int pushes[2], pushes_batched[2];
+  for (Int batch = 0; batch <= 1; batch++) {
+    ipx::LpSolver lps;
+    ipx::Parameters parameters;
+    parameters.display = 0;
+    parameters.crossover_batch = batch;
+    lps.SetParameters(parameters);
+    Int status = lps.Solve(num_var, obj, lb, ub, num_constr, Ap, Ai, Ax, rhs,
+                           constr_type);
+    REQUIRE(status == IPX_STATUS_solved);
+    ipx::Info info = lps.GetInfo();
+    REQUIRE(info.status_crossover == IPX_STATUS_optimal);
+    pushes[batch] = info.pushes_crossover;
+    pushes_batched[batch] = info.pushes_batched_crossover;
+    lps.GetBasicSolution(col_value[batch], row_value, row_dual, col_dual,
+                         row_status, col_status);
+  }
+  REQUIRE(pushes[0] > 1);
+  REQUIRE(pushes[1] == pushes[0]);
+  REQUIRE(pushes_batched[0] == 0);
+  REQUIRE(pushes_batched[1] == pushes[1] - 1);
+  for (Int j = 0; j < num_var; j++)
+    REQUIRE(fabs(col_value[0][j] - col_value[1][j]) < 1e-6);
+}
+
+TEST_CASE("afiro-crossover-handoff", "[highs_ipx]") {
+  // The basis from the IPM is handed off, without pushes or pivots, if and
+  // only if the superbasics exceed crossover_handoff times the # rows.
+  // Afiro ends its IPM with 4 superbasics, so the cutoff is at 4/9.
+  // The basis handed off is optimal.
+  const double cutoff = 4.0 / num_constr;
+  const double handoffs[] = {-1.0, cutoff, 0.99 * cutoff, 0.0};
+  for (double handoff : handoffs) {
+    ipx::LpSolver lps;
+    ipx::Parameters parameters;
+    parameters.display = 0;
+    parameters.crossover_handoff = handoff;
+    lps.SetParameters(parameters);
+    Int status = lps.Solve(num_var, obj, lb, ub, num_constr, Ap, Ai, Ax, rhs,
+                           constr_type);
+    REQUIRE(status == IPX_STATUS_solved);
+    ipx::Info info = lps.GetInfo();
+    REQUIRE(info.superbasics_crossover == 4);
+    const bool handed_off = handoff >= 0.0 && handoff < cutoff;
+    REQUIRE(info.handoff_crossover == handed_off);
+    REQUIRE((info.pushes_crossover == 0) == handed_off);
+    if (handed_off) {
+      REQUIRE(info.updates_crossover == 0);
+      REQUIRE(info.time_crossover == 0.0);
+    }
+    double x[num_var];
+    Int cbasis[num_constr], vbasis[num_var];
+    REQUIRE(lps.GetBasicSolution(x, nullptr, nullptr, nullptr, cbasis,
+                                 vbasis) == 0);
+    double objective = 0.0;
+    for (Int j = 0; j < num_var; j++)
+      objective += obj[j] * x[j];
+    REQUIRE(fabs(objective - (-464.7531428571)) < 1e-6);
+  }
+}
+
+TEST_CASE("afiro-kkt-precond", "[highs_ipx]") {
+  // The initial IPM with the diagonal, incomplete Cholesky and block-Jacobi
+  // preconditioners must give the same objective value.
+  for (Int kkt_precond = 0; kkt_precond <= 2; kkt_precond++) {
+    ipx::LpSolver lps;
+    ipx::Parameters parameters;
+    parameters.display = 0;
+    parameters.cholesky = 0;
+    parameters.kkt_precond = kkt_precond;
+    lps.SetParameters(parameters);
+    Int status = lps.Solve(num_var, obj, lb, ub, num_constr, Ap, Ai, Ax, rhs,
+                           constr_type);
+    REQUIRE(status == IPX_STATUS_solved);
+    ipx::Info info = lps.GetInfo();
+    REQUIRE((info.ic_nnz > 0) == (kkt_precond > 0));
+    REQUIRE(info.ic_shifts == 0);
+    REQUIRE(fabs(info.objval - (-464.7531428571)) < 1e-6);
+  }
+}
+
+TEST_CASE("kkt-precond-shifts", "[highs_ipx]") {
+  // The normal matrices of this LP are far from diagonally dominant. With
+  // no drop tolerance and a fill limit of half the entries of the normal
+  // matrix, the incomplete Cholesky factorization breaks down and restarts
+  // with a diagonal shift, for both preconditioners. The default fill limit
+  // needs no shift. The objective value is that with the Cholesky
+  // factorization.
+  constexpr Int m = 5;
+  constexpr Int n = 7;
+  const double c[] = {-3.0, -4.0, -4.0, -3.0, -3.0, -1.0, -4.0};
+  const double l[n] = {0.0};
+  const double u[] = {2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0};
+  const Int ap[] = {0, 4, 6, 8, 11, 14, 17, 21};
+  const Int ai[] = {0, 1, 3, 4, 1, 4, 3, 4, 1, 3, 4,
+                    0, 2, 4, 1, 2, 4, 1, 2, 3, 4};
+  const double ax[] = {1.5,   1.25, -1.75, -0.25, -1.25, 1.25, 2.0,
+                       -0.25, -1.25, 1.0,  0.75,  0.25,  1.0,  -2.0,
+                       -0.75, 1.75, -2.0,  2.0,   0.5,   -1.5, -1.75};
+  const double b[] = {1.0, -0.25, 2.0, 1.25, -3.0};
+  const char ct[] = {'<', '<', '<', '<', '<'};
+
+  ipx::Parameters parameters;
+  parameters.display = 0;
+  parameters.cholesky = 1;
+  ipx::LpSolver chol;
+  chol.SetParameters(parameters);
+  Int status = chol.Solve(n, c, l, u, m, ap, ai, ax, b, ct);
+  REQUIRE(status == IPX_STATUS_solved);
+  const double objval = chol.GetInfo().objval;
+
+  for (Int kkt_precond = 1; kkt_precond <= 2; kkt_precond++) {
+    for (Int tight = 0; tight <= 1; tight++) {
+      ipx::LpSolver lps;
+      ipx::Parameters precond_parameters = parameters;
+      precond_parameters.cholesky = 0;
+      precond_parameters.kkt_precond = kkt_precond;
+      if (tight) {
+        precond_parameters.ic_droptol = 0.0;
+        precond_parameters.ic_fill = 0.5;
+      }
+      lps.SetParameters(precond_parameters);
+      status = lps.Solve(n, c, l, u, m, ap, ai, ax, b, ct);
+      REQUIRE(status == IPX_STATUS_solved);
+      ipx::Info info = lps.GetInfo();
+      REQUIRE((info.ic_shifts > 0) == (tight > 0));
+      REQUIRE(fabs(info.objval - objval) < 1e-6);
+    }
+  }
+}
+
+TEST_CASE("basiclu-solve-dense-multi", "[highs_ipx]") {
+  // Solving with several right-hand sides at once must give the same result
+  // as solving with one at a time. Five right-hand sides cover a full and a
+  // partial block.
+  const Int m = num_constr;
+  const Int nrhs = 5;
+  // Basis matrix of slack columns and the first structural columns.
+  Int Bbegin[num_constr], Bend[num_constr], Bi[num_constr + 32];
+  double Bx[num_constr + 32];
+  Int nz = 0;
+  for (Int j = 0; j < m; j++) {
+    Bbegin[j] = nz;
+    Bi[nz] = j;
+    Bx[nz++] = 1.0;
+    if (j < 4)
+      for (Int p = Ap[j]; p < Ap[j + 1]; p++)
+        if (Ai[p] != j) {
+          Bi[nz] = Ai[p];
+          Bx[nz++] = Ax[p];
+        }
+    Bend[j] = nz;
+  }
+  struct basiclu_object obj;
+  REQUIRE(basiclu_obj_initialize(&obj, m) == BASICLU_OK);
+  REQUIRE(basiclu_obj_factorize(&obj, Bbegin, Bend, Bi, Bx) == BASICLU_OK);
+  double rhs[m * nrhs], lhs[m * nrhs], x[m];
+  for (Int k = 0; k < m * nrhs; k++) rhs[k] = 1.0 / (k + 1);
+  for (char trans : {'N', 'T'}) {
+    REQUIRE(basiclu_obj_solve_dense_multi(&obj, nrhs, rhs, lhs, trans) ==
+            BASICLU_OK);
+    for (Int k = 0; k < nrhs; k++) {
+      REQUIRE(basiclu_obj_solve_dense(&obj, rhs + k * m, x, trans) ==
+              BASICLU_OK);
+      for (Int i = 0; i < m; i++)
+        REQUIRE(fabs(lhs[k * m + i] - x[i]) < 1e-14);
+    }
+  }
+  basiclu_obj_free(&obj);
+}
+
+TEST_CASE("basiclu-solve-dense-parallel", "[highs_ipx]") {
+  // A dense solve with the thresholds for the level-scheduled parallel code
+  // set to their minimum must give the same result as the sequential code,
+  // both after factorization and after Forrest-Tomlin updates.
+  const Int m = 100;
+  const Int num_update = 5;
+  // Column diagonally dominant basis matrix with two off-diagonal entries per
+  // column, and the same for the columns that replace basis columns.
+  std::vector<Int> Bbegin(m), Bend(m), Bi;
+  std::vector<double> Bx;
+  for (Int j = 0; j < m; j++) {
+    Bbegin[j] = Bi.size();
+    Bi.push_back(j);
+    Bx.push_back(4.0);
+    for (Int i : {(7 * j + 3) % m, (7 * j + 4) % m})
+      if (i != j) {
+        Bi.push_back(i);
+        Bx.push_back(-1.0);
+      }
+    Bend[j] = Bi.size();
+  }
+#ifdef _OPENMP
+  const int num_threads = omp_get_max_threads();
+  omp_set_num_threads(std::max(num_threads, 2));
+#endif
+  struct basiclu_object seq, par;
+  REQUIRE(basiclu_obj_initialize(&seq, m) == BASICLU_OK);
+  REQUIRE(basiclu_obj_initialize(&par, m) == BASICLU_OK);
+  par.xstore[BASICLU_PARALLEL_MIN_DIM] = 0;
+  par.xstore[BASICLU_PARALLEL_MIN_WIDTH] = 1;
+  for (basiclu_object* obj : {&seq, &par})
+    REQUIRE(basiclu_obj_factorize(obj, Bbegin.data(), Bend.data(), Bi.data(),
+                                  Bx.data()) == BASICLU_OK);
+  std::vector<double> rhs(m), x_seq(m), x_par(m);
+  for (Int i = 0; i < m; i++) rhs[i] = 1.0 / (i + 1);
+  for (Int update = 0; update <= num_update; update++) {
+    if (update > 0) {
+      const Int j0 = (17 * update) % m;
+      const Int irhs[] = {j0, (j0 + 1) % m, (j0 + 2) % m};
+      const double xrhs[] = {3.0, 0.5, -0.5};
+      for (basiclu_object* obj : {&seq, &par}) {
+        REQUIRE(basiclu_obj_solve_for_update(obj, 3, irhs, xrhs, 'N', 1) ==
+                BASICLU_OK);
+        const double xtbl = obj->lhs[j0];
+        REQUIRE(basiclu_obj_solve_for_update(obj, 0, &j0, nullptr, 'T', 0) ==
+                BASICLU_OK);
+        REQUIRE(basiclu_obj_update(obj, xtbl) == BASICLU_OK);
+      }
+      REQUIRE(par.xstore[BASICLU_NFORREST] == update);
+    }
+    for (char trans : {'N', 'T'}) {
+      REQUIRE(basiclu_obj_solve_dense(&seq, rhs.data(), x_seq.data(), trans) ==
+              BASICLU_OK);
+      REQUIRE(basiclu_obj_solve_dense(&par, rhs.data(), x_par.data(), trans) ==
+              BASICLU_OK);
+      for (Int i = 0; i < m; i++)
+        REQUIRE(fabs(x_par[i] - x_seq[i]) < 1e-12);
+    }
+  }
+#ifdef _OPENMP
+  omp_set_num_threads(num_threads);
+#endif
+  basiclu_obj_free(&seq);
+  basiclu_obj_free(&par);
+}
@@ -1,5 +1,6 @@
 #include "Highs.h"
 #include "catch.hpp"
+#include "presolve/PresolveComponent.h"
 
 struct IterationCount {
   int simplex;
@@ -212,8 +213,8 @@ void testSolversSetup(const std::string model,
         int)SimplexStrategy::SIMPLEX_STRATEGY_DUAL_MULTI] = 89;
     simplex_strategy_iteration_count[(
         int)SimplexStrategy::SIMPLEX_STRATEGY_PRIMAL] = 101;
-    model_iteration_count.ipm = 13;
-    model_iteration_count.crossover = 16;
+    model_iteration_count.ipm = 12;
+    model_iteration_count.crossover = 19;
   }
 }
 
@@ -290,6 +291,11 @@ TEST_CASE("LP-solver", "[highs_lp_solver]") {
   return_status = highs.setHighsOptionValue("model_file", model_file);
   REQUIRE(return_status == HighsStatus::OK);
 
+  // The counts below are for solving the presolved LP whole, rather
+  // than as its two blocks
+  return_status = highs.setHighsOptionValue("decompose_presolved_lp", false);
+  REQUIRE(return_status == HighsStatus::OK);
+
   read_status = highs.readModel(model_file);
   REQUIRE(read_status == HighsStatus::OK);
 
@@ -443,3 +449,414 @@ TEST_CASE("dual-objective-upper-bound", "[highs_lp_solver]") {
   printf("\nOptimal objective value error = %g\n", error);
   REQUIRE(error < 1e-14);
 }
+
+TEST_CASE("LP-decomposition", "[highs_lp_solver]") {
+  HighsStatus status;
+  Highs highs;
+  const HighsInfo& info = highs.getHighsInfo();
+
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/e226.mps";
+  status = highs.readModel(filename);
+  REQUIRE(status == HighsStatus::OK);
+  status = highs.run();
+  REQUIRE(status == HighsStatus::OK);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::OPTIMAL);
+  const double objective_function_value = info.objective_function_value;
+
+  // Form an LP of three copies of e226, so the presolved LP has at
+  // least three blocks, each with its own optimal solution
+  const HighsLp& lp = highs.getLp();
+  const int num_copy = 3;
+  HighsLp block_lp;
+  block_lp.numCol_ = num_copy * lp.numCol_;
+  block_lp.numRow_ = num_copy * lp.numRow_;
+  block_lp.offset_ = num_copy * lp.offset_;
+  block_lp.Astart_.push_back(0);
+  for (int copy = 0; copy < num_copy; copy++) {
+    for (int col = 0; col < lp.numCol_; col++) {
+      for (int el = lp.Astart_[col]; el < lp.Astart_[col + 1]; el++) {
+        block_lp.Aindex_.push_back(copy * lp.numRow_ + lp.Aindex_[el]);
+        block_lp.Avalue_.push_back(lp.Avalue_[el]);
+      }
+      block_lp.Astart_.push_back((int)block_lp.Aindex_.size());
+    }
+    block_lp.colCost_.insert(block_lp.colCost_.end(), lp.colCost_.begin(),
+                             lp.colCost_.end());
+    block_lp.colLower_.insert(block_lp.colLower_.end(), lp.colLower_.begin(),
+                              lp.colLower_.end());
+    block_lp.colUpper_.insert(block_lp.colUpper_.end(), lp.colUpper_.begin(),
+                              lp.colUpper_.end());
+    block_lp.rowLower_.insert(block_lp.rowLower_.end(), lp.rowLower_.begin(),
+                              lp.rowLower_.end());
+    block_lp.rowUpper_.insert(block_lp.rowUpper_.end(), lp.rowUpper_.begin(),
+                              lp.rowUpper_.end());
+  }
+
+  for (int decompose = 0; decompose <= 1; decompose++) {
+    status = highs.passModel(block_lp);
+    REQUIRE(status == HighsStatus::OK);
+    status = highs.setHighsOptionValue("decompose_presolved_lp",
+                                       decompose != 0);
+    REQUIRE(status == HighsStatus::OK);
+    status = highs.run();
+    REQUIRE(status == HighsStatus::OK);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::OPTIMAL);
+    const double error =
+        fabs(info.objective_function_value -
+             num_copy * objective_function_value) /
+        fabs(num_copy * objective_function_value);
+    REQUIRE(error < 1e-10);
+    if (decompose) {
+      REQUIRE(info.lp_block_count >= num_copy);
+    } else {
+      REQUIRE(info.lp_block_count == 0);
+    }
+  }
+}
+
+TEST_CASE("presolve-reuse", "[highs_lp_solver]") {
+  HighsStatus status;
+  Highs highs;
+  const HighsInfo& info = highs.getHighsInfo();
+  status = highs.setHighsOptionValue("presolve_reuse", true);
+  REQUIRE(status == HighsStatus::OK);
+
+  // The reductions of e226 do not depend on the costs, so they are
+  // reused for new costs, and those of adlittle do, so it is
+  // presolved again
+  for (std::string model : {"e226", "adlittle"}) {
+    std::string filename =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    Highs fresh;
+    status = fresh.readModel(filename);
+    REQUIRE(status == HighsStatus::OK);
+    HighsLp lp = fresh.getLp();
+    for (int pass = 0; pass < 3; pass++) {
+      // Solve the LP unchanged, then with perturbed costs
+      for (int col = 0; col < lp.numCol_; col++)
+        lp.colCost_[col] *= 1 + 1e-3 * (pass * col % 5);
+      status = fresh.passModel(lp);
+      REQUIRE(status == HighsStatus::OK);
+      status = fresh.run();
+      REQUIRE(status == HighsStatus::OK);
+      REQUIRE(fresh.getModelStatus() == HighsModelStatus::OPTIMAL);
+      const double objective_function_value =
+          fresh.getHighsInfo().objective_function_value;
+
+      // Passing the LP invalidates the basis, so presolve is run
+      status = highs.passModel(lp);
+      REQUIRE(status == HighsStatus::OK);
+      status = highs.run();
+      REQUIRE(status == HighsStatus::OK);
+      REQUIRE(highs.getModelStatus() == HighsModelStatus::OPTIMAL);
+      const double error =
+          fabs(info.objective_function_value - objective_function_value) /
+          std::max(1.0, fabs(objective_function_value));
+      REQUIRE(error < 1e-10);
+      const bool reused = model == std::string("e226") && pass > 0;
+      REQUIRE(info.presolve_reused == (reused ? 1 : 0));
+    }
+  }
+}
+
+TEST_CASE("presolve-reuse-bounds", "[highs_lp_solver]") {
+  // min -x0 - 2 x1 - 3 x2 + y s.t. x0 + x1 + x2 <= 4,
+  // x0 + 2 x1 + 3 x2 <= 9, y >= 1, with x in [0, 3] and y in [0, 5].
+  // Presolve removes the singleton row and y, but leaves the rows and
+  // columns of x untouched, so new bounds on x reuse the reductions
+  // and new bounds on y do not
+  HighsLp lp;
+  lp.numCol_ = 4;
+  lp.numRow_ = 3;
+  lp.colCost_ = {-1, -2, -3, 1};
+  lp.colLower_ = {0, 0, 0, 0};
+  lp.colUpper_ = {3, 3, 3, 5};
+  lp.rowLower_ = {-HIGHS_CONST_INF, -HIGHS_CONST_INF, 1};
+  lp.rowUpper_ = {4, 9, HIGHS_CONST_INF};
+  lp.Astart_ = {0, 2, 4, 6, 7};
+  lp.Aindex_ = {0, 1, 0, 1, 0, 1, 2};
+  lp.Avalue_ = {1, 1, 1, 2, 1, 3, 1};
+
+  HighsStatus status;
+  Highs highs;
+  const HighsInfo& info = highs.getHighsInfo();
+  status = highs.setHighsOptionValue("presolve_reuse", true);
+  REQUIRE(status == HighsStatus::OK);
+  Highs fresh;
+  status = fresh.setHighsOptionValue("presolve", "off");
+  REQUIRE(status == HighsStatus::OK);
+
+  for (int pass = 0; pass < 3; pass++) {
+    if (pass == 1) lp.colUpper_[2] = 1;
+    if (pass == 2) lp.colLower_[3] = 2;
+    status = fresh.passModel(lp);
+    REQUIRE(status == HighsStatus::OK);
+    status = fresh.run();
+    REQUIRE(status == HighsStatus::OK);
+    REQUIRE(fresh.getModelStatus() == HighsModelStatus::OPTIMAL);
+
+    status = highs.passModel(lp);
+    REQUIRE(status == HighsStatus::OK);
+    status = highs.run();
+    REQUIRE(status == HighsStatus::OK);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::OPTIMAL);
+    REQUIRE(fabs(info.objective_function_value -
+                 fresh.getHighsInfo().objective_function_value) < 1e-10);
+    // The value of y is recovered by postsolve
+    REQUIRE(highs.getSolution().col_value[3] == (pass == 2 ? 2 : 1));
+    REQUIRE(info.presolve_reused == (pass == 1 ? 1 : 0));
+  }
+}
+
+TEST_CASE("presolve-implied-bounds", "[highs_lp_solver]") {
+  // min -x + y + z s.t. -3 <= x + z <= 4, x + y + z = 5, with x free,
+  // y in [-1, 10] and z in [0, 1]. The first row implies x in [-4, 4],
+  // by which the second implies y in [0, 9], so the column singleton y
+  // is implied free. Its row has three entries, so it is not a
+  // doubleton equation, and no row has a finite activity, so only the
+  // implied bound pass finds the bounds on x
+  HighsLp lp;
+  lp.numCol_ = 3;
+  lp.numRow_ = 2;
+  lp.colCost_ = {-1, 1, 1};
+  lp.colLower_ = {-HIGHS_CONST_INF, -1, 0};
+  lp.colUpper_ = {HIGHS_CONST_INF, 10, 1};
+  lp.rowLower_ = {-3, 5};
+  lp.rowUpper_ = {4, 5};
+  lp.Astart_ = {0, 2, 3, 5};
+  lp.Aindex_ = {0, 1, 1, 0, 1};
+  lp.Avalue_ = {1, 1, 1, 1, 1};
+
+  std::vector<presolve::Presolver> order = {
+      presolve::Presolver::kMainRowSingletons,
+      presolve::Presolver::kMainForcing,
+      presolve::Presolver::kMainImpliedBounds,
+      presolve::Presolver::kMainRowSingletons,
+      presolve::Presolver::kMainDoubletonEq,
+      presolve::Presolver::kMainRowSingletons,
+      presolve::Presolver::kMainColSingletons,
+      presolve::Presolver::kMainDominatedCols,
+      presolve::Presolver::kMainDuplicateRows,
+      presolve::Presolver::kMainDuplicateCols};
+  for (int pass = 0; pass < 2; pass++) {
+    if (pass == 1) order.erase(order.begin() + 2);
+    HighsTimer timer;
+    PresolveComponent presolve;
+    presolve.options_.order = order;
+    presolve.init(lp, timer);
+    // Removing y and its row leaves x a free column singleton, so
+    // the whole LP is reduced. Without the bounds on x, nothing is
+    REQUIRE(presolve.run() == (pass == 0 ? HighsPresolveStatus::ReducedToEmpty
+                                         : HighsPresolveStatus::NotReduced));
+  }
+
+  // The optimum x = 4, y = 1, z = 0 is unique, and postsolve recovers
+  // it
+  HighsStatus status;
+  Highs highs;
+  status = highs.passModel(lp);
+  REQUIRE(status == HighsStatus::OK);
+  status = highs.run();
+  REQUIRE(status == HighsStatus::OK);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::OPTIMAL);
+  REQUIRE(fabs(highs.getHighsInfo().objective_function_value + 3) < 1e-10);
+  const HighsSolution& solution = highs.getSolution();
+  REQUIRE(fabs(solution.col_value[0] - 4) < 1e-10);
+  REQUIRE(fabs(solution.col_value[1] - 1) < 1e-10);
+  REQUIRE(fabs(solution.col_value[2]) < 1e-10);
+  REQUIRE(fabs(solution.row_value[0] - 4) < 1e-10);
+  REQUIRE(fabs(solution.row_value[1] - 5) < 1e-10);
+}
+
+TEST_CASE("postsolve-basis", "[highs_lp_solver]") {
+  // The basis recovered by postsolve from an optimal basis of the
+  // presolved LP is optimal for the original LP, so hot-starting the
+  // simplex solver from it needs no iterations. The presolved LP of
+  // greenbea has doubleton equations whose columns are fixed, and
+  // boxed columns nonbasic at their upper bound
+  HighsStatus status;
+  Highs highs;
+  status = highs.setHighsOptionValue("message_level", 0);
+  REQUIRE(status == HighsStatus::OK);
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/greenbea.mps";
+  status = highs.readModel(filename);
+  REQUIRE(status == HighsStatus::OK);
+  const HighsLp lp = highs.getLp();
+
+  HighsTimer timer;
+  PresolveComponent presolve;
+  presolve.init(lp, timer);
+  REQUIRE(presolve.run() == HighsPresolveStatus::Reduced);
+
+  Highs reduced;
+  status = reduced.setHighsOptionValue("message_level", 0);
+  REQUIRE(status == HighsStatus::OK);
+  status = reduced.passModel(presolve.getReducedProblem());
+  REQUIRE(status == HighsStatus::OK);
+  status = reduced.run();
+  REQUIRE(status == HighsStatus::OK);
+  REQUIRE(reduced.getModelStatus() == HighsModelStatus::OPTIMAL);
+
+  presolve.data_.reduced_solution_ = reduced.getSolution();
+  presolve.data_.reduced_basis_ = reduced.getBasis();
+  HighsPostsolveStatus postsolve_status =
+      presolve.data_.presolve_[0].postsolve(
+          presolve.data_.reduced_solution_, presolve.data_.reduced_basis_,
+          presolve.data_.recovered_solution_, presolve.data_.recovered_basis_);
+  REQUIRE(postsolve_status == HighsPostsolveStatus::SolutionRecovered);
+  HighsBasis basis = presolve.data_.recovered_basis_;
+  basis.valid_ = true;
+  for (const HighsBasisStatus col_status : basis.col_status)
+    REQUIRE(col_status != HighsBasisStatus::NONBASIC);
+  for (const HighsBasisStatus row_status : basis.row_status)
+    REQUIRE(row_status != HighsBasisStatus::NONBASIC);
+
+  status = highs.setBasis(basis);
+  REQUIRE(status == HighsStatus::OK);
+  status = highs.run();
+  REQUIRE(status == HighsStatus::OK);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::OPTIMAL);
+  REQUIRE(highs.getHighsInfo().simplex_iteration_count == 0);
+}
+
+// Solves the LP reduced by presolve, and returns the objective of the
+// solution recovered by postsolve
+double solvePresolvedLp(const HighsLp& lp, PresolveComponent& presolve) {
+  REQUIRE(presolve.presolve_status_ == HighsPresolveStatus::Reduced);
+  Highs reduced;
+  HighsStatus status = reduced.setHighsOptionValue("message_level", 0);
+  REQUIRE(status == HighsStatus::OK);
+  status = reduced.passModel(presolve.getReducedProblem());
+  REQUIRE(status == HighsStatus::OK);
+  status = reduced.run();
+  REQUIRE(status == HighsStatus::OK);
+  REQUIRE(reduced.getModelStatus() == HighsModelStatus::OPTIMAL);
+
+  presolve.data_.reduced_solution_ = reduced.getSolution();
+  presolve.data_.reduced_basis_ = reduced.getBasis();
+  HighsPostsolveStatus postsolve_status =
+      presolve.data_.presolve_[0].postsolve(
+          presolve.data_.reduced_solution_, presolve.data_.reduced_basis_,
+          presolve.data_.recovered_solution_, presolve.data_.recovered_basis_);
+  REQUIRE(postsolve_status == HighsPostsolveStatus::SolutionRecovered);
+  const HighsSolution& solution = presolve.data_.recovered_solution_;
+  double objective = lp.offset_;
+  for (int col = 0; col < lp.numCol_; col++)
+    objective += lp.colCost_[col] * solution.col_value[col];
+  return objective;
+}
+
+TEST_CASE("presolve-work-limit", "[highs_lp_solver]") {
+  // Presolve of 25fv47 makes several passes of its main loop. Bounding
+  // its work by the size of the LP stops it after the first ones, and
+  // a reduction rate that no presolver meets throttles them all, yet
+  // the presolved LP still gives the optimum
+  HighsStatus status;
+  Highs highs;
+  status = highs.setHighsOptionValue("message_level", 0);
+  REQUIRE(status == HighsStatus::OK);
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+  status = highs.readModel(filename);
+  REQUIRE(status == HighsStatus::OK);
+  const HighsLp lp = highs.getLp();
+  const double lp_size = lp.Avalue_.size() + lp.numRow_ + lp.numCol_;
+  status = highs.setHighsOptionValue("presolve", "off");
+  REQUIRE(status == HighsStatus::OK);
+  status = highs.run();
+  REQUIRE(status == HighsStatus::OK);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::OPTIMAL);
+  const double optimal_objective =
+      highs.getHighsInfo().objective_function_value;
+
+  int default_passes = 0;
+  double default_work = 0;
+  for (int run = 0; run < 4; run++) {
+    HighsTimer timer;
+    PresolveComponent presolve;
+    if (run == 1) presolve.options_.work_limit = 1;
+    if (run == 2) presolve.options_.min_reductions_per_work = 0;
+    if (run == 3) presolve.options_.min_reductions_per_work = 1e9;
+    presolve.init(lp, timer);
+    presolve.run();
+    const presolve::Presolve& data = presolve.data_.presolve_[0];
+    int skips = 0;
+    for (const auto& entry : data.getPresolverRecords())
+      skips += entry.second.skips;
+    if (run == 0) {
+      REQUIRE(!data.reachedWorkLimit());
+      REQUIRE(data.numPasses() > 2);
+      default_passes = data.numPasses();
+      default_work = data.getWork();
+    } else if (run == 1) {
+      // The limit is checked before each presolver is called
+      REQUIRE(data.reachedWorkLimit());
+      REQUIRE(data.getWork() >= lp_size);
+      REQUIRE(data.getWork() < default_work);
+      REQUIRE(data.numPasses() < default_passes);
+    } else if (run == 2) {
+      REQUIRE(skips == 0);
+    } else {
+      // Every presolver falls short of the rate, so is skipped
+      for (const auto& entry : data.getPresolverRecords())
+        REQUIRE(entry.second.skips > 0);
+    }
+    const double objective = solvePresolvedLp(lp, presolve);
+    REQUIRE(fabs(objective - optimal_objective) <
+            1e-8 * (1 + fabs(optimal_objective)));
+  }
+}
+
+TEST_CASE("ipm-warm-start", "[highs_lp_solver]") {
+  // Solve afiro with IPX, change its row bounds and solve it again,
+  // once cold and once warm started from the first solve, which must
+  // take fewer IPM iterations for the same optimum. The iteration
+  // counts accumulate over the runs of a model
+  HighsStatus status;
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/afiro.mps";
+  Highs cold;
+  Highs warm;
+  int first_iteration_count[2];
+  for (int run = 0; run < 2; run++) {
+    Highs& highs = run == 0 ? cold : warm;
+    status = highs.setHighsOptionValue("message_level", 0);
+    REQUIRE(status == HighsStatus::OK);
+    status = highs.setHighsOptionValue("presolve", "off");
+    REQUIRE(status == HighsStatus::OK);
+    status = highs.setHighsOptionValue("solver", "ipm");
+    REQUIRE(status == HighsStatus::OK);
+    status = highs.setHighsOptionValue("ipm_warm_start", run == 1);
+    REQUIRE(status == HighsStatus::OK);
+    status = highs.readModel(filename);
+    REQUIRE(status == HighsStatus::OK);
+    status = highs.run();
+    REQUIRE(status == HighsStatus::OK);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::OPTIMAL);
+    first_iteration_count[run] = highs.getHighsInfo().ipm_iteration_count;
+  }
+
+  HighsLp lp = warm.getLp();
+  for (int row = 0; row < lp.numRow_; row++) {
+    if (lp.rowLower_[row] > -HIGHS_CONST_INF) lp.rowLower_[row] *= 1.01;
+    if (lp.rowUpper_[row] < HIGHS_CONST_INF) lp.rowUpper_[row] *= 1.01;
+  }
+  std::vector<int> mask(lp.numRow_, 1);
+  int iteration_count[2];
+  double objective[2];
+  for (int run = 0; run < 2; run++) {
+    Highs& highs = run == 0 ? cold : warm;
+    REQUIRE(highs.changeRowsBounds(&mask[0], &lp.rowLower_[0],
+                                   &lp.rowUpper_[0]));
+    status = highs.run();
+    REQUIRE(status == HighsStatus::OK);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::OPTIMAL);
+    const HighsInfo& info = highs.getHighsInfo();
+    iteration_count[run] =
+        info.ipm_iteration_count - first_iteration_count[run];
+    objective[run] = info.objective_function_value;
+  }
+  REQUIRE(iteration_count[1] > 0);
+  REQUIRE(iteration_count[1] < iteration_count[0]);
+  REQUIRE(fabs(objective[1] - objective[0]) < 1e-6);
+}
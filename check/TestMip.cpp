@@ -0,0 +1,431 @@
+#include <cstdio>
+#include <vector>
+
+#include "catch.hpp"
+#include "lp_data/HighsLp.h"
+#include "mip/HighsConflictPool.h"
+#include "mip/HighsCutPool.h"
+#include "mip/HighsDomain.h"
+#include "mip/HighsMipCheckpoint.h"
+#include "mip/HighsMipHeuristics.h"
+#include "mip/HighsMipPresolve.h"
+#include "mip/HighsMipSolver.h"
+
+// max x + y s.t. x + y <= 1.5, x, y binary, written as a minimization
+static HighsLp smallBinaryMip() {
+  HighsLp lp;
+  lp.numCol_ = 2;
+  lp.numRow_ = 1;
+  lp.colCost_ = {-1, -1};
+  lp.colLower_ = {0, 0};
+  lp.colUpper_ = {1, 1};
+  lp.rowLower_ = {-HIGHS_CONST_INF};
+  lp.rowUpper_ = {1.5};
+  lp.Astart_ = {0, 1, 2};
+  lp.Aindex_ = {0, 0};
+  lp.Avalue_ = {1, 1};
+  lp.integrality_ = {1, 1};
+  return lp;
+}
+
+// max 5 x0 + 4 x1 + 3 x2 + 2 x3 s.t. 2 x0 + 3 x1 + 4 x2 + 5 x3 <= 6, x
+// binary, written as a minimization. The LP optimum (1, 1, 0.25, 0)
+// rounds down to the optimal solution (1, 1, 0, 0), and agrees with it
+// in three of the four columns, so RINS is worthwhile at the root
+static HighsLp smallKnapsackMip() {
+  HighsLp lp;
+  lp.numCol_ = 4;
+  lp.numRow_ = 1;
+  lp.colCost_ = {-5, -4, -3, -2};
+  lp.colLower_ = {0, 0, 0, 0};
+  lp.colUpper_ = {1, 1, 1, 1};
+  lp.rowLower_ = {-HIGHS_CONST_INF};
+  lp.rowUpper_ = {6};
+  lp.Astart_ = {0, 1, 2, 3, 4};
+  lp.Aindex_ = {0, 0, 0, 0};
+  lp.Avalue_ = {2, 3, 4, 5};
+  lp.integrality_ = {1, 1, 1, 1};
+  return lp;
+}
+
+// No commas in test case name.
+TEST_CASE("mip-heuristic-rounding", "[highs_mip]") {
+  HighsLp lp = smallBinaryMip();
+  HighsMipRounding rounding;
+  rounding.setup(lp);
+  REQUIRE(rounding.getDownLocks()[0] == 0);
+  REQUIRE(rounding.getUpLocks()[0] == 1);
+
+  // LP optimum of the relaxation
+  std::vector<double> value = {1, 0.5};
+  std::vector<double> solution;
+  REQUIRE(rounding.simpleRounding(lp.colLower_, lp.colUpper_, value, solution));
+  REQUIRE(solution[0] == 1);
+  REQUIRE(solution[1] == 0);
+  REQUIRE(rounding.objectiveValue(solution) == -1);
+
+  // Both variables are locked in both directions by an equation, but
+  // shifting the rounded values repairs it
+  lp.rowLower_ = {1};
+  lp.rowUpper_ = {1};
+  lp.colCost_ = {1, 1};
+  rounding.setup(lp);
+  value = {0.5, 0.5};
+  REQUIRE(
+      !rounding.simpleRounding(lp.colLower_, lp.colUpper_, value, solution));
+  REQUIRE(rounding.shiftRounding(lp.colLower_, lp.colUpper_, value, solution));
+  REQUIRE(rounding.isFeasible(solution));
+  REQUIRE(solution[0] + solution[1] == 1);
+}
+
+TEST_CASE("mip-heuristic-incumbent", "[highs_mip]") {
+  // The heuristics find the optimal solution at the root, so the
+  // search only has to prove it optimal
+  HighsLp lp = smallKnapsackMip();
+  HighsOptions options;
+  options.message_level = 0;
+  options.mip_report_level = 0;
+  options.mip_presolve = false;
+  options.mip_cut_rounds = 0;
+  options.mip_heuristic_effort = 1;
+  HighsMipSolver solver(options, lp);
+  // An exhausted tree is reported as under development
+  REQUIRE(solver.runMipSolver() == HighsMipStatus::kUnderDevelopment);
+  const HighsMipHeuristicStats& stats = solver.getHeuristicStats();
+  REQUIRE(stats.getRecord(HighsMipHeuristic::kSimpleRounding).num_success >
+          0);
+  REQUIRE(solver.getMipSolution() == std::vector<double>({1, 1, 0, 0}));
+
+  // Without integrality the rounding heuristics keep the LP solution
+  lp.integrality_.clear();
+  HighsMipRounding rounding;
+  rounding.setup(lp);
+  std::vector<double> value = {1, 1, 0.25, 0};
+  std::vector<double> solution;
+  REQUIRE(rounding.simpleRounding(lp.colLower_, lp.colUpper_, value, solution));
+  REQUIRE(solution == value);
+  REQUIRE(rounding.shiftRounding(lp.colLower_, lp.colUpper_, value, solution));
+  REQUIRE(solution == value);
+}
+
+TEST_CASE("mip-cut-pool", "[highs_mip]") {
+  HighsCutPool pool;
+  // x + y >= 1 and a weaker multiple 2x + 2y >= 1
+  int cut0;
+  REQUIRE(pool.addCut({0, 1}, {1, 1}, 1, cut0) == HighsCutStatus::kAdded);
+  REQUIRE(cut0 == 0);
+  int cut;
+  REQUIRE(pool.addCut({0, 1}, {2, 2}, 1, cut) == HighsCutStatus::kRedundant);
+  REQUIRE(cut == cut0);
+  // A stronger multiple replaces the right hand side
+  REQUIRE(pool.addCut({0, 1}, {2, 2}, 4, cut) ==
+          HighsCutStatus::kStrengthened);
+  REQUIRE(cut == cut0);
+  REQUIRE(pool.getCut(cut0).lower == 2);
+  REQUIRE(pool.getNumCutsAdded() == 1);
+  REQUIRE(pool.addCut({0, 1}, {0, 0}, 1, cut) == HighsCutStatus::kEmpty);
+  REQUIRE(cut == -1);
+  int cut1;
+  int cut2;
+  pool.addCut({0, 2}, {1, 1}, 1, cut1);
+  pool.addCut({0, 1, 2}, {1, 1, 0.01}, 1, cut2);
+  REQUIRE(pool.getNumCuts() == 3);
+
+  // All cuts are violated at the origin, but the third is almost
+  // parallel to the first
+  std::vector<double> col_value = {0, 0, 0};
+  std::vector<int> cut_set;
+  pool.separate(col_value, 10, cut_set);
+  REQUIRE(cut_set.size() == 2);
+  REQUIRE(cut_set[0] == cut0);
+  REQUIRE(cut_set[1] == cut1);
+  REQUIRE(pool.efficacy(cut0, col_value) > pool.efficacy(cut2, col_value));
+
+  // Cuts that are never violated again leave the pool
+  col_value = {2, 2, 2};
+  for (int round = 0; round <= mip_cut_max_age; round++)
+    pool.ageCuts(col_value);
+  REQUIRE(pool.getNumCuts() == 0);
+  REQUIRE(pool.getNumCutsRemoved() == 3);
+}
+
+TEST_CASE("mip-domain-propagation", "[highs_mip]") {
+  // x + y + z >= 2 and x + y <= 1 + 2w, with x, y, z binary and w
+  // continuous in [0, 5]
+  HighsLp lp;
+  lp.numCol_ = 4;
+  lp.numRow_ = 2;
+  lp.colCost_ = {0, 0, 0, 0};
+  lp.colLower_ = {0, 0, 0, 0};
+  lp.colUpper_ = {1, 1, 1, 5};
+  lp.rowLower_ = {2, -HIGHS_CONST_INF};
+  lp.rowUpper_ = {HIGHS_CONST_INF, 1};
+  lp.Astart_ = {0, 2, 4, 5, 6};
+  lp.Aindex_ = {0, 1, 0, 1, 0, 1};
+  lp.Avalue_ = {1, 1, 1, 1, 1, -2};
+  lp.integrality_ = {1, 1, 1, 0};
+  HighsDomain domain;
+  domain.setup(lp);
+  REQUIRE(domain.getMinActivity(0) == 0);
+  REQUIRE(domain.getMaxActivity(0) == 3);
+  REQUIRE(domain.getMinActivity(1) == -10);
+
+  // Fixing x at zero forces y and z to one
+  std::vector<double> col_lower = lp.colLower_;
+  std::vector<double> col_upper = lp.colUpper_;
+  col_upper[0] = 0;
+  REQUIRE(domain.propagate(col_lower, col_upper));
+  REQUIRE(col_lower[1] == 1);
+  REQUIRE(col_lower[2] == 1);
+  REQUIRE(domain.getMinActivity(0) == 2);
+
+  // Fixing both x and y at one forces w to be at least one half
+  col_lower = lp.colLower_;
+  col_upper = lp.colUpper_;
+  col_lower[0] = 1;
+  col_lower[1] = 1;
+  REQUIRE(domain.propagate(col_lower, col_upper));
+  REQUIRE(col_lower[3] == 0.5);
+  REQUIRE(col_upper[2] == 1);
+
+  // Fixing x and y at zero is infeasible without an LP solve
+  col_lower = lp.colLower_;
+  col_upper = lp.colUpper_;
+  col_upper[0] = 0;
+  col_upper[1] = 0;
+  REQUIRE(!domain.propagate(col_lower, col_upper));
+}
+
+TEST_CASE("mip-conflict-propagation", "[highs_mip]") {
+  // Three binary columns in the single row x + y + z <= 3
+  HighsLp lp;
+  lp.numCol_ = 3;
+  lp.numRow_ = 1;
+  lp.colCost_ = {0, 0, 0};
+  lp.colLower_ = {0, 0, 0};
+  lp.colUpper_ = {1, 1, 1};
+  lp.rowLower_ = {-HIGHS_CONST_INF};
+  lp.rowUpper_ = {3};
+  lp.Astart_ = {0, 1, 2, 3};
+  lp.Aindex_ = {0, 0, 0};
+  lp.Avalue_ = {1, 1, 1};
+  lp.integrality_ = {1, 1, 1};
+
+  // x >= 1 and y >= 1 cannot both hold
+  HighsConflictPool conflict_pool;
+  conflict_pool.setup(lp.numCol_);
+  REQUIRE(conflict_pool.addConflict({}) == -1);
+  REQUIRE(conflict_pool.addConflict({{0, false, 1}, {1, false, 1}}) == 0);
+  REQUIRE(conflict_pool.getNumConflicts() == 1);
+  REQUIRE(conflict_pool.getColConflicts(1).size() == 1);
+  REQUIRE(conflict_pool.getColConflicts(2).size() == 0);
+
+  HighsDomain domain;
+  domain.setup(lp);
+  domain.setConflictPool(&conflict_pool);
+
+  // Fixing x at one forces y to zero
+  std::vector<double> col_lower = lp.colLower_;
+  std::vector<double> col_upper = lp.colUpper_;
+  col_lower[0] = 1;
+  REQUIRE(domain.propagate(col_lower, col_upper));
+  REQUIRE(col_upper[1] == 0);
+  REQUIRE(col_upper[2] == 1);
+
+  // Fixing both at one is infeasible because of the conflict
+  col_lower = lp.colLower_;
+  col_upper = lp.colUpper_;
+  col_lower[0] = 1;
+  col_lower[1] = 1;
+  REQUIRE(!domain.propagate(col_lower, col_upper));
+  REQUIRE(domain.isConflictInfeasible());
+}
+
+TEST_CASE("mip-checkpoint", "[highs_mip]") {
+  HighsLp lp = smallBinaryMip();
+  HighsMipCheckpoint checkpoint;
+  checkpoint.model_hash = hashMipModel(lp);
+  checkpoint.num_nodes_formed = 3;
+  checkpoint.num_nodes_solved = 1;
+  checkpoint.num_integer_solutions = 1;
+  checkpoint.best_objective = -1;
+  checkpoint.best_solution = {1, 0};
+  HighsCheckpointNode node;
+  node.id = 2;
+  node.parent_id = 0;
+  node.level = 1;
+  node.branch_col = 1;
+  node.parent_objective = -1.5;
+  node.index = {1};
+  node.lower = {1};
+  node.upper = {1};
+  checkpoint.nodes.push_back(node);
+  checkpoint.cuts.push_back({{0, 1}, {-1, -1}, -1});
+  checkpoint.conflicts.push_back({{0, false, 1}, {1, false, 1}});
+
+  const std::string filename = "mip-checkpoint.bin";
+  HighsMipCheckpointWriter writer;
+  writer.write(filename, checkpoint);
+  writer.wait();
+  REQUIRE(writer.getNumWritten() == 1);
+
+  HighsMipCheckpoint resumed;
+  REQUIRE(readMipCheckpoint(filename, resumed));
+  REQUIRE(resumed.model_hash == hashMipModel(lp));
+  REQUIRE(resumed.num_nodes_formed == 3);
+  REQUIRE(resumed.best_solution == checkpoint.best_solution);
+  REQUIRE(resumed.nodes.size() == 1);
+  REQUIRE(resumed.nodes[0].id == 2);
+  REQUIRE(resumed.nodes[0].parent_objective == -1.5);
+  REQUIRE(resumed.nodes[0].index == node.index);
+  REQUIRE(resumed.cuts.size() == 1);
+  REQUIRE(resumed.cuts[0].lower == -1);
+  REQUIRE(resumed.conflicts.size() == 1);
+  REQUIRE(resumed.conflicts[0][1].col == 1);
+  REQUIRE(!resumed.conflicts[0][1].upper);
+
+  // A checkpoint is tied to its model
+  lp.rowUpper_ = {1};
+  REQUIRE(hashMipModel(lp) != checkpoint.model_hash);
+
+  std::remove(filename.c_str());
+  REQUIRE(!readMipCheckpoint(filename, resumed));
+}
+
+TEST_CASE("mip-checkpoint-rins", "[highs_mip]") {
+  // RINS solves a sub-MIP with the options of the MIP, which must not
+  // touch the checkpoint of the MIP
+  HighsLp lp = smallKnapsackMip();
+  const std::string filename = "mip-checkpoint-rins.bin";
+  std::remove(filename.c_str());
+  HighsOptions options;
+  options.message_level = 0;
+  options.mip_report_level = 0;
+  options.mip_presolve = false;
+  options.mip_cut_rounds = 0;
+  options.mip_heuristic_effort = 1;
+  options.mip_checkpoint_file = filename;
+  // Stop the tree search after the root so it leaves a checkpoint
+  options.mip_max_nodes = 1;
+  HighsMipSolver solver(options, lp);
+  REQUIRE(solver.runMipSolver() == HighsMipStatus::kMaxNodeReached);
+  REQUIRE(solver.getHeuristicStats().getRecord(HighsMipHeuristic::kRins)
+              .num_call > 0);
+
+  HighsMipCheckpoint checkpoint;
+  REQUIRE(readMipCheckpoint(filename, checkpoint));
+  REQUIRE(checkpoint.model_hash == hashMipModel(lp));
+  REQUIRE(checkpoint.best_solution == std::vector<double>({1, 1, 0, 0}));
+  std::remove(filename.c_str());
+}
+
+TEST_CASE("mip-presolve", "[highs_mip]") {
+  // Binary x0, x1 and x2, and integer x3 in [0.5, 2.5] and x4 in [0, 3]
+  // with the rows
+  //   2 x0 + 2 x1 + x2 <= 3
+  //   x2 - x3 >= 0
+  //   4 x0 + x4 <= 5
+  HighsLp lp;
+  lp.numCol_ = 5;
+  lp.numRow_ = 3;
+  lp.colCost_ = {-1, -1, 1, 1, -1};
+  lp.colLower_ = {0, 0, 0, 0.5, 0};
+  lp.colUpper_ = {1, 1, 1, 2.5, 3};
+  lp.rowLower_ = {-HIGHS_CONST_INF, 0, -HIGHS_CONST_INF};
+  lp.rowUpper_ = {3, HIGHS_CONST_INF, 5};
+  lp.Astart_ = {0, 2, 3, 5, 6, 7};
+  lp.Aindex_ = {0, 2, 0, 0, 1, 1, 2};
+  lp.Avalue_ = {2, 4, 2, 1, 1, -1, 1};
+  lp.integrality_ = {1, 1, 1, 1, 1};
+
+  HighsTimer timer;
+  HighsMipPresolve mip_presolve(timer);
+  REQUIRE(mip_presolve.run(lp) == HighsPresolveStatus::Reduced);
+
+  // x3 is rounded up to one, so x2 is fixed at one and then x3 is
+  // fixed at one, leaving the second row empty
+  const HighsLp& reduced_mip = mip_presolve.getReducedMip();
+  REQUIRE(mip_presolve.getNumColsRemoved() == 2);
+  REQUIRE(mip_presolve.getNumRowsRemoved() == 1);
+  REQUIRE(reduced_mip.numCol_ == 3);
+  REQUIRE(reduced_mip.offset_ == 2);
+
+  // The coefficient of x0 in the third row is reduced to 2 and its
+  // bound to 3, and x0 + x1 <= 1 is added as a clique
+  REQUIRE(reduced_mip.numRow_ == 3);
+  REQUIRE(reduced_mip.rowUpper_[0] == 2);
+  REQUIRE(reduced_mip.rowUpper_[1] == 3);
+  REQUIRE(reduced_mip.Avalue_[1] == 2);
+  REQUIRE(reduced_mip.rowUpper_[2] == 1);
+
+  std::vector<double> solution;
+  mip_presolve.postsolve({1, 0, 1}, solution);
+  REQUIRE(solution == std::vector<double>({1, 0, 1, 1, 1}));
+
+  // Restart with x0 fixed at one at the root, so x1 is fixed at zero,
+  // and only x4 remains
+  HighsLp root_mip = reduced_mip;
+  root_mip.colLower_[0] = 1;
+  REQUIRE(mip_presolve.restart(root_mip) == HighsPresolveStatus::Reduced);
+  REQUIRE(mip_presolve.getReducedMip().numCol_ == 1);
+  REQUIRE(mip_presolve.getNumColsRemoved() == 4);
+
+  // The solution and the cut x0 + x1 + x4 >= 1 of the MIP before the
+  // restart are transformed to the new reduced MIP
+  std::vector<double> reduced_solution;
+  mip_presolve.reduceSolution({1, 0, 1}, reduced_solution);
+  REQUIRE(reduced_solution == std::vector<double>({1}));
+  std::vector<int> index = {0, 1, 2};
+  std::vector<double> value = {1, 1, 1};
+  double lower = 1;
+  REQUIRE(mip_presolve.reduceCut(index, value, lower));
+  REQUIRE(index == std::vector<int>({0}));
+  REQUIRE(lower == 0);
+
+  // Postsolve recovers a solution of the original MIP
+  mip_presolve.postsolve({0}, solution);
+  REQUIRE(solution == std::vector<double>({1, 0, 1, 1, 0}));
+}
+
+TEST_CASE("mip-pool-cuts-at-nodes", "[highs_mip]") {
+  // A two-row knapsack that needs branching after the root cuts. With
+  // pool cuts added at the nodes, the cuts that are slack at a node
+  // are removed from its LP, and the optimum is unchanged
+  const int n = 10;
+  const std::vector<double> weight0 = {12, 17, 23, 29, 31, 37, 41, 43, 47, 53};
+  const std::vector<double> weight1 = {45, 39, 33, 27, 21, 19, 15, 11, 9, 5};
+  HighsLp lp;
+  lp.numCol_ = n;
+  lp.numRow_ = 2;
+  lp.colCost_ = {-14, -19, -26, -31, -34, -40, -43, -46, -49, -55};
+  lp.colLower_.assign(n, 0);
+  lp.colUpper_.assign(n, 1);
+  lp.rowLower_ = {-HIGHS_CONST_INF, -HIGHS_CONST_INF};
+  lp.rowUpper_ = {150, 110};
+  for (int col = 0; col < n; col++) {
+    lp.Astart_.push_back(lp.Aindex_.size());
+    lp.Aindex_.push_back(0);
+    lp.Avalue_.push_back(weight0[col]);
+    lp.Aindex_.push_back(1);
+    lp.Avalue_.push_back(weight1[col]);
+  }
+  lp.Astart_.push_back(lp.Aindex_.size());
+  lp.integrality_.assign(n, 1);
+
+  HighsOptions options;
+  options.message_level = 0;
+  options.mip_report_level = 0;
+  options.mip_presolve = false;
+  options.mip_heuristic_effort = 0;
+  options.mip_pool_cuts_at_nodes = true;
+  HighsMipSolver solver(options, lp);
+  // An exhausted tree is reported as under development
+  REQUIRE(solver.runMipSolver() == HighsMipStatus::kUnderDevelopment);
+  const std::vector<double>& solution = solver.getMipSolution();
+  REQUIRE((int)solution.size() == n);
+  double objective = 0;
+  for (int col = 0; col < n; col++)
+    objective += lp.colCost_[col] * solution[col];
+  REQUIRE(objective == -161);
+  REQUIRE(solver.getNumNodeLpCutsRemoved() > 0);
+}
@@ -1,6 +1,7 @@
 #include "Highs.h"
 #include "catch.hpp"
 #include "lp_data/HConst.h"
+#include "presolve/PresolveComponent.h"
 const double inf = HIGHS_CONST_INF;
 void reportIssue(const int issue) {
   printf("\n *************\n * Issue %3d *\n *************\n", issue);
@@ -405,6 +406,48 @@ void almostNotUnbounded(Highs& highs) {
   reportSolution(highs);
   solve(highs, "off", "ipm", require_model_status2, optimal_objective2);
 }
+void duplicateRowsColumns(Highs& highs) {
+  reportLpName("duplicateRowsColumns");
+  // Rows 1 and 3 are multiples of row 0, and column 2 is twice column
+  // 1, including its cost, so presolve merges them
+  HighsStatus status;
+  HighsLp lp;
+  const HighsModelStatus require_model_status = HighsModelStatus::OPTIMAL;
+  const double optimal_objective = -3;
+  lp.numCol_ = 3;
+  lp.numRow_ = 4;
+  lp.colCost_ = {-1, -1, -2};
+  lp.colLower_ = {0, 0, 0};
+  lp.colUpper_ = {3, 1, 1};
+  lp.rowLower_ = {-inf, 2, -inf, -9};
+  lp.rowUpper_ = {4, inf, 1, inf};
+  lp.Astart_ = {0, 4, 8, 12};
+  lp.Aindex_ = {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3};
+  lp.Avalue_ = {1, 2, 1, -3, 1, 2, -1, -3, 2, 4, -2, -6};
+
+  // Rows 0 and 1 are merged into row 3, which gets the bounds [-9, -3]
+  // of all three rows, and column 1 is merged into column 2 as
+  // x2 + x1 / 2 in [0, 1.5]. No other reduction applies
+  HighsTimer timer;
+  PresolveComponent presolve;
+  presolve.init(lp, timer);
+  REQUIRE(presolve.run() == HighsPresolveStatus::Reduced);
+  const HighsLp& reduced_lp = presolve.getReducedProblem();
+  REQUIRE(reduced_lp.numRow_ == 2);
+  REQUIRE(reduced_lp.numCol_ == 2);
+  REQUIRE(reduced_lp.rowLower_[1] == -9);
+  REQUIRE(reduced_lp.rowUpper_[1] == -3);
+  REQUIRE(reduced_lp.colCost_[1] == -2);
+  REQUIRE(reduced_lp.colLower_[1] == 0);
+  REQUIRE(reduced_lp.colUpper_[1] == 1.5);
+
+  status = highs.passModel(lp);
+  REQUIRE(status == HighsStatus::OK);
+  solve(highs, "on", "simplex", require_model_status, optimal_objective);
+  solve(highs, "off", "simplex", require_model_status, optimal_objective);
+  solve(highs, "on", "ipm", require_model_status, optimal_objective);
+}
+
 TEST_CASE("test-special-lps", "[TestSpecialLps]") {
   Highs highs;
   issue272(highs);
@@ -417,4 +460,5 @@ TEST_CASE("test-special-lps", "[TestSpecialLps]") {
   primalDualInfeasible(highs);
   mpsUnbounded(highs);
   almostNotUnbounded(highs);
+  duplicateRowsColumns(highs);
 }
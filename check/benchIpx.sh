@@ -0,0 +1,72 @@
+#!/bin/sh
+
+# Time the conjugate residual solves with the normal matrix in the
+# initial phase of IPX with an increasing number of OpenMP threads,
+# and check that repeated runs with the same number of threads take
+# the same iterations.
+#
+# usage: benchIpx.sh path/to/highs model.mps ...
+# The thread counts are taken from THREADS, default "1 2 4 8", and
+# each run is repeated REPEATS times, default 3, keeping the fastest.
+
+if [ $# -lt 2 ] ; then
+  echo "usage: $0 path/to/highs model.mps ..."
+  exit 1
+fi
+
+HIGHS="$1"
+shift
+THREADS="${THREADS:-1 2 4 8}"
+REPEATS="${REPEATS:-3}"
+
+# Solve the original LP with IPX only, and have it report its timings
+OPTIONS=`mktemp`
+trap "rm -f $OPTIONS" EXIT
+cat > "$OPTIONS" <<EOF
+presolve = off
+solver = ipm
+run_crossover = false
+message_level = 2
+EOF
+
+printf "%-24s" "Model"
+for t in $THREADS ; do
+  printf " %10s" "$t thr"
+done
+printf "\n"
+
+status=0
+for model in "$@" ; do
+  printf "%-24s" `basename "$model"`
+  for t in $THREADS ; do
+    best=""
+    reference=""
+    differs=0
+    r=0
+    while [ $r -lt $REPEATS ] ; do
+      log=`OMP_NUM_THREADS=$t "$HIGHS" --options_file="$OPTIONS" \
+        "$model" 2>&1`
+      time=`echo "$log" | grep "info.time_cr1 " | awk '{print $2}'`
+      best=`echo "$time $best" | awk '{ if ($2 == "" || $1 < $2) \
+        print $1; else print $2 }'`
+      iterations=`echo "$log" | grep -E "info.(iter|kktiter1) "`
+      if [ -z "$reference" ] ; then
+        reference="$iterations"
+      elif [ "$iterations" != "$reference" ] ; then
+        differs=1
+      fi
+      r=`expr $r + 1`
+    done
+    if [ $differs -ne 0 ] ; then
+      status=1
+      best="differs"
+    fi
+    printf " %10s" "$best"
+  done
+  printf "\n"
+done
+
+if [ $status -ne 0 ] ; then
+  echo "Iterations differ between runs with the same number of threads"
+fi
+exit $status
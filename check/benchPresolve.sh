@@ -0,0 +1,66 @@
+#!/bin/sh
+
+# Time presolve of each model with an increasing number of OpenMP
+# threads, and check that the reductions do not depend on the number
+# of threads.
+#
+# usage: benchPresolve.sh path/to/highs model.mps ...
+# The thread counts are taken from THREADS, default "1 2 4 8", and
+# each run is repeated REPEATS times, default 3, keeping the fastest.
+
+if [ $# -lt 2 ] ; then
+  echo "usage: $0 path/to/highs model.mps ..."
+  exit 1
+fi
+
+HIGHS="$1"
+shift
+THREADS="${THREADS:-1 2 4 8}"
+REPEATS="${REPEATS:-3}"
+
+# Stop the solve at once, so only presolve is timed
+OPTIONS=`mktemp`
+trap "rm -f $OPTIONS" EXIT
+echo "simplex_iteration_limit = 0" > "$OPTIONS"
+
+printf "%-24s" "Model"
+for t in $THREADS ; do
+  printf " %10s" "$t thr"
+done
+printf "\n"
+
+status=0
+for model in "$@" ; do
+  printf "%-24s" `basename "$model"`
+  reference=""
+  for t in $THREADS ; do
+    best=""
+    differs=0
+    r=0
+    while [ $r -lt $REPEATS ] ; do
+      log=`OMP_NUM_THREADS=$t "$HIGHS" --presolve=on \
+        --options_file="$OPTIONS" "$model" 2>&1`
+      time=`echo "$log" | grep "^Time Pre " | awk '{print $4}'`
+      best=`echo "$time $best" | awk '{ if ($2 == "" || $1 < $2) \
+        print $1; else print $2 }'`
+      reductions=`echo "$log" | grep "^Presolve :"`
+      if [ -z "$reference" ] ; then
+        reference="$reductions"
+      elif [ "$reductions" != "$reference" ] ; then
+        differs=1
+      fi
+      r=`expr $r + 1`
+    done
+    if [ $differs -ne 0 ] ; then
+      status=1
+      best="differs"
+    fi
+    printf " %10s" "$best"
+  done
+  printf "\n"
+done
+
+if [ $status -ne 0 ] ; then
+  echo "Reductions differ with the number of threads"
+fi
+exit $status
@@ -741,9 +741,16 @@ class Highs {
   int omp_max_threads = 0;
 
   HighsStatus runLpSolver(const int model_index, const string message);
+  // Solve the LP of the model as independent blocks in parallel.
+  // Returns false if it has only one block or a block is not solved
+  // to optimality, in which case the LP is to be solved whole
+  bool runLpSolverByBlocks(const int model_index);
 
   PresolveComponent presolve_;
   HighsPresolveStatus runPresolve();
+  // Presolve the LP, recording what the next run needs to reuse the
+  // reductions if presolve_reuse is set
+  HighsPresolveStatus runPresolveFromScratch(const double start_presolve);
   HighsPostsolveStatus runPostsolve();
 
   HighsStatus openWriteFile(const string filename, const string method_name,
@@ -30,4 +30,15 @@ struct IpxSolution {
   std::vector<ipxint> ipx_row_status;
 };
 
+// Well centered IPM iterate of the last IPX solve, kept to warm start the IPM
+// when the LP is solved again after changes to its bounds or right-hand side
+struct IpxInteriorSolution {
+  ipxint num_col = 0;
+  ipxint num_row = 0;
+  std::vector<double> x;
+  std::vector<double> slack;
+  std::vector<double> y;
+  std::vector<double> z;
+};
+
 #endif
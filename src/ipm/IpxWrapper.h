@@ -522,7 +522,8 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
                        HighsBasis& highs_basis, HighsSolution& highs_solution,
                        HighsIterationCounts& iteration_counts,
                        HighsModelStatus& unscaled_model_status,
-                       HighsSolutionParams& unscaled_solution_params) {
+                       HighsSolutionParams& unscaled_solution_params,
+                       IpxInteriorSolution& interior_solution) {
   imprecise_solution = false;
   resetModelStatusAndSolutionParams(unscaled_model_status,
                                     unscaled_solution_params, options);
@@ -568,6 +569,7 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
     // tolerances
     parameters.crossover_start = -1;
   }
+  parameters.crossover_handoff = options.ipm_simplex_handoff;
 
   // Set the internal IPX parameters
   lps.SetParameters(parameters);
@@ -583,6 +585,17 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
                   "IPX model has %d rows, %d columns and %d nonzeros",
                   (int)num_row, (int)num_col, (int)Ap[num_col]);
 
+  // Start from the interior solution of the previous solve if the LP has
+  // kept its dimensions
+  if (options.ipm_warm_start && interior_solution.num_col == num_col &&
+      interior_solution.num_row == num_row) {
+    HighsLogMessage(options.logfile, HighsMessageType::INFO,
+                    "IPX warm start from previous interior solution");
+    lps.LoadIPMStartingPoint(num_col, num_row, &interior_solution.x[0],
+                             &interior_solution.slack[0],
+                             &interior_solution.y[0], &interior_solution.z[0]);
+  }
+
   ipx::Int solve_status =
       lps.Solve(num_col, &objective[0], &col_lb[0], &col_ub[0], num_row, &Ap[0],
                 &Ai[0], &Av[0], &rhs[0], &constraint_type[0]);
@@ -720,10 +733,26 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
   lps.GetInteriorSolution(&x[0], &xl[0], &xu[0], &slack[0], &y[0], &zl[0],
                           &zu[0]);
 
+  // Keep a well centered IPM iterate to warm start the next solve
+  interior_solution.num_col = num_col;
+  interior_solution.num_row = num_row;
+  interior_solution.x.resize(num_col);
+  interior_solution.slack.resize(num_row);
+  interior_solution.y.resize(num_row);
+  interior_solution.z.resize(num_col);
+  lps.GetIPMWarmStartPoint(&interior_solution.x[0],
+                           &interior_solution.slack[0],
+                           &interior_solution.y[0], &interior_solution.z[0]);
+
   // Basic solution depends on crossover being run
   const bool have_basic_solution =
       ipx_info.status_crossover != IPX_STATUS_not_run;
   imprecise_solution = ipx_info.status_crossover == IPX_STATUS_imprecise;
+  if (ipx_info.handoff_crossover)
+    HighsLogMessage(options.logfile, HighsMessageType::INFO,
+                    "IPX crossover skipped for %d superbasics: basis handed "
+                    "off to simplex",
+                    (int)ipx_info.superbasics_crossover);
   if (have_basic_solution) {
     IpxSolution ipx_solution;
     ipx_solution.num_col = num_col;
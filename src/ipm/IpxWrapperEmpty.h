@@ -14,6 +14,7 @@
 #ifndef IPM_IPX_WRAPPER_EMPTY_H_
 #define IPM_IPX_WRAPPER_EMPTY_H_
 
+#include "ipm/IpxSolution.h"
 #include "ipm/IpxStatus.h"
 #include "lp_data/HConst.h"
 #include "lp_data/HighsLp.h"
@@ -23,7 +24,8 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
                        HighsBasis& highs_basis, HighsSolution& highs_solution,
                        HighsIterationCounts& iteration_counts,
                        HighsModelStatus& unscaled_model_status,
-                       HighsSolutionParams& unscaled_solution_params) {
+                       HighsSolutionParams& unscaled_solution_params,
+                       IpxInteriorSolution& interior_solution) {
   unscaled_model_status = HighsModelStatus::NOTSET;
   return HighsStatus::Error;
 }
@@ -28,11 +28,11 @@ typedef int64_t lu_int;
 
 /* size of istore */
 #define BASICLU_SIZE_ISTORE_1 1024
-#define BASICLU_SIZE_ISTORE_M 21
+#define BASICLU_SIZE_ISTORE_M 29
 
 /* size of xstore */
 #define BASICLU_SIZE_XSTORE_1 1024
-#define BASICLU_SIZE_XSTORE_M 4
+#define BASICLU_SIZE_XSTORE_M 8
 
 /* ------------ */
 /* status codes */
@@ -70,6 +70,8 @@ typedef int64_t lu_int;
 #define BASICLU_SPARSE_THRESHOLD 12
 #define BASICLU_REMOVE_COLUMNS 13
 #define BASICLU_SEARCH_ROWS 14
+#define BASICLU_PARALLEL_MIN_DIM 15
+#define BASICLU_PARALLEL_MIN_WIDTH 16
 
 /* user readable */
 #define BASICLU_DIM 64
@@ -132,6 +134,7 @@ typedef int64_t lu_int;
 #include "basiclu_factorize.h"
 #include "basiclu_get_factors.h"
 #include "basiclu_solve_dense.h"
+#include "basiclu_solve_dense_multi.h"
 #include "basiclu_solve_sparse.h"
 #include "basiclu_solve_for_update.h"
 #include "basiclu_update.h"
@@ -141,6 +144,7 @@ typedef int64_t lu_int;
 #include "basiclu_obj_factorize.h"
 #include "basiclu_obj_get_factors.h"
 #include "basiclu_obj_solve_dense.h"
+#include "basiclu_obj_solve_dense_multi.h"
 #include "basiclu_obj_solve_sparse.h"
 #include "basiclu_obj_solve_for_update.h"
 #include "basiclu_obj_update.h"
@@ -57,6 +57,19 @@ Arguments:
         Defines which system to solve. 't' or 'T' for the transposed system, any
         other character for the forward system.
 
+Parameters:
+
+    xstore[BASICLU_PARALLEL_MIN_DIM]
+    xstore[BASICLU_PARALLEL_MIN_WIDTH]
+
+        When compiled with OpenMP and more than one thread is available, the
+        triangular solves are done in parallel by level scheduling if the
+        dimension is at least xstore[BASICLU_PARALLEL_MIN_DIM] and each
+        triangular factor has at least xstore[BASICLU_PARALLEL_MIN_WIDTH]
+        unknowns per level on average. Otherwise they are done sequentially.
+        Default: xstore[BASICLU_PARALLEL_MIN_DIM] = 10000,
+        xstore[BASICLU_PARALLEL_MIN_WIDTH] = 256
+
 Info:
 
     xstore[BASICLU_STATUS]: status code.
@@ -0,0 +1,86 @@
+lu_int basiclu_solve_dense_multi
+(
+    lu_int istore[],
+    double xstore[],
+    lu_int Li[],
+    double Lx[],
+    lu_int Ui[],
+    double Ux[],
+    lu_int Wi[],
+    double Wx[],
+    lu_int nrhs,
+    const double rhs[],
+    double lhs[],
+    char trans
+);
+
+/*
+Purpose:
+
+    Given the factorization computed by basiclu_factorize() or basiclu_update()
+    and nrhs dense right-hand sides, solve the linear systems for the solutions
+    at once. The result is the same as from nrhs calls to basiclu_solve_dense()
+    up to rounding errors, but each entry of the factors is loaded once for up
+    to four right-hand sides.
+
+Return:
+
+    BASICLU_ERROR_invalid_store if istore, xstore do not hold a BASICLU
+    instance. In this case xstore[BASICLU_STATUS] is not set.
+
+    Otherwise return the status code. See xstore[BASICLU_STATUS] below.
+
+Arguments:
+
+    lu_int istore[]
+    double xstore[]
+    lu_int Li[]
+    double Lx[]
+    lu_int Ui[]
+    double Ux[]
+    lu_int Wi[]
+    double Wx[]
+
+        Factorization computed by basiclu_factorize() or basiclu_update().
+
+    lu_int nrhs
+
+        The number of right-hand sides. nrhs >= 0.
+
+    const double rhs[m*nrhs]
+
+        The right-hand side vectors stored columnwise. Right-hand side k is
+        rhs[k*m..k*m+m-1].
+
+    double lhs[m*nrhs]
+
+        Uninitialized on entry. On return lhs holds the solutions columnwise.
+
+        lhs and rhs are allowed to be the same array. To overwrite rhs with
+        the solutions pass pointers to the same array.
+
+    char trans
+
+        Defines which system to solve. 't' or 'T' for the transposed system, any
+        other character for the forward system.
+
+Info:
+
+    xstore[BASICLU_STATUS]: status code.
+
+        BASICLU_OK
+
+            The linear systems have been successfully solved.
+
+        BASICLU_ERROR_argument_missing
+
+            One or more of the pointer/array arguments are NULL.
+
+        BASICLU_ERROR_invalid_argument
+
+            nrhs is negative.
+
+        BASICLU_ERROR_invalid_call
+
+            The factorization is invalid.
+*/
@@ -258,6 +258,21 @@ lu_int basiclu_obj_solve_dense(struct basiclu_object *obj, const double rhs[],
                                trans);
 }
 
+/*
+ * basiclu_obj_solve_dense_multi()
+ */
+lu_int basiclu_obj_solve_dense_multi(struct basiclu_object *obj, lu_int nrhs,
+                                     const double rhs[], double lhs[],
+                                     char trans)
+{
+    if (!isvalid(obj))
+        return BASICLU_ERROR_invalid_object;
+
+    return basiclu_solve_dense_multi(obj->istore, obj->xstore, obj->Li,
+                                     obj->Lx, obj->Ui, obj->Ux, obj->Wi,
+                                     obj->Wx, nrhs, rhs, lhs, trans);
+}
+
 /*
  * basiclu_obj_solve_sparse()
  */
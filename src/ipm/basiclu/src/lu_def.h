@@ -19,6 +19,9 @@
 
 enum { NO_TASK, SINGLETONS, SETUP_BUMP, FACTORIZE_BUMP, BUILD_FACTORS };
 
+/* # right-hand sides processed together by lu_solve_dense_multi() */
+#define LU_BLOCK 4
+
 /* -------------------------------------------------------------------------- */
 /* standard macros and inlines */
 /* -------------------------------------------------------------------------- */
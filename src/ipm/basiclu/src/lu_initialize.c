@@ -39,6 +39,8 @@ void lu_initialize(lu_int m, lu_int *istore, double *xstore)
     xstore[BASICLU_SPARSE_THRESHOLD]        = 0.05;
     xstore[BASICLU_REMOVE_COLUMNS]          = 0;
     xstore[BASICLU_SEARCH_ROWS]             = 1;
+    xstore[BASICLU_PARALLEL_MIN_DIM]        = 10000;
+    xstore[BASICLU_PARALLEL_MIN_WIDTH]      = 256;
 
     /* initialize global counters */
     xstore[BASICLU_NFACTORIZE]              = 0;
@@ -22,6 +22,14 @@
 #define BASICLU_UPDATE_COST_NUMER 267
 #define BASICLU_UPDATE_COST_DENOM 268
 #define BASICLU_PIVOTLEN 269
+#define BASICLU_LSCHED_STAMP 270
+#define BASICLU_LTSCHED_STAMP 271
+#define BASICLU_USCHED_STAMP 272
+#define BASICLU_UTSCHED_STAMP 273
+#define BASICLU_LSCHED_NLEVEL 274
+#define BASICLU_LTSCHED_NLEVEL 275
+#define BASICLU_USCHED_NLEVEL 276
+#define BASICLU_UTSCHED_NLEVEL 277
 
 
 /* ==========================================================================
@@ -61,6 +69,8 @@ lu_int lu_load(
     this->compress_thres        = xstore[BASICLU_COMPRESSION_THRESHOLD];
     this->sparse_thres          = xstore[BASICLU_SPARSE_THRESHOLD];
     this->search_rows           = xstore[BASICLU_SEARCH_ROWS] != 0;
+    this->parallel_min_dim      = xstore[BASICLU_PARALLEL_MIN_DIM];
+    this->parallel_min_width    = xstore[BASICLU_PARALLEL_MIN_WIDTH];
 
     /* user readable */
     this->m = m                 = xstore[BASICLU_DIM];
@@ -126,6 +136,14 @@ lu_int lu_load(
     this->rankdef               = xstore[BASICLU_RANKDEF];
     this->min_colnz             = xstore[BASICLU_MIN_COLNZ];
     this->min_rownz             = xstore[BASICLU_MIN_ROWNZ];
+    this->Lsched_stamp          = xstore[BASICLU_LSCHED_STAMP];
+    this->Ltsched_stamp         = xstore[BASICLU_LTSCHED_STAMP];
+    this->Usched_stamp          = xstore[BASICLU_USCHED_STAMP];
+    this->Utsched_stamp         = xstore[BASICLU_UTSCHED_STAMP];
+    this->Lsched_nlevel         = xstore[BASICLU_LSCHED_NLEVEL];
+    this->Ltsched_nlevel        = xstore[BASICLU_LTSCHED_NLEVEL];
+    this->Usched_nlevel         = xstore[BASICLU_USCHED_NLEVEL];
+    this->Utsched_nlevel        = xstore[BASICLU_UTSCHED_NLEVEL];
 
     /* aliases to user arrays */
     this->Lindex = Li; this->Lvalue = Lx;
@@ -147,6 +165,14 @@ lu_int lu_load(
     this->Lbegin_p              = iptr; iptr += m+1;
     this->Ubegin                = iptr; iptr += m+1;
     this->iwork0                = iptr; iptr += m;
+    this->Lsched_begin          = iptr; iptr += m+1;
+    this->Lsched_order          = iptr; iptr += m;
+    this->Ltsched_begin         = iptr; iptr += m+1;
+    this->Ltsched_order         = iptr; iptr += m;
+    this->Usched_begin          = iptr; iptr += m+1;
+    this->Usched_order          = iptr; iptr += m;
+    this->Utsched_begin         = iptr; iptr += m+1;
+    this->Utsched_order         = iptr; iptr += m;
 
     /* share istore memory for solve/update */
     this->pivotcol              = this->colcount_flink;
@@ -168,6 +194,7 @@ lu_int lu_load(
     this->work1                 = xptr; xptr += m;
     this->col_pivot             = xptr; xptr += m;
     this->row_pivot             = xptr; xptr += m;
+    this->work_block            = xptr; xptr += LU_BLOCK*m;
 
     /*
      * Reset @marked if increasing @marker by four causes overflow.
@@ -269,6 +296,14 @@ lu_int lu_save(
     xstore[BASICLU_RANKDEF]                 = this->rankdef;
     xstore[BASICLU_MIN_COLNZ]               = this->min_colnz;
     xstore[BASICLU_MIN_ROWNZ]               = this->min_rownz;
+    xstore[BASICLU_LSCHED_STAMP]            = this->Lsched_stamp;
+    xstore[BASICLU_LTSCHED_STAMP]           = this->Ltsched_stamp;
+    xstore[BASICLU_USCHED_STAMP]            = this->Usched_stamp;
+    xstore[BASICLU_UTSCHED_STAMP]           = this->Utsched_stamp;
+    xstore[BASICLU_LSCHED_NLEVEL]           = this->Lsched_nlevel;
+    xstore[BASICLU_LTSCHED_NLEVEL]          = this->Ltsched_nlevel;
+    xstore[BASICLU_USCHED_NLEVEL]           = this->Usched_nlevel;
+    xstore[BASICLU_UTSCHED_NLEVEL]          = this->Utsched_nlevel;
 
     return status;
 }
@@ -334,6 +369,14 @@ void lu_reset(struct lu *this)
     this->rankdef = 0;
     this->min_colnz = 1;
     this->min_rownz = 1;
+    this->Lsched_stamp = -1;    /* invalidate level schedules */
+    this->Ltsched_stamp = -1;
+    this->Usched_stamp = -1;
+    this->Utsched_stamp = -1;
+    this->Lsched_nlevel = 0;
+    this->Ltsched_nlevel = 0;
+    this->Usched_nlevel = 0;
+    this->Utsched_nlevel = 0;
 
     /*
      * One past the final position in @Wend must hold the file size.
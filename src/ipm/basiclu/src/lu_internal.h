@@ -33,6 +33,8 @@ struct lu
     double compress_thres;
     double sparse_thres;
     lu_int search_rows;
+    lu_int parallel_min_dim;
+    lu_int parallel_min_width;
 
     /* user readable */
     lu_int m;
@@ -100,6 +102,16 @@ struct lu
     lu_int min_colnz;           /* colcount lists 1..min_colnz-1 are empty */
     lu_int min_rownz;           /* rowcount lists 1..min_rownz-1 are empty */
 
+    /* level schedules for parallel dense solves, see lu_solve_dense.c */
+    lu_int Lsched_stamp;        /* valid if == nfactorize */
+    lu_int Ltsched_stamp;
+    lu_int Usched_stamp;        /* valid if == nfactorize + nupdate_total */
+    lu_int Utsched_stamp;
+    lu_int Lsched_nlevel;       /* # levels in schedule */
+    lu_int Ltsched_nlevel;
+    lu_int Usched_nlevel;
+    lu_int Utsched_nlevel;
+
     /* aliases to user arrays */
     lu_int *Lindex, *Uindex, *Windex;
     double *Lvalue, *Uvalue, *Wvalue;
@@ -131,11 +143,18 @@ struct lu
     /* iwork0: size m workspace, zeroed */
     /* marked: size m workspace, 0 <= marked[i] <= @marker */
 
+    /* documented in lu_solve_dense.c */
+    lu_int *Lsched_begin,  *Lsched_order;
+    lu_int *Ltsched_begin, *Ltsched_order;
+    lu_int *Usched_begin,  *Usched_order;
+    lu_int *Utsched_begin, *Utsched_order;
+
     /* pointers into xstore */
     double *work0;              /* size m workspace, zeroed */
     double *work1;              /* size m workspace, uninitialized */
     double *col_pivot;          /* pivot elements by column index */
     double *row_pivot;          /* pivot elements by row index */
+    double *work_block;         /* size LU_BLOCK*m workspace, uninitialized */
 };
 
 
@@ -175,6 +194,10 @@ lu_int lu_singletons(
 void lu_solve_dense(
     struct lu *this, const double *rhs, double *lhs, char trans);
 
+void lu_solve_dense_multi(
+    struct lu *this, const lu_int nrhs, const double *rhs, double *lhs,
+    char trans);
+
 lu_int lu_solve_for_update(
     struct lu *this, const lu_int nrhs, const lu_int *irhs, const double *xrhs,
     lu_int *nlhs, lu_int *ilhs, double *xlhs, char trans);
@@ -6,6 +6,296 @@
  */
 
 #include "lu_internal.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*
+ * Parallel dense solves
+ *
+ * A triangular sweep of a dense solve can be computed in parallel by level
+ * scheduling. An unknown belongs to level 0 if it does not depend on other
+ * unknowns; otherwise its level is one plus the maximum level of the unknowns
+ * it depends on. All unknowns in one level can be computed simultaneously
+ * once the previous levels are done. Because two unknowns of one level may
+ * update the same entry in the column (push) form of the sweep, the parallel
+ * sweeps are done in row (pull) form, in which each unknown is computed by a
+ * dot product from unknowns of lower levels:
+ *
+ *   L      rowwise L           (as the sequential code)
+ *   L'     columnwise L        (as the sequential code)
+ *   U      rowwise U (W file)  (sequential code uses columnwise U)
+ *   U'     columnwise U        (sequential code uses rowwise U)
+ *
+ * The update etas are applied sequentially.
+ *
+ * The schedule of a sweep is stored in
+ *
+ *   Xsched_order[0..m-1]          unknowns (indices of B) ordered by level
+ *   Xsched_begin[0..nlevel]       Xsched_order[Xsched_begin[l]..
+ *                                 Xsched_begin[l+1]-1] are in level l
+ *
+ * for X in {L, Lt, U, Ut}. Schedules are computed when first needed. The
+ * schedules for L and L' are valid until the next factorization, those for
+ * U and U' until the next update, which is tracked by the stamps. A solve
+ * is done in parallel if the dimension is at least
+ * xstore[BASICLU_PARALLEL_MIN_DIM] and both of its sweeps have at least
+ * xstore[BASICLU_PARALLEL_MIN_WIDTH] unknowns per level on average. Otherwise
+ * the sequential code is used. If the schedule for U or U' was too narrow,
+ * it is not recomputed after an update but only after the next
+ * factorization, which resets Xsched_nlevel to zero.
+ */
+#ifdef _OPENMP
+/*
+ * lu_level_schedule()
+ *
+ * Compute the level schedule of a triangular sweep. The unknowns are
+ * processed in the order perm[0..m-1] (reverse == 0) or perm[m-1..0]
+ * (reverse != 0). Unknown i depends on the unknowns index[begin[i]..end[i]-1]
+ * or, when end is NULL, on the unknowns index[begin[i]..] up to a negative
+ * index. level[0..m-1] is workspace. Return the number of levels.
+ */
+static lu_int lu_level_schedule(
+    const lu_int m, const lu_int *perm, const lu_int reverse,
+    const lu_int *begin, const lu_int *end, const lu_int *index,
+    lu_int *level, lu_int *level_begin, lu_int *level_order)
+{
+    lu_int i, k, l, n, pos, nlevel = 0;
+
+    for (n = 0; n < m; n++)
+    {
+        i = perm[reverse ? m-1-n : n];
+        l = 0;
+        if (end)
+        {
+            for (pos = begin[i]; pos < end[i]; pos++)
+                l = MAX(l, level[index[pos]]+1);
+        }
+        else
+        {
+            for (pos = begin[i]; (k = index[pos]) >= 0; pos++)
+                l = MAX(l, level[k]+1);
+        }
+        level[i] = l;
+        nlevel = MAX(nlevel, l+1);
+    }
+
+    /* Bucket sort unknowns by level, keeping the processing order. */
+    memset(level_begin, 0, (nlevel+1)*sizeof(lu_int));
+    for (i = 0; i < m; i++)
+        level_begin[level[i]+1]++;
+    for (l = 0; l < nlevel; l++)
+        level_begin[l+1] += level_begin[l];
+    for (n = 0; n < m; n++)
+    {
+        i = perm[reverse ? m-1-n : n];
+        level_order[level_begin[level[i]]++] = i;
+    }
+    for (l = nlevel; l > 0; l--)
+        level_begin[l] = level_begin[l-1];
+    level_begin[0] = 0;
+    return nlevel;
+}
+
+/*
+ * lu_schedule_dense()
+ *
+ * Compute the level schedules for a dense solve with trans if not valid.
+ * Return nonzero if the solve should be done in parallel.
+ */
+static int lu_schedule_dense(struct lu *this, char trans)
+{
+    const lu_int m          = this->m;
+    const lu_int Lstamp     = this->nfactorize;
+    const lu_int Ustamp     = this->nfactorize + this->nupdate_total;
+    const lu_int width      = MAX(this->parallel_min_width, 1);
+    lu_int *level           = this->iwork1;
+
+    if (trans == 't' || trans == 'T')
+    {
+        if (this->Utsched_stamp != Ustamp)
+        {
+            if (this->Utsched_nlevel * width > m)
+                return 0;
+            this->Utsched_nlevel = lu_level_schedule(
+                m, this->pivotrow, 0, this->Ubegin, NULL, this->Uindex, level,
+                this->Utsched_begin, this->Utsched_order);
+            this->Utsched_stamp = Ustamp;
+        }
+        if (this->Ltsched_stamp != Lstamp)
+        {
+            this->Ltsched_nlevel = lu_level_schedule(
+                m, this->p, 1, this->Lbegin, NULL, this->Lindex, level,
+                this->Ltsched_begin, this->Ltsched_order);
+            this->Ltsched_stamp = Lstamp;
+        }
+        return this->Utsched_nlevel * width <= m &&
+            this->Ltsched_nlevel * width <= m;
+    }
+    else
+    {
+        if (this->Lsched_stamp != Lstamp)
+        {
+            this->Lsched_nlevel = lu_level_schedule(
+                m, this->p, 0, this->Ltbegin, NULL, this->Lindex, level,
+                this->Lsched_begin, this->Lsched_order);
+            this->Lsched_stamp = Lstamp;
+        }
+        if (this->Usched_stamp != Ustamp)
+        {
+            if (this->Usched_nlevel * width > m)
+                return 0;
+            this->Usched_nlevel = lu_level_schedule(
+                m, this->pivotcol, 1, this->Wbegin, this->Wend, this->Windex,
+                level, this->Usched_begin, this->Usched_order);
+            this->Usched_stamp = Ustamp;
+        }
+        return this->Lsched_nlevel * width <= m &&
+            this->Usched_nlevel * width <= m;
+    }
+}
+
+/*
+ * lu_solve_dense_parallel()
+ *
+ * Same as the sequential code in lu_solve_dense() but with the triangular
+ * sweeps done in parallel by levels. The schedules must be valid.
+ */
+static void lu_solve_dense_parallel(
+    struct lu *this, const double *rhs, double *lhs, char trans)
+{
+    const lu_int m                  = this->m;
+    const lu_int nforrest           = this->nforrest;
+    const lu_int *pmap              = this->pmap;
+    const lu_int *qmap              = this->qmap;
+    const lu_int *eta_row           = this->eta_row;
+    const lu_int *Lbegin            = this->Lbegin;
+    const lu_int *Ltbegin           = this->Ltbegin;
+    const lu_int *Ubegin            = this->Ubegin;
+    const lu_int *Rbegin            = this->Rbegin;
+    const lu_int *Wbegin            = this->Wbegin;
+    const lu_int *Wend              = this->Wend;
+    const double *col_pivot         = this->col_pivot;
+    const double *row_pivot         = this->row_pivot;
+    const lu_int *Lindex            = this->Lindex;
+    const double *Lvalue            = this->Lvalue;
+    const lu_int *Uindex            = this->Uindex;
+    const double *Uvalue            = this->Uvalue;
+    const lu_int *Windex            = this->Windex;
+    const double *Wvalue            = this->Wvalue;
+    double *work1                   = this->work1;
+
+    lu_int i, j, l, n, t, ipivot, pos;
+    double x;
+
+    memcpy(work1, rhs, m*sizeof(double));
+
+    if (trans == 't' || trans == 'T')
+    {
+        const lu_int Unlevel        = this->Utsched_nlevel;
+        const lu_int *Ulevel_begin  = this->Utsched_begin;
+        const lu_int *Ulevel_order  = this->Utsched_order;
+        const lu_int Lnlevel        = this->Ltsched_nlevel;
+        const lu_int *Llevel_begin  = this->Ltsched_begin;
+        const lu_int *Llevel_order  = this->Ltsched_order;
+
+        #pragma omp parallel private(i, j, l, t, ipivot, pos, x)
+        {
+            /* Solve with U'. */
+            for (l = 0; l < Unlevel; l++)
+            {
+                #pragma omp for schedule(static)
+                for (n = Ulevel_begin[l]; n < Ulevel_begin[l+1]; n++)
+                {
+                    ipivot = Ulevel_order[n];
+                    x = work1[qmap[ipivot]];
+                    for (pos = Ubegin[ipivot]; (i = Uindex[pos]) >= 0; pos++)
+                        x -= lhs[i] * Uvalue[pos];
+                    lhs[ipivot] = x / col_pivot[qmap[ipivot]];
+                }
+            }
+
+            /* Solve with update ETAs backwards. */
+            #pragma omp single
+            for (t = nforrest-1; t >= 0; t--)
+            {
+                ipivot = eta_row[t];
+                x = lhs[ipivot];
+                for (pos = Rbegin[t]; pos < Rbegin[t+1]; pos++)
+                {
+                    i = Lindex[pos];
+                    lhs[i] -= x * Lvalue[pos];
+                }
+            }
+
+            /* Solve with L'. */
+            for (l = 0; l < Lnlevel; l++)
+            {
+                #pragma omp for schedule(static)
+                for (n = Llevel_begin[l]; n < Llevel_begin[l+1]; n++)
+                {
+                    j = Llevel_order[n];
+                    x = 0.0;
+                    for (pos = Lbegin[j]; (i = Lindex[pos]) >= 0; pos++)
+                        x += lhs[i] * Lvalue[pos];
+                    lhs[j] -= x;
+                }
+            }
+        }
+    }
+    else
+    {
+        const lu_int Lnlevel        = this->Lsched_nlevel;
+        const lu_int *Llevel_begin  = this->Lsched_begin;
+        const lu_int *Llevel_order  = this->Lsched_order;
+        const lu_int Unlevel        = this->Usched_nlevel;
+        const lu_int *Ulevel_begin  = this->Usched_begin;
+        const lu_int *Ulevel_order  = this->Usched_order;
+
+        #pragma omp parallel private(i, j, l, t, ipivot, pos, x)
+        {
+            /* Solve with L. */
+            for (l = 0; l < Lnlevel; l++)
+            {
+                #pragma omp for schedule(static)
+                for (n = Llevel_begin[l]; n < Llevel_begin[l+1]; n++)
+                {
+                    j = Llevel_order[n];
+                    x = 0.0;
+                    for (pos = Ltbegin[j]; (i = Lindex[pos]) >= 0; pos++)
+                        x += work1[i] * Lvalue[pos];
+                    work1[j] -= x;
+                }
+            }
+
+            /* Solve with update ETAs. */
+            #pragma omp single
+            for (t = 0; t < nforrest; t++)
+            {
+                ipivot = eta_row[t];
+                x = 0.0;
+                for (pos = Rbegin[t]; pos < Rbegin[t+1]; pos++)
+                    x += work1[Lindex[pos]] * Lvalue[pos];
+                work1[ipivot] -= x;
+            }
+
+            /* Solve with U. */
+            for (l = 0; l < Unlevel; l++)
+            {
+                #pragma omp for schedule(static)
+                for (n = Ulevel_begin[l]; n < Ulevel_begin[l+1]; n++)
+                {
+                    j = Ulevel_order[n];
+                    x = work1[pmap[j]];
+                    for (pos = Wbegin[j]; pos < Wend[j]; pos++)
+                        x -= lhs[Windex[pos]] * Wvalue[pos];
+                    lhs[j] = x / row_pivot[pmap[j]];
+                }
+            }
+        }
+    }
+}
+#endif
 
 void lu_solve_dense(struct lu *this, const double *rhs, double *lhs, char trans)
 {
@@ -37,6 +327,15 @@ void lu_solve_dense(struct lu *this, const double *rhs, double *lhs, char trans)
     lu_garbage_perm(this);
     assert(this->pivotlen == m);
 
+#ifdef _OPENMP
+    if (m >= this->parallel_min_dim && omp_get_max_threads() > 1 &&
+        !omp_in_parallel() && lu_schedule_dense(this, trans))
+    {
+        lu_solve_dense_parallel(this, rhs, lhs, trans);
+        return;
+    }
+#endif
+
     if (trans == 't' || trans == 'T')
     {
         /* ----------------------- */
@@ -0,0 +1,224 @@
+/*
+ * lu_solve_dense_multi.c
+ *
+ * Copyright (C) 2016-2018  ERGO-Code
+ *
+ */
+
+#include "lu_internal.h"
+
+/*
+ * lu_solve_dense_multi()
+ *
+ * Solve with nrhs dense right-hand sides stored columnwise in rhs[0..m*nrhs-1]
+ * and store the solutions columnwise in lhs[0..m*nrhs-1]. rhs and lhs can
+ * point to the same array.
+ *
+ * The right-hand sides are processed in blocks of LU_BLOCK columns, which are
+ * copied into work_block such that the LU_BLOCK entries of each row are
+ * contiguous. Each entry of L, R and U is then loaded once per block and used
+ * in a loop of fixed length LU_BLOCK, which is vectorized (the simd pragmas
+ * take effect when compiled with OpenMP). A final block with fewer than
+ * LU_BLOCK columns is padded with zeros.
+ *
+ * In both solves the column (push) form of the sweep with U or U' is used,
+ * which writes x[r] into the slot of the pivot that has just been processed.
+ * In the forward solve these are row slots and the solution is copied to
+ * column indices in the final copy. In the transposed solve these are column
+ * slots; they are permuted in place to row slots before the update etas and
+ * L' are applied.
+ */
+void lu_solve_dense_multi(struct lu *this, const lu_int nrhs,
+                          const double *rhs, double *lhs, char trans)
+{
+    const lu_int m                  = this->m;
+    const lu_int nforrest           = this->nforrest;
+    const lu_int *p                 = this->p;
+    const lu_int *pmap              = this->pmap;
+    const lu_int *eta_row           = this->eta_row;
+    const lu_int *pivotcol          = this->pivotcol;
+    const lu_int *pivotrow          = this->pivotrow;
+    const lu_int *Lbegin_p          = this->Lbegin_p;
+    const lu_int *Ltbegin_p         = this->Ltbegin_p;
+    const lu_int *Ubegin            = this->Ubegin;
+    const lu_int *Rbegin            = this->Rbegin;
+    const lu_int *Wbegin            = this->Wbegin;
+    const lu_int *Wend              = this->Wend;
+    const double *col_pivot         = this->col_pivot;
+    const double *row_pivot         = this->row_pivot;
+    const lu_int *Lindex            = this->Lindex;
+    const double *Lvalue            = this->Lvalue;
+    const lu_int *Uindex            = this->Uindex;
+    const double *Uvalue            = this->Uvalue;
+    const lu_int *Windex            = this->Windex;
+    const double *Wvalue            = this->Wvalue;
+    lu_int *marked                  = this->marked;
+    double *X                       = this->work_block;
+
+    lu_int i, k, r, t, ipivot, jpivot, pos, col, nb, M;
+    double a, x[LU_BLOCK], y[LU_BLOCK];
+
+    lu_garbage_perm(this);
+    assert(this->pivotlen == m);
+
+    for (col = 0; col < nrhs; col += LU_BLOCK)
+    {
+        nb = MIN(LU_BLOCK, nrhs-col);
+
+        /* Copy the block of right-hand sides into X. */
+        for (i = 0; i < m; i++)
+        {
+            for (r = 0; r < nb; r++)
+                X[i*LU_BLOCK+r] = rhs[(col+r)*m+i];
+            for ( ; r < LU_BLOCK; r++)
+                X[i*LU_BLOCK+r] = 0.0;
+        }
+
+        if (trans == 't' || trans == 'T')
+        {
+            /* Solve with U'. */
+            for (k = 0; k < m; k++)
+            {
+                jpivot = pivotcol[k];
+                for (r = 0; r < LU_BLOCK; r++)
+                    x[r] = X[jpivot*LU_BLOCK+r] / col_pivot[jpivot];
+                for (pos = Wbegin[jpivot]; pos < Wend[jpivot]; pos++)
+                {
+                    i = Windex[pos];
+                    a = Wvalue[pos];
+                    #pragma omp simd
+                    for (r = 0; r < LU_BLOCK; r++)
+                        X[i*LU_BLOCK+r] -= x[r] * a;
+                }
+                for (r = 0; r < LU_BLOCK; r++)
+                    X[jpivot*LU_BLOCK+r] = x[r];
+            }
+
+            /*
+             * Move the solution of row pmap[j] from slot j to slot pmap[j] by
+             * following the cycles of the permutation.
+             */
+            M = ++this->marker;
+            for (k = 0; k < m; k++)
+            {
+                if (marked[k] == M)
+                    continue;
+                marked[k] = M;
+                for (r = 0; r < LU_BLOCK; r++)
+                    x[r] = X[k*LU_BLOCK+r];
+                for (i = pmap[k]; marked[i] != M; i = pmap[i])
+                {
+                    marked[i] = M;
+                    for (r = 0; r < LU_BLOCK; r++)
+                    {
+                        y[r] = X[i*LU_BLOCK+r];
+                        X[i*LU_BLOCK+r] = x[r];
+                        x[r] = y[r];
+                    }
+                }
+                assert(i == k);
+                for (r = 0; r < LU_BLOCK; r++)
+                    X[k*LU_BLOCK+r] = x[r];
+            }
+
+            /* Solve with update ETAs backwards. */
+            for (t = nforrest-1; t >= 0; t--)
+            {
+                ipivot = eta_row[t];
+                for (r = 0; r < LU_BLOCK; r++)
+                    x[r] = X[ipivot*LU_BLOCK+r];
+                for (pos = Rbegin[t]; pos < Rbegin[t+1]; pos++)
+                {
+                    i = Lindex[pos];
+                    a = Lvalue[pos];
+                    #pragma omp simd
+                    for (r = 0; r < LU_BLOCK; r++)
+                        X[i*LU_BLOCK+r] -= x[r] * a;
+                }
+            }
+
+            /* Solve with L'. */
+            for (k = m-1; k >= 0; k--)
+            {
+                for (r = 0; r < LU_BLOCK; r++)
+                    x[r] = 0.0;
+                for (pos = Lbegin_p[k]; (i = Lindex[pos]) >= 0; pos++)
+                {
+                    a = Lvalue[pos];
+                    #pragma omp simd
+                    for (r = 0; r < LU_BLOCK; r++)
+                        x[r] += X[i*LU_BLOCK+r] * a;
+                }
+                for (r = 0; r < LU_BLOCK; r++)
+                    X[p[k]*LU_BLOCK+r] -= x[r];
+            }
+
+            /* Copy the solution into lhs. */
+            for (i = 0; i < m; i++)
+                for (r = 0; r < nb; r++)
+                    lhs[(col+r)*m+i] = X[i*LU_BLOCK+r];
+        }
+        else
+        {
+            /* Solve with L. */
+            for (k = 0; k < m; k++)
+            {
+                for (r = 0; r < LU_BLOCK; r++)
+                    x[r] = 0.0;
+                for (pos = Ltbegin_p[k]; (i = Lindex[pos]) >= 0; pos++)
+                {
+                    a = Lvalue[pos];
+                    #pragma omp simd
+                    for (r = 0; r < LU_BLOCK; r++)
+                        x[r] += X[i*LU_BLOCK+r] * a;
+                }
+                for (r = 0; r < LU_BLOCK; r++)
+                    X[p[k]*LU_BLOCK+r] -= x[r];
+            }
+
+            /* Solve with update ETAs. */
+            for (t = 0; t < nforrest; t++)
+            {
+                ipivot = eta_row[t];
+                for (r = 0; r < LU_BLOCK; r++)
+                    x[r] = 0.0;
+                for (pos = Rbegin[t]; pos < Rbegin[t+1]; pos++)
+                {
+                    i = Lindex[pos];
+                    a = Lvalue[pos];
+                    #pragma omp simd
+                    for (r = 0; r < LU_BLOCK; r++)
+                        x[r] += X[i*LU_BLOCK+r] * a;
+                }
+                for (r = 0; r < LU_BLOCK; r++)
+                    X[ipivot*LU_BLOCK+r] -= x[r];
+            }
+
+            /* Solve with U. */
+            for (k = m-1; k >= 0; k--)
+            {
+                ipivot = pivotrow[k];
+                for (r = 0; r < LU_BLOCK; r++)
+                    x[r] = X[ipivot*LU_BLOCK+r] / row_pivot[ipivot];
+                for (pos = Ubegin[ipivot]; (i = Uindex[pos]) >= 0; pos++)
+                {
+                    a = Uvalue[pos];
+                    #pragma omp simd
+                    for (r = 0; r < LU_BLOCK; r++)
+                        X[i*LU_BLOCK+r] -= x[r] * a;
+                }
+                for (r = 0; r < LU_BLOCK; r++)
+                    X[ipivot*LU_BLOCK+r] = x[r];
+            }
+
+            /* Copy the solution into lhs. */
+            for (k = 0; k < m; k++)
+            {
+                ipivot = pivotrow[k];
+                jpivot = pivotcol[k];
+                for (r = 0; r < nb; r++)
+                    lhs[(col+r)*m+jpivot] = X[ipivot*LU_BLOCK+r];
+            }
+        }
+    }
+}
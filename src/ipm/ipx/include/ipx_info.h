@@ -52,11 +52,16 @@ struct ipx_info {
     ipxint iter;                /* # interior point iterations */
     ipxint kktiter1;            /* # linear solver iterations before switch */
     ipxint kktiter2;            /* # linear solver iterations after switch */
+    ipxint correctors;          /* # centrality correctors accepted */
+    double correctors_iter_saved; /* estimated # IPM iterations saved */
     ipxint basis_repairs;       /* # basis repairs after crash, < 0 discarded */
     ipxint updates_start;       /* # basis updates for starting basis */
     ipxint updates_ipm;         /* # basis updates in IPM */
     ipxint updates_crossover;   /* # basis updates in crossover */
     ipxint pushes_crossover;    /* # Primal/Dual pushes in crossover */
+    ipxint pushes_batched_crossover; /* ... done in batches */
+    ipxint superbasics_crossover; /* # superbasics before push phases */
+    ipxint handoff_crossover;   /* pushes skipped, basis handed off? */
 
     /* major computation times */
     double time_total;          /* total runtime (wallclock) */
@@ -64,6 +69,8 @@ struct ipx_info {
     double time_ipm2;           /* IPM after switch (without starting basis) */
     double time_starting_basis; /* constructing starting basis */
     double time_crossover;      /* crossover */
+    double time_crossover_primal; /* ... primal push phase */
+    double time_crossover_dual; /* ... dual push phase */
 
     /* profiling linear solver */
     double time_kkt_factorize;  /* factorize/build precond for KKT matrix */
@@ -76,6 +83,13 @@ struct ipx_info {
     double time_cr2_NNt;        /* ... matrix-vector products with NN' */
     double time_cr2_B;          /* ... solves with B */
     double time_cr2_Bt;         /* ... solves with B' */
+    ipxint chol_nnz;            /* nnz in Cholesky factor, 0 if not used */
+    ipxint chol_dropped;        /* # pivots dropped in Cholesky factor */
+    double time_chol_analyse;   /* ordering and symbolic factorization */
+    double time_chol_factorize; /* numeric Cholesky factorizations */
+    ipxint ic_nnz;              /* max nnz in incomplete Cholesky factor */
+    ipxint ic_blocks;           /* # blocks in block-Jacobi preconditioner */
+    ipxint ic_shifts;           /* # incomplete Cholesky restarts with shift */
 
     /* profiling basis factorization */
     double ftran_sparse;        /* fraction of FTRAN solutions sparse */
@@ -20,9 +20,14 @@ struct ipx_parameters {
     double ipm_optimality_tol;
     double ipm_drop_primal;
     double ipm_drop_dual;
+    ipxint ipm_correctors;
 
     /* Linear solver */
     double kkt_tol;
+    ipxint cholesky;
+    ipxint kkt_precond;
+    double ic_droptol;
+    double ic_fill;
 
     /* Basis construction in IPM */
     ipxint crash_basis;
@@ -40,6 +45,8 @@ struct ipx_parameters {
     double crossover_start;
     double pfeasibility_tol;
     double dfeasibility_tol;
+    ipxint crossover_batch;
+    double crossover_handoff;
 
     /* Debugging */
     ipxint debug;
@@ -61,7 +68,12 @@ struct ipx_parameters {
         ipm_optimality_tol = 1e-8;
         ipm_drop_primal = 1e-9;
         ipm_drop_dual = 1e-9;
+        ipm_correctors = -1;
         kkt_tol = 0.3;
+        cholesky = -1;
+        kkt_precond = 0;
+        ic_droptol = 1e-3;
+        ic_fill = 2.0;
         crash_basis = 1;
         dependency_tol = 1e-6;
         volume_tol = 2.0;
@@ -73,6 +85,8 @@ struct ipx_parameters {
         crossover_start = 1e-8;
         pfeasibility_tol = 1e-7;
         dfeasibility_tol = 1e-7;
+        crossover_batch = 1;
+        crossover_handoff = -1.0;
         debug = 0;
         switchiter = -1;
         stop_at_switch = 0;
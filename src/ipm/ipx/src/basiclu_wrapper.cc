@@ -132,6 +132,33 @@ void BasicLu::_SolveDense(const Vector& rhs, Vector& lhs, char trans) {
         throw std::logic_error("basiclu_solve_dense failed");
 }
 
+void BasicLu::_SolveDense(Int nrhs, const double* rhs, double* lhs,
+                          char trans) {
+    Int status = basiclu_solve_dense_multi(istore_.data(), xstore_.data(),
+                                           Li_.data(), Lx_.data(),
+                                           Ui_.data(), Ux_.data(),
+                                           Wi_.data(), Wx_.data(),
+                                           nrhs, rhs, lhs, trans);
+    if (status != BASICLU_OK)
+        throw std::logic_error("basiclu_solve_dense_multi failed");
+}
+
+void BasicLu::_SolveSparse(Int nzrhs, const Int* bi, const double* bx,
+                           IndexedVector& lhs, char trans) {
+    Int nzlhs = 0;
+    lhs.set_to_zero();
+    Int status = basiclu_solve_sparse(istore_.data(), xstore_.data(),
+                                      Li_.data(), Lx_.data(),
+                                      Ui_.data(), Ux_.data(),
+                                      Wi_.data(), Wx_.data(),
+                                      nzrhs, bi, bx,
+                                      &nzlhs, lhs.pattern(), lhs.elements(),
+                                      trans);
+    if (status != BASICLU_OK)
+        throw std::logic_error("basiclu_solve_sparse failed");
+    lhs.set_nnz(nzlhs);
+}
+
 void BasicLu::_FtranForUpdate(Int nzrhs, const Int* bi, const double* bx) {
     Int status;
     for (Int ncall = 0; ; ncall++) {
@@ -4,6 +4,9 @@
 #include <algorithm>
 #include <cmath>
 #include <tuple>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "basiclu_kernel.h"
 #include "basiclu_wrapper.h"
 #include "forrest_tomlin.h"
@@ -170,6 +173,11 @@ void Basis::SolveDense(const Vector& rhs, Vector& lhs, char trans) const {
     lu_->SolveDense(rhs, lhs, trans);
 }
 
+void Basis::SolveDense(Int nrhs, const double* rhs, double* lhs,
+                       char trans) const {
+    lu_->SolveDense(nrhs, rhs, lhs, trans);
+}
+
 void Basis::SolveForUpdate(Int j, IndexedVector& lhs) {
     const Int p = PositionOf(j);
     Timer timer;
@@ -214,12 +222,38 @@ void Basis::SolveForUpdate(Int j) {
     }
 }
 
+void Basis::SolveSparse(const IndexedVector& rhs, IndexedVector& lhs,
+                        char trans) {
+    assert(rhs.nnz() >= 0);
+    Timer timer;
+    std::vector<double> bx(rhs.nnz());
+    for (Int k = 0; k < rhs.nnz(); k++)
+        bx[k] = rhs[rhs.pattern()[k]];
+    lu_->SolveSparse(rhs.nnz(), rhs.pattern(), bx.data(), lhs, trans);
+    if (trans == 't' || trans == 'T') {
+        num_btran_++;
+        if (lhs.sparse())
+            num_btran_sparse_++;
+        time_btran_ += timer.Elapsed();
+    } else {
+        num_ftran_++;
+        if (lhs.sparse())
+            num_ftran_sparse_++;
+        time_ftran_ += timer.Elapsed();
+    }
+}
+
 void Basis::TableauRow(Int jb, IndexedVector& btran, IndexedVector& row,
                        bool ignore_fixed) {
-    const Int m = model_.rows();
-    const Int n = model_.cols();
     assert(IsBasic(jb));
     SolveForUpdate(jb, btran);
+    TableauRow(btran, row, ignore_fixed);
+}
+
+void Basis::TableauRow(const IndexedVector& btran, IndexedVector& row,
+                       bool ignore_fixed) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
 
     // Estimate if tableau row is sparse.
     bool is_sparse = btran.sparse();
@@ -269,6 +303,11 @@ void Basis::TableauRow(Int jb, IndexedVector& btran, IndexedVector& row,
         const SparseMatrix& AI = model_.AI();
         const Int* Ai = AI.rowidx();
         const double* Ax = AI.values();
+        #ifdef _OPENMP
+        const bool parallel = AI.entries() >= kParallelMinNonzeros &&
+            omp_get_max_threads() > 1 && !omp_in_parallel();
+        #endif
+        #pragma omp parallel for schedule(static, 256) if (parallel)
         for (Int j = 0; j < n+m; j++) {
             double result = 0.0;
             if (map2basis_[j] == -1 || (map2basis_[j] == -2 && !ignore_fixed)) {
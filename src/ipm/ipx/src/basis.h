@@ -123,6 +123,14 @@ public:
     // @rhs and @lhs may refer to the same object.
     void SolveDense(const Vector& rhs, Vector& lhs, char trans) const;
 
+    // Solves linear systems with @nrhs dense right-hand sides at once, which
+    // is faster than @nrhs calls to the method above.
+    // @rhs: size m*nrhs array holding the right-hand sides columnwise
+    // @lhs: size m*nrhs array returning the solutions columnwise
+    // @rhs and @lhs may point to the same array.
+    void SolveDense(Int nrhs, const double* rhs, double* lhs,
+                    char trans) const;
+
     // Solves linear system in preparation for update.
     // @j:   column index defining the linear system to be solved.
     //       If j is basic then BTRAN is computed. RHS is the unit vector
@@ -132,6 +140,13 @@ public:
     void SolveForUpdate(Int j, IndexedVector& lhs);
     void SolveForUpdate(Int j);
 
+    // Solves a linear system with the basis matrix and a sparse right-hand
+    // side. The factorization is not prepared for an update.
+    // @rhs: size m vector with known pattern
+    // @lhs: returns the solution
+    // @trans: 't' or 'T' for transposed system
+    void SolveSparse(const IndexedVector& rhs, IndexedVector& lhs, char trans);
+
     // Computes a row of the (simplex) tableau matrix and performs BTRAN in
     // preparation for an update.
     // @jb:    basic variable. When jb is at position p in the basis, then row p
@@ -146,6 +161,13 @@ public:
     void TableauRow(Int jb, IndexedVector& btran, IndexedVector& row,
                     bool ignore_fixed = false);
 
+    // As above, but computes row = AI'*btran for the nonbasic variables from a
+    // given BTRAN solution, which can be a linear combination of rows of the
+    // inverse basis matrix. If the row is dense and the model is large, the
+    // computation is split among OpenMP threads.
+    void TableauRow(const IndexedVector& btran, IndexedVector& row,
+                    bool ignore_fixed = false);
+
     // Exchanges basic variable jb with nonbasic variable jn if the update to
     // the factorization is stable. In detail, the following steps are done:
     //
@@ -230,6 +252,10 @@ private:
     static constexpr double kBasisRepairThreshold = 1e5;
     static constexpr Int kMaxBasisRepair = 200;
 
+    // A dense tableau row is computed in parallel if AI has at least this many
+    // entries.
+    static constexpr Int kParallelMinNonzeros = 20000;
+
     // Adjusts basis_ and map2basis_ after a singular factorization. Must be
     // called exactly once after the factorization. Returns the # slack
     // variables inserted into the basis (0 if the factorization was
@@ -66,7 +66,12 @@ public:
     double ipm_optimality_tol() const { return parameters_.ipm_optimality_tol; }
     double ipm_drop_primal() const { return parameters_.ipm_drop_primal; }
     double ipm_drop_dual() const { return parameters_.ipm_drop_dual; }
+    ipxint ipm_correctors() const { return parameters_.ipm_correctors; }
     double kkt_tol() const { return parameters_.kkt_tol; }
+    ipxint cholesky() const { return parameters_.cholesky; }
+    ipxint kkt_precond() const { return parameters_.kkt_precond; }
+    double ic_droptol() const { return parameters_.ic_droptol; }
+    double ic_fill() const { return parameters_.ic_fill; }
     ipxint crash_basis() const { return parameters_.crash_basis; }
     double dependency_tol() const { return parameters_.dependency_tol; }
     double volume_tol() const { return parameters_.volume_tol; }
@@ -78,6 +83,8 @@ public:
     double crossover_start() const { return parameters_.crossover_start; }
     double pfeasibility_tol() const { return parameters_.pfeasibility_tol; }
     double dfeasibility_tol() const { return parameters_.dfeasibility_tol; }
+    ipxint crossover_batch() const { return parameters_.crossover_batch; }
+    double crossover_handoff() const { return parameters_.crossover_handoff; }
     ipxint switchiter() const { return parameters_.switchiter; }
     ipxint stop_at_switch() const { return parameters_.stop_at_switch; }
     ipxint update_heuristic() const { return parameters_.update_heuristic; }
@@ -10,8 +10,30 @@
 
 namespace ipx {
 
+// The push batch limits are odr-used by std::min() and std::max().
+constexpr Int Crossover::kPushBatchMin;
+constexpr Int Crossover::kPushBatchMax;
+
 Crossover::Crossover(const Control& control) : control_(control) {}
 
+// Returns true if a primal variable needs no push, i.e. it is at a bound or it
+// is free and zero.
+static bool PrimalPushed(double x, double lb, double ub) {
+    return x == lb || x == ub || (x == 0.0 && std::isinf(lb) && std::isinf(ub));
+}
+
+// Returns the value to which a primal variable is pushed. If the variable has
+// two finite bounds, this is the nearer one. If it has none, this is zero.
+static double PrimalPushTarget(double x, double lb, double ub) {
+    if (std::isfinite(lb) && std::isfinite(ub))
+        return x-lb <= ub-x ? lb : ub;
+    if (std::isfinite(lb))
+        return lb;
+    if (std::isfinite(ub))
+        return ub;
+    return 0.0;
+}
+
 void Crossover::PushAll(Basis* basis, Vector& x, Vector& y, Vector& z,
                         const double* weights, Info* info) {
     const Model& model = basis->model();
@@ -38,6 +60,10 @@ void Crossover::PushAll(Basis* basis, Vector& x, Vector& y, Vector& z,
         << Textline("Number of dual pushes required:")
         << dual_superbasics.size() << '\n';
     PushDual(basis, y, z, dual_superbasics, x, info);
+    control_.Debug()
+        << Textline("Dual pushes (batched), pivots, time:")
+        << dual_pushes_ << " (" << dual_pushes_batched_ << "), "
+        << dual_pivots_ << ", " << fix2(time_dual_) << "s\n";
     assert(DualInfeasibility(model, x, z) == 0.0);
     if (info->status_crossover != IPX_STATUS_optimal)
         return;
@@ -55,6 +81,10 @@ void Crossover::PushAll(Basis* basis, Vector& x, Vector& y, Vector& z,
         << Textline("Number of primal pushes required:")
         << primal_superbasics.size() << '\n';
     PushPrimal(basis, x, primal_superbasics, nullptr, info);
+    control_.Debug()
+        << Textline("Primal pushes (batched), pivots, time:")
+        << primal_pushes_ << " (" << primal_pushes_batched_ << "), "
+        << primal_pivots_ << ", " << fix2(time_primal_) << "s\n";
     assert(PrimalInfeasibility(model, x) == 0.0);
     if (info->status_crossover != IPX_STATUS_optimal)
         return;
@@ -76,11 +106,15 @@ void Crossover::PushPrimal(Basis* basis, Vector& x,
     const Int n = model.cols();
     const Vector& lb = model.lb();
     const Vector& ub = model.ub();
-    IndexedVector ftran(m);
+    IndexedVector ftran(m), rhs(m);
+    std::vector<bool> marked(m);
+    std::vector<Int> batch;
+    std::vector<double> target;
     const double feastol = model.dualized() ?
         control_.dfeasibility_tol() : control_.pfeasibility_tol();
     primal_pushes_ = 0;
     primal_pivots_ = 0;
+    primal_pushes_batched_ = 0;
 
     // Check that variables are nonbasic and that x satisfies bound condition.
     for (Int j : variables) {
@@ -111,28 +145,50 @@ void Crossover::PushPrimal(Basis* basis, Vector& x,
         }
     }
 
+    // Variables before position single_until are pushed one at a time.
+    Int batch_size = control_.crossover_batch() > 0 ? kPushBatchMin : 0;
+    Int single_until = 0;
+
     control_.ResetPrintInterval();
     Int next = 0;
     while (next < (Int) variables.size()) {
         if ((info->errflag = control_.InterruptCheck()) != 0)
             break;
 
+        if (batch_size > 0 && next >= single_until) {
+            batch.clear();
+            target.clear();
+            Int end = next;
+            while (end < (Int) variables.size() &&
+                   (Int) batch.size() < batch_size) {
+                const Int j = variables[end++];
+                if (!PrimalPushed(x[j], lb[j], ub[j])) {
+                    batch.push_back(j);
+                    target.push_back(PrimalPushTarget(x[j], lb[j], ub[j]));
+                }
+            }
+            if (batch.size() > 1) {
+                if (PushPrimalBatch(basis, x, xbasic, lbbasic, ubbasic, batch,
+                                    target, feastol, rhs, ftran, marked)) {
+                    primal_pushes_ += batch.size();
+                    primal_pushes_batched_ += batch.size();
+                    next = end;
+                    batch_size = std::min(2*batch_size, kPushBatchMax);
+                    continue;
+                }
+                batch_size = std::max(batch_size/2, kPushBatchMin);
+            }
+            single_until = end;
+        }
+
         const Int jn = variables[next];
-        if (x[jn] == lb[jn] || x[jn] == ub[jn] ||
-            (x[jn] == 0.0 && std::isinf(lb[jn]) && std::isinf(ub[jn]))) {
+        if (PrimalPushed(x[jn], lb[jn], ub[jn])) {
             // nothing to do
             next++;
             continue;
         }
-        // Choose bound to push to. If the variable has two finite bounds, move
-        // to the nearer. If it has none, move to zero.
-        double move_to = 0.0;
-        if (std::isfinite(lb[jn]) && std::isfinite(ub[jn]))
-            move_to = x[jn]-lb[jn] <= ub[jn]-x[jn] ? lb[jn] : ub[jn];
-        else if (std::isfinite(lb[jn]))
-            move_to = lb[jn];
-        else if (std::isfinite(ub[jn]))
-            move_to = ub[jn];
+        // Choose bound to push to.
+        const double move_to = PrimalPushTarget(x[jn], lb[jn], ub[jn]);
 
         // A full step is such that x[jn]-step is at its bound.
         double step = x[jn]-move_to;
@@ -230,11 +286,13 @@ void Crossover::PushDual(Basis* basis, Vector& y, Vector& z,
     const Model& model = basis->model();
     const Int m = model.rows();
     const Int n = model.cols();
-    IndexedVector btran(m), row(n+m);
+    IndexedVector btran(m), row(n+m), rhs(m);
+    std::vector<Int> batch;
     const double feastol = model.dualized() ?
         control_.pfeasibility_tol() : control_.dfeasibility_tol();
     dual_pushes_ = 0;
     dual_pivots_ = 0;
+    dual_pushes_batched_ = 0;
 
     // Check that variables are basic and that z satisfies sign condition.
     for (Int j : variables) {
@@ -248,12 +306,39 @@ void Crossover::PushDual(Basis* basis, Vector& y, Vector& z,
                 "sign condition violated in Crossover::PushDual");
     }
 
+    // Variables before position single_until are pushed one at a time.
+    Int batch_size = control_.crossover_batch() > 0 ? kPushBatchMin : 0;
+    Int single_until = 0;
+
     control_.ResetPrintInterval();
     Int next = 0;
     while (next < (Int) variables.size()) {
         if ((info->errflag = control_.InterruptCheck()) != 0)
             break;
 
+        if (batch_size > 0 && next >= single_until) {
+            batch.clear();
+            Int end = next;
+            while (end < (Int) variables.size() &&
+                   (Int) batch.size() < batch_size) {
+                const Int j = variables[end++];
+                if (z[j] != 0.0)
+                    batch.push_back(j);
+            }
+            if (batch.size() > 1) {
+                if (PushDualBatch(basis, y, z, batch, sign_restrict, feastol,
+                                  rhs, btran, row)) {
+                    dual_pushes_ += batch.size();
+                    dual_pushes_batched_ += batch.size();
+                    next = end;
+                    batch_size = std::min(2*batch_size, kPushBatchMax);
+                    continue;
+                }
+                batch_size = std::max(batch_size/2, kPushBatchMin);
+            }
+            single_until = end;
+        }
+
         const Int jb = variables[next];
         if (z[jb] == 0.0) {
             // nothing to do
@@ -353,6 +438,105 @@ void Crossover::PushDual(Basis* basis, Vector& y, Vector& z,
     PushDual(basis, y, z, variables, sign_restrict.data(), info);
 }
 
+bool Crossover::PushPrimalBatch(Basis* basis, Vector& x, Vector& xbasic,
+                                const Vector& lbbasic, const Vector& ubbasic,
+                                const std::vector<Int>& batch,
+                                const std::vector<double>& target,
+                                double feastol, IndexedVector& rhs,
+                                IndexedVector& ftran,
+                                std::vector<bool>& marked) {
+    const SparseMatrix& AI = basis->model().AI();
+    const Int* Ai = AI.rowidx();
+    const double* Ax = AI.values();
+
+    // Build rhs = sum of (x[j]-target)*AI[:,j] over the batch.
+    rhs.set_to_zero();
+    Int* pattern = rhs.pattern();
+    Int nz = 0;
+    for (Int k = 0; k < (Int) batch.size(); k++) {
+        const Int j = batch[k];
+        const double step = x[j]-target[k];
+        for (Int p = AI.begin(j); p < AI.end(j); p++) {
+            const Int i = Ai[p];
+            if (!marked[i]) {
+                marked[i] = true;
+                pattern[nz++] = i;
+            }
+            rhs[i] += step * Ax[p];
+        }
+    }
+    rhs.set_nnz(nz);
+    for (Int k = 0; k < nz; k++)
+        marked[pattern[k]] = false;
+    basis->SolveSparse(rhs, ftran, 'N');
+
+    bool feasible = true;
+    auto check = [&](Int p, double delta) {
+        if (xbasic[p] + delta < lbbasic[p]-feastol ||
+            xbasic[p] + delta > ubbasic[p]+feastol)
+            feasible = false;
+    };
+    for_each_nonzero(ftran, check);
+    if (!feasible)
+        return false;
+
+    auto update = [&](Int p, double delta) {
+        xbasic[p] += delta;
+        xbasic[p] = std::max(xbasic[p], lbbasic[p]);
+        xbasic[p] = std::min(xbasic[p], ubbasic[p]);
+    };
+    for_each_nonzero(ftran, update);
+    for (Int k = 0; k < (Int) batch.size(); k++)
+        x[batch[k]] = target[k];
+    return true;
+}
+
+bool Crossover::PushDualBatch(Basis* basis, Vector& y, Vector& z,
+                              const std::vector<Int>& batch,
+                              const int sign_restrict[], double feastol,
+                              IndexedVector& rhs, IndexedVector& btran,
+                              IndexedVector& row) {
+    // Build rhs = sum of z[jb]*e_p over the batch, where p is the position of
+    // jb in the basis.
+    rhs.set_to_zero();
+    Int* pattern = rhs.pattern();
+    Int nz = 0;
+    for (Int jb : batch) {
+        const Int p = basis->PositionOf(jb);
+        rhs[p] = z[jb];
+        pattern[nz++] = p;
+    }
+    rhs.set_nnz(nz);
+    basis->SolveSparse(rhs, btran, 'T');
+    basis->TableauRow(btran, row);
+
+    bool feasible = true;
+    auto check = [&](Int j, double pivot) {
+        if (((sign_restrict[j] & 1) && z[j]-pivot < -feastol) ||
+            ((sign_restrict[j] & 2) && z[j]-pivot > feastol))
+            feasible = false;
+    };
+    for_each_nonzero(row, check);
+    if (!feasible)
+        return false;
+
+    auto update_y = [&](Int i, double x) {
+        y[i] += x;
+    };
+    for_each_nonzero(btran, update_y);
+    auto update_z = [&](Int j, double pivot) {
+        z[j] -= pivot;
+        if (sign_restrict[j] & 1)
+            z[j] = std::max(z[j], 0.0);
+        if (sign_restrict[j] & 2)
+            z[j] = std::min(z[j], 0.0);
+    };
+    for_each_nonzero(row, update_z);
+    for (Int jb : batch)
+        z[jb] = 0.0;
+    return true;
+}
+
 Int Crossover::PrimalRatioTest(const Vector& xbasic, const IndexedVector& ftran,
                                const Vector& lbbasic, const Vector& ubbasic,
                                double step, double feastol, bool* block_at_lb) {
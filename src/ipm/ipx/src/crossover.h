@@ -32,6 +32,14 @@
 // jb reaches zero, then the push is complete. Otherwise a nonbasic variable jn
 // became zero and blocked the step. In this case a basis update exchanges jb by
 // jn.
+//
+// Most pushes are not blocked. Therefore both phases first try to push a batch
+// of consecutive variables at once, which requires a single FTRAN or BTRAN
+// with the combined right-hand side. The batch is accepted if no variable
+// leaves its bounds (up to the feasibility tolerance). Otherwise the variables
+// of the batch are pushed one at a time. The batch size is doubled after each
+// accepted batch and halved after each rejected one. A rejected batch costs
+// one extra solve, but no basis update.
 
 #include <vector>
 #include "basis.h"
@@ -126,6 +134,11 @@ public:
     Int primal_pivots() const { return primal_pivots_; }
     Int dual_pivots() const { return dual_pivots_; }
 
+    // Number of pushes done in batches in last call to PushPrimal() and
+    // PushDual().
+    Int primal_pushes_batched() const { return primal_pushes_batched_; }
+    Int dual_pushes_batched() const { return dual_pushes_batched_; }
+
     // Runtime of last call to PushPrimal() and PushDual().
     double time_primal() const { return time_primal_; }
     double time_dual() const { return time_dual_; }
@@ -135,6 +148,29 @@ private:
     // larger than kPivotZeroTol in absolute value.
     static constexpr double kPivotZeroTol = 1e-5;
 
+    // Range of the # variables pushed in a batch.
+    static constexpr Int kPushBatchMin = 4;
+    static constexpr Int kPushBatchMax = 1024;
+
+    // Pushes the primal variables in @batch to the bounds given in @target at
+    // once if the basic variables remain within their bounds. Returns true if
+    // the pushes were done. @rhs, @ftran and @marked are workspace.
+    bool PushPrimalBatch(Basis* basis, Vector& x, Vector& xbasic,
+                         const Vector& lbbasic, const Vector& ubbasic,
+                         const std::vector<Int>& batch,
+                         const std::vector<double>& target, double feastol,
+                         IndexedVector& rhs, IndexedVector& ftran,
+                         std::vector<bool>& marked);
+
+    // Pushes the dual variables in @batch to zero at once if the nonbasic dual
+    // variables remain within their sign restrictions. Returns true if the
+    // pushes were done. @rhs, @btran and @row are workspace.
+    bool PushDualBatch(Basis* basis, Vector& y, Vector& z,
+                       const std::vector<Int>& batch,
+                       const int sign_restrict[], double feastol,
+                       IndexedVector& rhs, IndexedVector& btran,
+                       IndexedVector& row);
+
     // Two-pass ratio tests that allow infeasibilities up to feastol in order
     // to choose a larger pivot.
     Int PrimalRatioTest(const Vector& xbasic, const IndexedVector& ftran,
@@ -150,6 +186,8 @@ private:
     Int dual_pushes_{0};
     Int primal_pivots_{0};
     Int dual_pivots_{0};
+    Int primal_pushes_batched_{0};
+    Int dual_pushes_batched_{0};
     double time_primal_{0.0};
     double time_dual_{0.0};
 };
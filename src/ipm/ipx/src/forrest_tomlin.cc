@@ -77,6 +77,27 @@ void ForrestTomlin::_SolveDense(const Vector& rhs, Vector& lhs, char trans) {
     }
 }
 
+void ForrestTomlin::_SolveDense(Int nrhs, const double* rhs, double* lhs,
+                                char trans) {
+    Vector x(dim_);
+    for (Int k = 0; k < nrhs; k++) {
+        std::copy_n(rhs + k*dim_, dim_, &x[0]);
+        _SolveDense(x, x, trans);
+        std::copy_n(&x[0], dim_, lhs + k*dim_);
+    }
+}
+
+void ForrestTomlin::_SolveSparse(Int nz, const Int* bi, const double* bx,
+                                 IndexedVector& lhs, char trans) {
+    Vector rhs(dim_);
+    for (Int k = 0; k < nz; k++)
+        rhs[bi[k]] = bx[k];
+    _SolveDense(rhs, rhs, trans);
+    for (Int p = 0; p < dim_; p++)
+        lhs[p] = rhs[p];
+    lhs.InvalidatePattern();
+}
+
 void ForrestTomlin::_FtranForUpdate(Int nz, const Int* bi, const double* bx) {
     ComputeSpike(nz, bi, bx);
 }
@@ -39,6 +39,10 @@ private:
     void _GetFactors(SparseMatrix* L, SparseMatrix* U, Int* rowperm,
                      Int* colperm, std::vector<Int>* dependent_cols) override;
     void _SolveDense(const Vector& rhs, Vector& lhs, char trans) override;
+    void _SolveDense(Int nrhs, const double* rhs, double* lhs,
+                     char trans) override;
+    void _SolveSparse(Int nz, const Int* bi, const double* bx,
+                      IndexedVector& lhs, char trans) override;
     void _FtranForUpdate(Int nz, const Int* bi, const double* bx) override;
     void _FtranForUpdate(Int nz, const Int* bi, const double* bx,
                          IndexedVector& lhs) override;
@@ -0,0 +1,252 @@
+// Copyright (c) 2018-2019 ERGO-Code. See license.txt for license.
+
+#include "incomplete_cholesky.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include "timer.h"
+#include "utils.h"
+
+namespace ipx {
+
+// IncompleteCholesky::kShiftInit is odr-used by std::max().
+constexpr double IncompleteCholesky::kShiftInit;
+
+IncompleteCholesky::IncompleteCholesky(const Model& model, double droptol,
+                                       double fill, bool block_jacobi) :
+    model_(model), droptol_(droptol), fill_(fill) {
+    const Int m = model_.rows();
+    block_.assign(m, 0);
+    if (block_jacobi)
+        ComputeBlocks();
+    diag_.resize(m);
+    sqrt_diag_.resize(m);
+}
+
+void IncompleteCholesky::ComputeBlocks() {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    const SparseMatrix& AI = model_.AI();
+    const SparseMatrix& AIt = model_.AIt();
+
+    // Classify linking rows by their # entries in structural columns.
+    std::vector<Int> rowcount(m, 0);
+    for (Int j = 0; j < n; j++)
+        for (Int p = AI.begin(j); p < AI.end(j); p++)
+            rowcount[AI.index(p)]++;
+    const double min_linking = kLinkingRowFactor * AI.begin(n) / m;
+    std::vector<char> linking(m, 0);
+    Int num_linking = 0;
+    for (Int i = 0; i < m; i++) {
+        if (rowcount[i] >= min_linking) {
+            linking[i] = 1;
+            num_linking++;
+        }
+    }
+
+    // Connected components of the graph of (1) without the linking rows. A
+    // column that has been visited connects no further rows.
+    std::fill(block_.begin(), block_.end(), -1);
+    std::vector<char> col_visited(n, 0);
+    std::vector<Int> stack;
+    num_blocks_ = 0;
+    for (Int root = 0; root < m; root++) {
+        if (linking[root] || block_[root] >= 0)
+            continue;
+        block_[root] = num_blocks_;
+        stack.push_back(root);
+        while (!stack.empty()) {
+            Int i = stack.back();
+            stack.pop_back();
+            for (Int p = AIt.begin(i); p < AIt.end(i); p++) {
+                Int j = AIt.index(p);
+                if (j >= n || col_visited[j] || model_.IsDenseColumn(j))
+                    continue;
+                col_visited[j] = 1;
+                for (Int q = AI.begin(j); q < AI.end(j); q++) {
+                    Int r = AI.index(q);
+                    if (!linking[r] && block_[r] < 0) {
+                        block_[r] = num_blocks_;
+                        stack.push_back(r);
+                    }
+                }
+            }
+        }
+        num_blocks_++;
+    }
+    if (num_linking > 0) {
+        for (Int i = 0; i < m; i++)
+            if (linking[i])
+                block_[i] = num_blocks_;
+        num_blocks_++;
+    }
+}
+
+void IncompleteCholesky::Factorize(const double* W, Info* info) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    const SparseMatrix& AI = model_.AI();
+
+    factorized_ = false;
+
+    // Build diagonal of (1).
+    diag_ = 0.0;
+    for (Int j = 0; j < n+m; j++) {
+        if (model_.IsDenseColumn(j))
+            continue;
+        double w = W ? W[j] : j < n ? 1.0 : 0.0;
+        for (Int p = AI.begin(j); p < AI.end(j); p++)
+            diag_[AI.index(p)] += AI.value(p) * w * AI.value(p);
+    }
+    for (Int i = 0; i < m; i++) {
+        if (!(diag_[i] > 0.0))
+            diag_[i] = 1.0;     // row has only dense columns
+        sqrt_diag_[i] = std::sqrt(diag_[i]);
+    }
+
+    // Start from half the shift of the previous factorization, which usually
+    // saves restarts because W changes gradually between IPM iterations.
+    double shift = shift_ >= 2.0*kShiftInit ? 0.5*shift_ : 0.0;
+    Int num_shifts = 0;
+    while (!FactorizeShifted(W, shift)) {
+        if (++num_shifts > kMaxShifts) {
+            L_.resize(m, 0);
+            for (Int i = 0; i < m; i++) {
+                L_.push_back(i, sqrt_diag_[i]);
+                L_.add_column();
+            }
+            break;
+        }
+        shift = std::max(2.0*shift, kShiftInit);
+    }
+    shift_ = shift;
+    info->ic_shifts += num_shifts;
+    factorized_ = true;
+}
+
+bool IncompleteCholesky::FactorizeShifted(const double* W, double shift) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    const SparseMatrix& AI = model_.AI();
+    const SparseMatrix& AIt = model_.AIt();
+
+    // Column j of L is linked into the list of row i = L_.index(first[j]),
+    // which is the next row in which it updates a column.
+    std::vector<Int> first(m), head(m, -1), next(m, -1);
+    std::vector<Int> mark(m, -1), pattern, kept;
+    Vector work(m);
+
+    L_.resize(m, 0);
+    for (Int k = 0; k < m; k++) {
+        // Scatter the off-diagonal entries of column k of (1) in rows of the
+        // same block.
+        pattern.clear();
+        mark[k] = k;
+        for (Int p = AIt.begin(k); p < AIt.end(k); p++) {
+            Int j = AIt.index(p);
+            if (model_.IsDenseColumn(j))
+                continue;
+            double w = W ? W[j] : j < n ? 1.0 : 0.0;
+            if (w == 0.0)
+                continue;
+            double akj = AIt.value(p) * w;
+            for (Int q = AI.begin(j); q < AI.end(j); q++) {
+                Int i = AI.index(q);
+                if (i <= k || block_[i] != block_[k])
+                    continue;
+                if (mark[i] != k) {
+                    mark[i] = k;
+                    pattern.push_back(i);
+                }
+                work[i] += akj * AI.value(q);
+            }
+        }
+        const Int nz_normal = pattern.size();
+
+        // Subtract the updates from all columns j < k with l_kj != 0.
+        double pivot = (1.0+shift) * diag_[k];
+        for (Int j = head[k]; j >= 0; ) {
+            const Int jnext = next[j];
+            const Int pos = first[j];
+            const double lkj = L_.value(pos);
+            pivot -= lkj * lkj;
+            for (Int q = pos+1; q < L_.end(j); q++) {
+                Int i = L_.index(q);
+                if (mark[i] != k) {
+                    mark[i] = k;
+                    pattern.push_back(i);
+                }
+                work[i] -= L_.value(q) * lkj;
+            }
+            if (++first[j] < L_.end(j)) {
+                Int i = L_.index(first[j]);
+                next[j] = head[i];
+                head[i] = j;
+            }
+            j = jnext;
+        }
+        if (!(pivot > 0.0)) {
+            for (Int i : pattern)
+                work[i] = 0.0;
+            return false;
+        }
+        const double lkk = std::sqrt(pivot);
+
+        // Drop small entries and keep at most fill_*nz_normal of the others.
+        // Entry i of column k of L is work[i]/lkk.
+        kept.clear();
+        const double drop_scale = droptol_ * sqrt_diag_[k] * lkk;
+        for (Int i : pattern) {
+            if (std::abs(work[i]) >= drop_scale * sqrt_diag_[i])
+                kept.push_back(i);
+        }
+        const Int max_kept = static_cast<Int>(fill_ * nz_normal);
+        if ((Int) kept.size() > max_kept) {
+            auto larger = [&work](Int i1, Int i2) {
+                return std::abs(work[i1]) > std::abs(work[i2]);
+            };
+            std::nth_element(kept.begin(), kept.begin()+max_kept, kept.end(),
+                             larger);
+            kept.resize(max_kept);
+        }
+        std::sort(kept.begin(), kept.end());
+        L_.push_back(k, lkk);
+        for (Int i : kept)
+            L_.push_back(i, work[i] / lkk);
+        L_.add_column();
+        for (Int i : pattern)
+            work[i] = 0.0;
+        if (!kept.empty()) {
+            first[k] = L_.begin(k) + 1;
+            next[k] = head[kept[0]];
+            head[kept[0]] = k;
+        }
+    }
+    return true;
+}
+
+double IncompleteCholesky::time() const {
+    return time_;
+}
+
+void IncompleteCholesky::reset_time() {
+    time_ = 0.0;
+}
+
+void IncompleteCholesky::_Apply(const Vector& rhs, Vector& lhs,
+                                double* rhs_dot_lhs) {
+    Timer timer;
+
+    assert(factorized_);
+    assert((Int)lhs.size() == model_.rows());
+    assert((Int)rhs.size() == model_.rows());
+
+    lhs = rhs;
+    TriangularSolve(L_, lhs, 'n', "lower", 0);
+    TriangularSolve(L_, lhs, 't', "lower", 0);
+    if (rhs_dot_lhs)
+        *rhs_dot_lhs = Dot(rhs, lhs);
+    time_ += timer.Elapsed();
+}
+
+}  // namespace ipx
@@ -0,0 +1,98 @@
+// Copyright (c) 2018-2019 ERGO-Code. See license.txt for license.
+
+#ifndef IPX_INCOMPLETE_CHOLESKY_H_
+#define IPX_INCOMPLETE_CHOLESKY_H_
+
+#include <vector>
+#include "linear_operator.h"
+#include "model.h"
+#include "sparse_matrix.h"
+
+namespace ipx {
+
+// IncompleteCholesky provides inverse operations with an incomplete Cholesky
+// factorization L*L' of the matrix
+//
+//   AI*W*AI' - sum_{j dense} W[j]*AI[:,j]*AI[:,j]',                (1)
+//
+// which is the normal matrix without the columns that the model classifies as
+// dense. Here AI is the m-by-(n+m) matrix defined by the model, and W is a
+// diagonal (weight) matrix provided by the user.
+//
+// The factorization is left-looking in the natural row order. In column k of
+// L an entry l_ik is dropped if |l_ik| < droptol * sqrt(d_i*d_k), where d is
+// the diagonal of (1). Of the remaining entries at most fill times the #
+// off-diagonal entries in column k of (1) are kept, choosing the largest in
+// absolute value. If a pivot becomes nonpositive, the factorization is
+// restarted with a shift alpha*diag(d) added to (1) [1].
+//
+// In the block-Jacobi variant the entries of (1) that couple different row
+// blocks are ignored. The blocks are the connected components of the graph of
+// (1) without the linking rows, i.e. rows with many more entries than the
+// average row of AI. All linking rows form one more block. For an LP in block
+// angular form the blocks are the subproblems; for an LP without block
+// structure there is one block and the variant is the same as the plain
+// factorization.
+//
+// [1] C.-J. Lin and J. J. More, "Incomplete Cholesky factorizations with
+//     limited memory", SIAM J. Sci. Comput., 21 (1999).
+
+class IncompleteCholesky : public LinearOperator {
+public:
+    // Constructor stores a reference to the model and, in the block-Jacobi
+    // variant, computes the row blocks. The model must be valid as long as the
+    // object is used.
+    IncompleteCholesky(const Model& model, double droptol, double fill,
+                       bool block_jacobi);
+
+    // Factorizes (1). W must either hold n+m entries, or be NULL, in which
+    // case the first n entries are assumed 1.0 and the last m entries are
+    // assumed 0.0. The # restarts with a larger shift is added to
+    // info->ic_shifts.
+    void Factorize(const double* W, Info* info);
+
+    // Returns the # entries in L (including the diagonal).
+    Int nonzeros() const { return L_.entries(); }
+
+    // Returns the # row blocks.
+    Int blocks() const { return num_blocks_; }
+
+    // Returns computation time for calls to Apply() since last reset_time().
+    double time() const;
+    void reset_time();
+
+private:
+    // A row is linking if it has at least kLinkingRowFactor times as many
+    // entries in structural columns as the average row.
+    static constexpr double kLinkingRowFactor = 10.0;
+
+    // The first shift is kShiftInit; it is doubled after each breakdown. After
+    // kMaxShifts breakdowns L is the square root of the diagonal of (1).
+    static constexpr double kShiftInit = 1e-3;
+    static constexpr Int kMaxShifts = 20;
+
+    void _Apply(const Vector& rhs, Vector& lhs, double* rhs_dot_lhs) override;
+
+    void ComputeBlocks();
+    // Computes the factorization of (1) plus shift*diag(d). Returns false if a
+    // nonpositive pivot occured.
+    bool FactorizeShifted(const double* W, double shift);
+
+    const Model& model_;
+    const double droptol_;
+    const double fill_;
+    bool factorized_{false};
+    double shift_{0.0};         // shift in last factorization
+    double time_{0.0};
+
+    std::vector<Int> block_;    // block of each row
+    Int num_blocks_{1};
+
+    Vector diag_;               // diagonal of (1)
+    Vector sqrt_diag_;
+    SparseMatrix L_;            // diagonal entry first in each column
+};
+
+}  // namespace ipx
+
+#endif  // IPX_INCOMPLETE_CHOLESKY_H_
@@ -60,17 +60,24 @@ std::ostream& operator<<(std::ostream& os, const Info& info) {
     dump(os, "iter", info.iter);
     dump(os, "kktiter1", info.kktiter1);
     dump(os, "kktiter2", info.kktiter2);
+    dump(os, "correctors", info.correctors);
+    dump(os, "correctors_iter_saved", fix2(info.correctors_iter_saved));
     dump(os, "basis_repairs", info.basis_repairs);
     dump(os, "updates_start", info.updates_start);
     dump(os, "updates_ipm", info.updates_ipm);
     dump(os, "updates_crossover", info.updates_crossover);
     dump(os, "pushes_crossover", info.pushes_crossover);
+    dump(os, "pushes_batched_crossover", info.pushes_batched_crossover);
+    dump(os, "superbasics_crossover", info.superbasics_crossover);
+    dump(os, "handoff_crossover", info.handoff_crossover);
 
     dump(os, "time_total", fix2(info.time_total));
     dump(os, "time_ipm1", fix2(info.time_ipm1));
     dump(os, "time_ipm2", fix2(info.time_ipm2));
     dump(os, "time_starting_basis", fix2(info.time_starting_basis));
     dump(os, "time_crossover", fix2(info.time_crossover));
+    dump(os, "time_crossover_primal", fix2(info.time_crossover_primal));
+    dump(os, "time_crossover_dual", fix2(info.time_crossover_dual));
 
     dump(os, "time_kkt_factorize", fix2(info.time_kkt_factorize));
     dump(os, "time_kkt_solve", fix2(info.time_kkt_solve));
@@ -82,6 +89,13 @@ std::ostream& operator<<(std::ostream& os, const Info& info) {
     dump(os, "time_cr2_NNt", fix2(info.time_cr2_NNt));
     dump(os, "time_cr2_B", fix2(info.time_cr2_B));
     dump(os, "time_cr2_Bt", fix2(info.time_cr2_Bt));
+    dump(os, "chol_nnz", info.chol_nnz);
+    dump(os, "chol_dropped", info.chol_dropped);
+    dump(os, "time_chol_analyse", fix2(info.time_chol_analyse));
+    dump(os, "time_chol_factorize", fix2(info.time_chol_factorize));
+    dump(os, "ic_nnz", info.ic_nnz);
+    dump(os, "ic_blocks", info.ic_blocks);
+    dump(os, "ic_shifts", info.ic_shifts);
 
     dump(os, "ftran_sparse", fix2(info.ftran_sparse));
     dump(os, "btran_sparse", fix2(info.btran_sparse));
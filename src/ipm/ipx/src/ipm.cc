@@ -10,6 +10,10 @@
 
 namespace ipx {
 
+// IPM::kWarmStartMinMu is odr-used because std::max() takes references as
+// arguments. Hence we require a namespace scope definition.
+constexpr double IPM::kWarmStartMinMu;
+
 struct IPM::Step {
     Step(Int m, Int n) : x(n+m), xl(n+m), xu(n+m), y(m), zl(n+m), zu(n+m) {}
     Vector x, xl, xu, y, zl, zu;
@@ -28,6 +32,8 @@ void IPM::StartingPoint(KKTSolver* kkt, Iterate* iterate, Info* info) {
     info_ = info;
     PrintHeader();
     ComputeStartingPoint();
+    mu_start_ = iterate->mu();
+    warm_iterate_.reset();
     if (info->errflag == 0)
         PrintOutput();
     // Set status_ipm.
@@ -41,6 +47,67 @@ void IPM::StartingPoint(KKTSolver* kkt, Iterate* iterate, Info* info) {
     }
 }
 
+void IPM::WarmStartingPoint(const Vector& x, const Vector& y,
+                            const Vector& z, Iterate* iterate, Info* info) {
+    const Model& model = iterate->model();
+    const Int m = model.rows();
+    const Int n = model.cols();
+    const Vector& lb = model.lb();
+    const Vector& ub = model.ub();
+    Vector xl(n+m), xu(n+m), zl(n+m), zu(n+m);
+    kkt_ = nullptr;
+    iterate_ = iterate;
+    info_ = info;
+    PrintHeader();
+
+    // Split z into its parts at the lower and upper bound and move the point
+    // within the bounds, which may have changed since it was computed.
+    double mu = 0.0;
+    Int num_finite = 0;
+    for (Int j = 0; j < n+m; j++) {
+        if (std::isfinite(lb[j])) {
+            xl[j] = std::max(x[j]-lb[j], 0.0);
+            zl[j] = std::max(z[j], 0.0);
+            mu += xl[j]*zl[j];
+            num_finite++;
+        } else {
+            xl[j] = INFINITY;
+            zl[j] = 0.0;
+        }
+        if (std::isfinite(ub[j])) {
+            xu[j] = std::max(ub[j]-x[j], 0.0);
+            zu[j] = std::max(-z[j], 0.0);
+            mu += xu[j]*zu[j];
+            num_finite++;
+        } else {
+            xu[j] = INFINITY;
+            zu[j] = 0.0;
+        }
+    }
+    if (num_finite > 0)
+        mu /= num_finite;
+    mu = std::max(mu, kWarmStartMinMu);
+
+    // Shift each barrier pair by sqrt(mu), which makes its complementarity
+    // product at least mu.
+    const double shift = std::sqrt(mu);
+    for (Int j = 0; j < n+m; j++) {
+        if (std::isfinite(lb[j])) {
+            xl[j] += shift;
+            zl[j] += shift;
+        }
+        if (std::isfinite(ub[j])) {
+            xu[j] += shift;
+            zu[j] += shift;
+        }
+    }
+    iterate->Initialize(x, xl, xu, y, zl, zu);
+    mu_start_ = iterate->mu();
+    warm_iterate_.reset();
+    PrintOutput();
+    info->status_ipm = IPX_STATUS_not_run;
+}
+
 void IPM::Driver(KKTSolver* kkt, Iterate* iterate, Info* info) {
     const Model& model = iterate->model();
     const Int m = model.rows();
@@ -50,6 +117,9 @@ void IPM::Driver(KKTSolver* kkt, Iterate* iterate, Info* info) {
     iterate_ = iterate;
     info_ = info;
     num_bad_iter_ = 0;
+    steplog_mehrotra_ = 0.0;
+    steplog_corrected_ = 0.0;
+    const Int iter_start = info->iter;
 
     while (true) {
         if (iterate->term_crit_reached()) {
@@ -73,11 +143,24 @@ void IPM::Driver(KKTSolver* kkt, Iterate* iterate, Info* info) {
         if (info->errflag)
             break;
         AddCorrector(step);
+        if (info->errflag)
+            break;
+        AddCentralityCorrectors(step, MaxCorrectors());
         if (info->errflag)
             break;
         MakeStep(step);
         info->iter++;
         PrintOutput();
+        if (!warm_iterate_ && iterate->mu() <= kWarmStartSaveMu*mu_start_)
+            warm_iterate_.reset(new Iterate(*iterate));
+    }
+
+    // Estimate the # iterations that would have been required without
+    // centrality correctors from the reduction in complementarity, which is
+    // about the factor (1-alpha) per iteration.
+    if (steplog_mehrotra_ > 0.0) {
+        info->correctors_iter_saved += (info->iter-iter_start) *
+            (steplog_corrected_/steplog_mehrotra_ - 1.0);
     }
 
     // Set status_ipm if errflag terminated IPM.
@@ -322,6 +405,7 @@ void IPM::AddCorrector(Step& step) {
     muaff /= num_finite;
     double ratio = muaff / mu;
     double sigma = ratio * ratio * ratio;
+    sigma_ = sigma;
 
     // sl = -xl.*zl + sigma*mu - dxl.*dzl
     Vector sl(n+m);
@@ -346,6 +430,101 @@ void IPM::AddCorrector(Step& step) {
                       step);
 }
 
+// The # correctors depends on the ratio of the cost of a factorization to the
+// cost of a solve as suggested in [2].
+Int IPM::MaxCorrectors() const {
+    if (control_.ipm_correctors() >= 0)
+        return control_.ipm_correctors();
+    // Predictor and corrector have solved two linear systems.
+    const double solve_cost = std::max(0.5 * kkt_->iter(), 1.0);
+    const double ratio = kkt_->factorize_cost() / solve_cost;
+    if (ratio <= 2.0)
+        return 0;
+    if (ratio <= 10.0)
+        return 1;
+    if (ratio <= 30.0)
+        return 2;
+    if (ratio <= 50.0)
+        return 3;
+    return 4;
+}
+
+// Computes up to @max_correctors centrality correctors and adds them to
+// @step as long as they increase the step sizes sufficiently. A corrector
+// solves the Newton system with zero residuals and complementarity targets
+// that bring the products at the trial point (with increased step sizes)
+// into a neighborhood of sigma*mu [2].
+void IPM::AddCentralityCorrectors(Step& step, Int max_correctors) {
+    const Model& model = iterate_->model();
+    const Int m = model.rows();
+    const Int n = model.cols();
+    const Vector& xl = iterate_->xl();
+    const Vector& xu = iterate_->xu();
+    const Vector& zl = iterate_->zl();
+    const Vector& zu = iterate_->zu();
+    const double mutarget = sigma_ * iterate_->mu();
+    const double vmin = kCorrectorBetaMin * mutarget;
+    const double vmax = kCorrectorBetaMax * mutarget;
+
+    auto max_steps = [&](const Step& s, double& alphap, double& alphad) {
+        alphap = std::min(StepToBoundary(xl, s.xl, nullptr),
+                          StepToBoundary(xu, s.xu, nullptr));
+        alphad = std::min(StepToBoundary(zl, s.zl, nullptr),
+                          StepToBoundary(zu, s.zu, nullptr));
+    };
+    // Returns the component of the corrector right-hand side for a pair with
+    // complementarity product v at the trial point.
+    auto target = [&](double v) {
+        if (v < vmin)
+            return vmin-v;
+        if (v > vmax)
+            return std::max(vmax-v, -vmax);
+        return 0.0;
+    };
+
+    double alphap, alphad;
+    max_steps(step, alphap, alphad);
+    const double alpha_mehrotra = std::min(alphap, alphad);
+
+    Step corrector(m, n), trial(m, n);
+    Vector sl(n+m), su(n+m);
+    for (Int k = 0; k < max_correctors; k++) {
+        if (std::min(alphap, alphad) >= 1.0)
+            break;
+        const double ap = std::min(alphap + kCorrectorStepIncrease, 1.0);
+        const double ad = std::min(alphad + kCorrectorStepIncrease, 1.0);
+        for (Int j = 0; j < n+m; j++) {
+            sl[j] = 0.0;
+            su[j] = 0.0;
+            if (iterate_->has_barrier_lb(j))
+                sl[j] = target((xl[j]+ap*step.xl[j]) * (zl[j]+ad*step.zl[j]));
+            if (iterate_->has_barrier_ub(j))
+                su[j] = target((xu[j]+ap*step.xu[j]) * (zu[j]+ad*step.zu[j]));
+        }
+        assert(AllFinite(sl));
+        assert(AllFinite(su));
+        SolveNewtonSystem(nullptr, nullptr, nullptr, nullptr, &sl[0], &su[0],
+                          corrector);
+        if (info_->errflag)
+            return;
+        trial = step;
+        trial += corrector;
+        double trialp, triald;
+        max_steps(trial, trialp, triald);
+        if (std::min(trialp, triald) < std::min(alphap, alphad) +
+            kCorrectorMinGain * kCorrectorStepIncrease)
+            break;
+        std::swap(step, trial);
+        alphap = trialp;
+        alphad = triald;
+        info_->correctors++;
+    }
+
+    const double alpha_corrected = std::min(alphap, alphad);
+    steplog_mehrotra_ -= std::log1p(-std::min(alpha_mehrotra, 0.99));
+    steplog_corrected_ -= std::log1p(-std::min(alpha_corrected, 0.99));
+}
+
 void IPM::StepSizes(const Step& step) {
     const Model& model = iterate_->model();
     const Int m = model.rows();
@@ -585,13 +764,13 @@ void IPM::PrintOutput() {
         << "  " << Fixed(control_.Elapsed(), 6, 0) << "s";
     control_.Debug()
         << "  " << Fixed(step_primal_, 4, 2) << " " << Fixed(step_dual_, 4, 2)
-        << "  " << Format(kkt_->basis_changes(), 7)
-        << " "  << Format(kkt_->iter(), 7);
+        << "  " << Format(kkt_ ? kkt_->basis_changes() : 0, 7)
+        << " "  << Format(kkt_ ? kkt_->iter() : 0, 7);
     control_.Debug()
         << "  " << Format(info_->dual_dropped, 7)
         << " "  << Format(info_->primal_dropped, 7);
 
-    const Basis* basis = kkt_->basis();
+    const Basis* basis = kkt_ ? kkt_->basis() : nullptr;
     if (basis) {
         if (control_.Debug(4)) {
             control_.Debug(4) << "  "
@@ -3,6 +3,7 @@
 #ifndef IPX_IPM_H_
 #define IPX_IPM_H_
 
+#include <memory>
 #include "control.h"
 #include "kkt_solver.h"
 #include "iterate.h"
@@ -11,10 +12,15 @@ namespace ipx {
 
 // IPM implements an interior point method based on KKTSolver and Iterate.
 // The algorithm is a variant of Mehrotra's [1] predictor-corrector method
-// that requires two linear system solves per iteration.
+// that requires two linear system solves per iteration. If the KKT solver
+// reports that its factorization is expensive compared to a solve, Gondzio's
+// [2] multiple centrality correctors are added to the direction, each of
+// which requires one more solve with the same factorization.
 //
 // [1] S. Mehrotra, "On the implementation of a primal-dual interior point
 //     method", SIAM J. Optim., 2 (1992).
+// [2] J. Gondzio, "Multiple centrality corrections in a primal-dual method
+//     for linear programming", Comput. Optim. Appl., 6 (1996).
 
 class IPM {
 public:
@@ -29,6 +35,22 @@ public:
     // If the method did not terminate successfully, @iterate is unchanged.
     void StartingPoint(KKTSolver* kkt, Iterate* iterate, Info* info);
 
+    // Initializes @iterate from the primal-dual point (@x,@y,@z) of the solver
+    // model, where z = zl-zu. Typically this is the solution of a related LP.
+    // The point is moved within the bounds and shifted into the interior, such
+    // that each complementarity product is at least the average product of
+    // the point, but at least kWarmStartMinMu. On return info->status_ipm is
+    // IPX_STATUS_not_run.
+    void WarmStartingPoint(const Vector& x, const Vector& y, const Vector& z,
+                           Iterate* iterate, Info* info);
+
+    // Returns the first iterate after the last call to StartingPoint() or
+    // WarmStartingPoint() whose complementarity is at most kWarmStartSaveMu
+    // times that of the starting point, or NULL if no such iterate occured.
+    // The final iterate is too close to the boundary to warm start a related
+    // LP, whereas this one is still well centered.
+    const Iterate* warm_start_iterate() const { return warm_iterate_.get(); }
+
     // Updates @iterate by interior point iterations. On return ipm_status is
     // IPX_STATUS_optimal       if iterate->term_crit_reached() is true,
     // IPX_STATUS_iter_limit    if info->iter >= maxiter(),
@@ -43,9 +65,31 @@ public:
 private:
     struct Step;
 
+    // A centrality corrector aims to increase the step sizes by
+    // kCorrectorStepIncrease. It is accepted if the minimum of the primal and
+    // dual step size increases by at least kCorrectorMinGain times that
+    // amount. The corrector moves complementarity products into the interval
+    // [kCorrectorBetaMin, kCorrectorBetaMax] * sigma * mu.
+    static constexpr double kCorrectorStepIncrease = 0.1;
+    static constexpr double kCorrectorMinGain = 0.1;
+    static constexpr double kCorrectorBetaMin = 0.1;
+    static constexpr double kCorrectorBetaMax = 10.0;
+
+    // Minimum complementarity of a warm starting point. A point that is close
+    // to optimal for a related LP would otherwise start the IPM with a
+    // complementarity that is too small compared to its infeasibility.
+    static constexpr double kWarmStartMinMu = 1e-2;
+
+    // The iterate for warm starting a related LP is saved when the
+    // complementarity has been reduced by this factor.
+    static constexpr double kWarmStartSaveMu = 1e-5;
+
     void ComputeStartingPoint();
     void Predictor(Step& step);
     void AddCorrector(Step& step);
+    // Returns the max # centrality correctors in the current iteration.
+    Int MaxCorrectors() const;
+    void AddCentralityCorrectors(Step& step, Int max_correctors);
     void StepSizes(const Step& step);
     void MakeStep(const Step& step);
     // Reduces the following linear system to KKT form:
@@ -74,6 +118,15 @@ private:
     // is bad if the primal or dual step size is < 0.05.
     Int num_bad_iter_{0};
     Int maxiter_{-1};
+    double sigma_{0.0};         // centering parameter in current iteration
+
+    // Sum of -log(1-alpha) over iterations, where alpha is the minimum of the
+    // primal and dual step to the boundary before and after adding
+    // centrality correctors. Used to estimate the # iterations saved.
+    double steplog_mehrotra_{0.0}, steplog_corrected_{0.0};
+
+    double mu_start_{0.0};      // complementarity of the starting point
+    std::unique_ptr<Iterate> warm_iterate_;
 };
 
 }  // namespace ipx
@@ -1,6 +1,8 @@
 // Copyright (c) 2018 ERGO-Code. See license.txt for license.
 
 #include "kkt_solver.h"
+#include <cassert>
+#include <cmath>
 #include "timer.h"
 
 namespace ipx {
@@ -20,6 +22,36 @@ void KKTSolver::Solve(const Vector& a, const Vector& b, double tol,
 
 Int KKTSolver::iter() const { return _iter(); }
 Int KKTSolver::basis_changes() const { return _basis_changes(); }
+double KKTSolver::factorize_cost() const { return _factorize_cost(); }
 const Basis* KKTSolver::basis() const { return _basis(); }
 
+void BuildNormalWeights(const Iterate* pt, Vector& W) {
+    if (!pt) {
+        W = 1.0;
+        return;
+    }
+    const Vector& xl = pt->xl();
+    const Vector& xu = pt->xu();
+    const Vector& zl = pt->zl();
+    const Vector& zu = pt->zu();
+    const Int num_var = W.size();
+
+    double regval = pt->mu();
+    for (Int j = 0; j < num_var; j++) {
+        assert(xl[j] > 0.0);
+        assert(xu[j] > 0.0);
+        double g = zl[j]/xl[j] + zu[j]/xu[j];
+        assert(std::isfinite(g));
+        if (g != 0.0 && g < regval)
+            regval = g;
+        W[j] = 1.0 / g;         // infinity if g is zero
+    }
+    for (Int j = 0; j < num_var; j++) {
+        if (std::isinf(W[j]))
+            W[j] = 1.0 / regval;
+        assert(std::isfinite(W[j]));
+        assert(W[j] > 0.0);
+    }
+}
+
 }  // namespace ipx
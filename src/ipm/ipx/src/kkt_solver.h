@@ -54,6 +54,12 @@ public:
     // call to Factorize(). Otherwise returns 0.
     Int basis_changes() const;
 
+    // Returns an estimate of the work in the last call to Factorize(), in
+    // units of one iteration of the iterative method (one solve for a direct
+    // method). The estimate is computed from operation counts, not timings.
+    // Returns 0.0 if the implementation does not provide an estimate.
+    double factorize_cost() const;
+
     // If a basis matrix is maintained, returns a pointer to it.
     // Otherwise returns NULL.
     const Basis* basis() const;
@@ -64,9 +70,17 @@ private:
                          Vector& x, Vector& y, Info* info) = 0;
     virtual Int _iter() const = 0;
     virtual Int _basis_changes() const { return 0; }
+    virtual double _factorize_cost() const { return 0.0; }
     virtual const Basis* _basis() const { return nullptr; }
 };
 
+// Builds the diagonal matrix W for the normal matrix AI*W*AI' from the (1,1)
+// block G of the KKT matrix, so that W[j] = 1.0/G[j,j]. For free variables
+// W[j] is set to 1.0/regval, where regval is a regularization value. regval is
+// chosen as the minimum of the complementarity measure mu and the smallest
+// nonzero diagonal entry of G. If @iterate is NULL, W is the identity matrix.
+void BuildNormalWeights(const Iterate* iterate, Vector& W);
+
 }  // namespace ipx
 
 #endif  // IPX_KKT_SOLVER_H_
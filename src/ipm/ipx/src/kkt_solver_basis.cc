@@ -1,6 +1,7 @@
 // Copyright (c) 2018 ERGO-Code. See license.txt for license.
 
 #include "kkt_solver_basis.h"
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include "conjugate_residuals.h"
@@ -24,6 +25,7 @@ void KKTSolverBasis::_Factorize(Iterate* iterate, Info* info) {
     factorized_ = false;
     iter_ = 0;
     basis_changes_ = 0;
+    factorize_cost_ = 0.0;
 
     for (Int j = 0; j < n+m; j++)
         colscale_[j] = iterate->ScalingFactor(j);
@@ -52,6 +54,11 @@ void KKTSolverBasis::_Factorize(Iterate* iterate, Info* info) {
     info->updates_ipm += maxvol.updates();
     info->time_maxvol += maxvol.time();
     basis_changes_ += maxvol.updates();
+    // Each slice of the tableau matrix costs one BTRAN, each column that is
+    // computed one FTRAN plus an update or a tableau row. A CR iteration with
+    // the splitted normal matrix costs one FTRAN and one BTRAN.
+    factorize_cost_ = 0.5 * std::max(maxvol.slices(), maxvol.passes()) +
+        maxvol.updates() + maxvol.skipped();
     if (info->errflag)
         return;
 
@@ -118,10 +125,15 @@ void KKTSolverBasis::_Solve(const Vector& a, const Vector& b, double tol,
             }
         }
     }
-    basis_.SolveDense(rhs, rhs, 'N');
 
-    // Compute work = inverse(B)*b.
-    basis_.SolveDense(b, work, 'N');
+    // Compute rhs = inverse(B)*rhs and work = inverse(B)*b in one call, which
+    // traverses the LU factors once for both right-hand sides.
+    Vector rhs_b(2*m);
+    std::copy_n(&rhs[0], m, &rhs_b[0]);
+    std::copy_n(&b[0], m, &rhs_b[m]);
+    basis_.SolveDense(2, &rhs_b[0], &rhs_b[0], 'N');
+    std::copy_n(&rhs_b[0], m, &rhs[0]);
+    std::copy_n(&rhs_b[m], m, &work[0]);
 
     // Build rhs[p] = (rhs[p]-work[p])/D[j] + D[j]*a[j], where j = basis[p]
     // is not a free variable, and rhs[p] = 0 otherwise.
@@ -37,6 +37,7 @@ private:
                 Vector& x, Vector& y, Info* info) override;
     Int _iter() const override { return iter_; }
     Int _basis_changes() const override { return basis_changes_; }
+    double _factorize_cost() const override { return factorize_cost_; }
     const Basis* _basis() const override { return &basis_; }
 
     // Processes basic variables that are close to a bound by either pivoting
@@ -61,6 +62,7 @@ private:
     Int maxiter_{-1};
     Int iter_{0};
     Int basis_changes_{0};
+    double factorize_cost_{0.0};
 };
 
 }  // namespace ipx
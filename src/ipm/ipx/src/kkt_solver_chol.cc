@@ -0,0 +1,97 @@
+// Copyright (c) 2018-2019 ERGO-Code. See license.txt for license.
+
+#include "kkt_solver_chol.h"
+#include <cassert>
+#include <cmath>
+#include "conjugate_residuals.h"
+
+namespace ipx {
+
+KKTSolverChol::KKTSolverChol(const Control& control, const Model& model,
+                             NormalCholesky& cholesky) :
+    control_(control), model_(model), normal_matrix_(model),
+    cholesky_(cholesky) {
+    Int m = model_.rows();
+    Int n = model_.cols();
+    W_.resize(m+n);
+    resscale_.resize(m);
+}
+
+void KKTSolverChol::_Factorize(Iterate* pt, Info* info) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    iter_ = 0;
+    factorized_ = false;
+
+    // Build matrix W for AI*W*AI'.
+    BuildNormalWeights(pt, W_);
+
+    // Residual scaling factors for termination test of CR method.
+    for (Int i = 0; i < m; i++)
+        resscale_[i] = 1.0 / std::sqrt(W_[n+i]);
+
+    // Build normal matrix and factorize preconditioner.
+    normal_matrix_.Prepare(&W_[0]);
+    cholesky_.Factorize(&W_[0], info);
+    if (info->errflag)
+        return;
+
+    factorized_ = true;
+}
+
+// cholesky_.flops() counts about two operations per multiply-add. A solve
+// costs one forward and backward solve with the Cholesky factor, a product
+// with the normal matrix and about four passes over AI to set up the right-hand
+// side and to recover the solution of the KKT system.
+double KKTSolverChol::_factorize_cost() const {
+    double factorize_ops = 0.5 * cholesky_.flops();
+    double solve_ops = 2.0*cholesky_.nonzeros() + 6.0*model_.AI().entries();
+    return factorize_ops / solve_ops;
+}
+
+// Solves the normal equations
+//
+//   (AI*W*AI') * y = -b + AI*W*a
+//
+// as in KKTSolverDiag. With the Cholesky preconditioner the CR iterations
+// only have to resolve the dense columns and the dropped pivots.
+//
+void KKTSolverChol::_Solve(const Vector& a, const Vector& b, double tol,
+                           Vector& x, Vector& y, Info* info) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    const SparseMatrix& AI = model_.AI();
+    assert(factorized_);
+
+    // Compose right-hand side AI*W*a-b.
+    Vector rhs = -b;
+    for (Int j = 0; j < n+m; j++)
+        ScatterColumn(AI, j, W_[j]*a[j], rhs);
+
+    // Solve normal equations.
+    y = 0.0;
+    normal_matrix_.reset_time();
+    cholesky_.reset_time();
+    ConjugateResiduals cr(control_);
+    cr.Solve(normal_matrix_, cholesky_, rhs, tol, &resscale_[0], maxiter_, y);
+    info->errflag = cr.errflag();
+    info->kktiter1 += cr.iter();
+    info->time_cr1 += cr.time();
+    info->time_cr1_AAt += normal_matrix_.time();
+    info->time_cr1_pre += cholesky_.time();
+    iter_ += cr.iter();
+
+    // Recover solution to KKT system.
+    for (Int i = 0; i < m; i++)
+        x[n+i] = b[i];
+    for (Int j = 0; j < n; j++) {
+        double aty = DotColumn(AI, j, y);
+        x[j] = W_[j] * (a[j]-aty);
+        for (Int p = AI.begin(j); p < AI.end(j); p++) {
+            Int i = AI.index(p);
+            x[n+i] -= x[j] * AI.value(p);
+        }
+    }
+}
+
+}  // namespace ipx
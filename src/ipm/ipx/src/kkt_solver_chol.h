@@ -0,0 +1,56 @@
+// Copyright (c) 2018-2019 ERGO-Code. See license.txt for license.
+
+#ifndef IPX_KKT_SOLVER_CHOL_H_
+#define IPX_KKT_SOLVER_CHOL_H_
+
+#include "control.h"
+#include "kkt_solver.h"
+#include "model.h"
+#include "normal_cholesky.h"
+#include "normal_matrix.h"
+
+namespace ipx {
+
+// KKTSolverChol implements a KKT solver that applies the Conjugate Residuals
+// method to the normal equations, preconditioned with a sparse Cholesky
+// factorization of the normal matrix without its dense columns. The normal
+// matrix and the regularization are the same as in KKTSolverDiag. CR
+// converges in one iteration if the model has no dense columns, and otherwise
+// in a few more iterations than the number of dense columns.
+//
+// The Cholesky object holds the ordering and symbolic factorization, which are
+// computed once per model and shared between KKT solvers.
+//
+// In the call to Factorize() @iterate is allowed to be NULL, in which case the
+// (1,1) block of the KKT matrix is the identity matrix.
+
+class KKTSolverChol : public KKTSolver {
+public:
+    KKTSolverChol(const Control& control, const Model& model,
+                  NormalCholesky& cholesky);
+
+    Int maxiter() const { return maxiter_; }
+    void maxiter(Int new_maxiter) { maxiter_ = new_maxiter; }
+
+private:
+    void _Factorize(Iterate* iterate, Info* info) override;
+    void _Solve(const Vector& a, const Vector& b, double tol,
+                Vector& x, Vector& y, Info* info) override;
+    Int _iter() const override { return iter_; };
+    double _factorize_cost() const override;
+
+    const Control& control_;
+    const Model& model_;
+    NormalMatrix normal_matrix_;
+    NormalCholesky& cholesky_;
+
+    Vector W_;               // diagonal matrix in AI*W*AI'
+    Vector resscale_;        // residual scaling factors for CR termination test
+    bool factorized_{false}; // KKT matrix factorized?
+    Int maxiter_{-1};
+    Int iter_{0};               // # CR iterations since last Factorize()
+};
+
+}  // namespace ipx
+
+#endif  // IPX_KKT_SOLVER_CHOL_H_
@@ -1,6 +1,7 @@
 // Copyright (c) 2018-2019 ERGO-Code. See license.txt for license.
 
 #include "kkt_solver_diag.h"
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include "conjugate_residuals.h"
@@ -13,6 +14,11 @@ KKTSolverDiag::KKTSolverDiag(const Control& control, const Model& model) :
     Int n = model_.cols();
     W_.resize(m+n);
     resscale_.resize(m);
+    if (control_.kkt_precond() == 1 || control_.kkt_precond() == 2) {
+        ichol_.reset(new IncompleteCholesky(model_, control_.ic_droptol(),
+                                            control_.ic_fill(),
+                                            control_.kkt_precond() == 2));
+    }
 }
 
 void KKTSolverDiag::_Factorize(Iterate* pt, Info* info) {
@@ -21,35 +27,8 @@ void KKTSolverDiag::_Factorize(Iterate* pt, Info* info) {
     iter_ = 0;
     factorized_ = false;
 
-    if (pt) {
-        const Vector& xl = pt->xl();
-        const Vector& xu = pt->xu();
-        const Vector& zl = pt->zl();
-        const Vector& zu = pt->zu();
-
-        // Build matrix W for AI*W*AI'. For free variables set W[j] to
-        // 1.0/regval, where regval is a regularization value. regval is chosen
-        // as the minimum of the complementarity measure mu and the smallest
-        // nonzero diagonal entry of the (1,1) block of the KKT matrix.
-        double regval = pt->mu();
-        for (Int j = 0; j < n+m; j++) {
-            assert(xl[j] > 0.0);
-            assert(xu[j] > 0.0);
-            double g = zl[j]/xl[j] + zu[j]/xu[j];
-            assert(std::isfinite(g));
-            if (g != 0.0 && g < regval)
-                regval = g;
-            W_[j] = 1.0 / g;        // infinity if g is zero
-        }
-        for (Int j = 0; j < n+m; j++) {
-            if (std::isinf(W_[j]))
-                W_[j] = 1.0 / regval;
-            assert(std::isfinite(W_[j]));
-            assert(W_[j] > 0.0);
-        }
-    } else {
-        W_ = 1.0;
-    }
+    // Build matrix W for AI*W*AI'.
+    BuildNormalWeights(pt, W_);
 
     // Residual scaling factors for termination test of CR method (see below).
     for (Int i = 0; i < m; i++)
@@ -57,7 +36,13 @@ void KKTSolverDiag::_Factorize(Iterate* pt, Info* info) {
 
     // Build normal matrix and preconditioner.
     normal_matrix_.Prepare(&W_[0]);
-    precond_.Factorize(&W_[0], info);
+    if (ichol_) {
+        ichol_->Factorize(&W_[0], info);
+        info->ic_nnz = std::max(info->ic_nnz, ichol_->nonzeros());
+        info->ic_blocks = ichol_->blocks();
+    } else {
+        precond_.Factorize(&W_[0], info);
+    }
     if (info->errflag)
         return;
 
@@ -94,14 +79,22 @@ void KKTSolverDiag::_Solve(const Vector& a, const Vector& b, double tol,
     // Solve normal equations.
     y = 0.0;
     normal_matrix_.reset_time();
-    precond_.reset_time();
     ConjugateResiduals cr(control_);
-    cr.Solve(normal_matrix_, precond_, rhs, tol, &resscale_[0], maxiter_, y);
+    if (ichol_) {
+        ichol_->reset_time();
+        cr.Solve(normal_matrix_, *ichol_, rhs, tol, &resscale_[0], maxiter_,
+                 y);
+        info->time_cr1_pre += ichol_->time();
+    } else {
+        precond_.reset_time();
+        cr.Solve(normal_matrix_, precond_, rhs, tol, &resscale_[0], maxiter_,
+                 y);
+        info->time_cr1_pre += precond_.time();
+    }
     info->errflag = cr.errflag();
     info->kktiter1 += cr.iter();
     info->time_cr1 += cr.time();
     info->time_cr1_AAt += normal_matrix_.time();
-    info->time_cr1_pre += precond_.time();
     iter_ += cr.iter();
 
     // Recover solution to KKT system.
@@ -3,8 +3,10 @@
 #ifndef IPX_KKT_SOLVER_DIAG_H_
 #define IPX_KKT_SOLVER_DIAG_H_
 
+#include <memory>
 #include "control.h"
 #include "diagonal_precond.h"
+#include "incomplete_cholesky.h"
 #include "kkt_solver.h"
 #include "model.h"
 #include "normal_matrix.h"
@@ -14,6 +16,9 @@ namespace ipx {
 // KKTSolverDiag implements a KKT solver that applies the Conjugate Residuals
 // method with diagonal preconditioning to the normal equations. If the (1,1)
 // block of the KKT matrix is not positive definite, regularization is applied.
+// If control.kkt_precond() is 1 or 2, then the diagonal preconditioner is
+// replaced by an incomplete Cholesky factorization of the normal matrix or its
+// block-Jacobi variant (see incomplete_cholesky.h).
 //
 // In the call to Factorize() @iterate is allowed to be NULL, in which case the
 // (1,1) block of the KKT matrix is the identity matrix.
@@ -35,6 +40,7 @@ private:
     const Model& model_;
     NormalMatrix normal_matrix_;
     DiagonalPrecond precond_;
+    std::unique_ptr<IncompleteCholesky> ichol_; // NULL if diagonal precond
 
     Vector W_;               // diagonal matrix in AI*W*AI'
     Vector resscale_;        // residual scaling factors for CR termination test
@@ -8,6 +8,7 @@
 #include "crossover.h"
 #include "info.h"
 #include "kkt_solver_basis.h"
+#include "kkt_solver_chol.h"
 #include "kkt_solver_diag.h"
 #include "starting_basis.h"
 #include "utils.h"
@@ -29,6 +30,9 @@ Int LpSolver::Solve(Int num_var, const double* obj, const double* lb,
             control_.CloseLogfile();
             return info_.status = IPX_STATUS_invalid_input;
         }
+        if ((Int) start_x_.size() != num_var ||
+            (Int) start_y_.size() != num_constr)
+            start_x_.clear();
         InteriorPointSolve();
         if ((info_.status_ipm == IPX_STATUS_optimal ||
              info_.status_ipm == IPX_STATUS_imprecise) && control_.crossover())
@@ -70,6 +74,10 @@ Int LpSolver::Solve(Int num_var, const double* obj, const double* lb,
         control_.Log() << " internal error: " << e.what() << '\n';
         info_.status = IPX_STATUS_internal_error;
     }
+    start_x_.clear();
+    start_slack_.clear();
+    start_y_.clear();
+    start_z_.clear();
     info_.time_total = control_.Elapsed();
     control_.Debug(2) << info_;
     control_.CloseLogfile();
@@ -102,6 +110,32 @@ Int LpSolver::GetBasicSolution(double* x, double* slack, double* y, double* z,
     return 0;
 }
 
+Int LpSolver::GetIPMWarmStartPoint(double* x, double* slack, double* y,
+                                   double* z) const {
+    const Iterate* iterate = warm_iterate_ ? warm_iterate_.get() :
+        iterate_.get();
+    if (!iterate)
+        return -1;
+    const Int num_var = model_.num_var();
+    std::vector<double> zl(num_var), zu(num_var);
+    model_.PostsolveInteriorSolution(
+        iterate->x(), iterate->xl(), iterate->xu(),
+        iterate->y(), iterate->zl(), iterate->zu(),
+        x, nullptr, nullptr, slack, y, &zl[0], &zu[0]);
+    for (Int j = 0; j < num_var; j++)
+        z[j] = zl[j]-zu[j];
+    return 0;
+}
+
+void LpSolver::LoadIPMStartingPoint(Int num_var, Int num_constr,
+                                    const double* x, const double* slack,
+                                    const double* y, const double* z) {
+    start_x_.assign(x, x+num_var);
+    start_slack_.assign(slack, slack+num_constr);
+    start_y_.assign(y, y+num_constr);
+    start_z_.assign(z, z+num_var);
+}
+
 Parameters LpSolver::GetParameters() const {
     return control_.parameters();
 }
@@ -114,6 +148,7 @@ void LpSolver::ClearModel() {
     info_ = Info();
     model_.clear();
     iterate_.reset(nullptr);
+    warm_iterate_.reset(nullptr);
     basis_.reset(nullptr);
     x_crossover_.resize(0);
     y_crossover_.resize(0);
@@ -245,44 +280,95 @@ void LpSolver::InteriorPointSolve() {
 void LpSolver::RunIPM() {
     IPM ipm(control_);
 
-    ComputeStartingPoint(ipm);
-    if (info_.status_ipm != IPX_STATUS_not_run)
+    AnalyseCholesky();
+    if (!start_x_.empty())
+        WarmStartingPoint(ipm);
+    else
+        ComputeStartingPoint(ipm);
+    if (info_.status_ipm == IPX_STATUS_not_run)
+        RunInitialIPM(ipm);
+    if (info_.status_ipm == IPX_STATUS_not_run)
+        BuildStartingBasis();
+    if (info_.status_ipm == IPX_STATUS_not_run)
+        RunMainIPM(ipm);
+    if (ipm.warm_start_iterate()) {
+        warm_iterate_.reset(new Iterate(*ipm.warm_start_iterate()));
+        warm_iterate_->Postprocess();
+    }
+}
+
+void LpSolver::AnalyseCholesky() {
+    cholesky_.reset();
+    if (control_.cholesky() == 0)
         return;
-    RunInitialIPM(ipm);
-    if (info_.status_ipm != IPX_STATUS_not_run)
+    const double max_nonzeros = kCholeskyMaxFill * model_.AI().entries();
+    if (control_.cholesky() < 0 &&
+        NormalCholesky::NormalMatrixNonzeros(model_) > max_nonzeros)
         return;
-    BuildStartingBasis();
-    if (info_.status_ipm != IPX_STATUS_not_run)
+    Timer timer;
+    std::unique_ptr<NormalCholesky> cholesky(new NormalCholesky(model_));
+    info_.time_chol_analyse += timer.Elapsed();
+    if (control_.cholesky() < 0 && cholesky->nonzeros() > max_nonzeros)
         return;
-    RunMainIPM(ipm);
+    info_.chol_nnz = cholesky->nonzeros();
+    control_.Log()
+        << " Cholesky factor nnz: " << cholesky->nonzeros() << ", flops: "
+        << sci2(cholesky->flops()) << '\n';
+    cholesky_ = std::move(cholesky);
 }
 
 void LpSolver::ComputeStartingPoint(IPM& ipm) {
     Timer timer;
-    KKTSolverDiag kkt(control_, model_);
 
     // If the starting point procedure fails, then iterate_ remains as
     // initialized by the constructor, which is a valid state for
     // postprocessing/postsolving.
-    ipm.StartingPoint(&kkt, iterate_.get(), &info_);
+    if (cholesky_) {
+        KKTSolverChol kkt(control_, model_, *cholesky_);
+        ipm.StartingPoint(&kkt, iterate_.get(), &info_);
+    } else {
+        KKTSolverDiag kkt(control_, model_);
+        ipm.StartingPoint(&kkt, iterate_.get(), &info_);
+    }
+    info_.time_ipm1 += timer.Elapsed();
+}
+
+void LpSolver::WarmStartingPoint(IPM& ipm) {
+    Timer timer;
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    Vector x(n+m), y(m), z(n+m);
+    model_.PresolveStartingPoint(&start_x_[0], &start_slack_[0], &start_y_[0],
+                                 &start_z_[0], x, y, z);
+    control_.Log() << " Warm starting from loaded point\n";
+    ipm.WarmStartingPoint(x, y, z, iterate_.get(), &info_);
     info_.time_ipm1 += timer.Elapsed();
 }
 
 void LpSolver::RunInitialIPM(IPM& ipm) {
     Timer timer;
-    KKTSolverDiag kkt(control_, model_);
+    KKTSolverDiag kkt_diag(control_, model_);
+    std::unique_ptr<KKTSolverChol> kkt_chol;
+    if (cholesky_)
+        kkt_chol.reset(new KKTSolverChol(control_, model_, *cholesky_));
 
     Int switchiter = control_.switchiter();
     if (switchiter < 0) {
         // Switch iteration not specified by user. Run as long as KKT solver
         // converges within min(500,10+m/20) iterations.
         Int m = model_.rows();
-        kkt.maxiter(std::min(500l, (long) (10+m/20) ));
+        Int maxiter = std::min(500l, (long) (10+m/20) );
+        kkt_diag.maxiter(maxiter);
+        if (kkt_chol)
+            kkt_chol->maxiter(maxiter);
         ipm.maxiter(control_.ipm_maxiter());
     } else {
         ipm.maxiter(std::min(switchiter, control_.ipm_maxiter()));
     }
-    ipm.Driver(&kkt, iterate_.get(), &info_);
+    if (kkt_chol)
+        ipm.Driver(kkt_chol.get(), iterate_.get(), &info_);
+    else
+        ipm.Driver(&kkt_diag, iterate_.get(), &info_);
     switch (info_.status_ipm) {
     case IPX_STATUS_optimal:
         // If the IPM reached its termination criterion in the initial
@@ -364,9 +450,51 @@ void LpSolver::RunCrossover() {
     z_crossover_.resize(n+m);
     iterate_->DropToComplementarity(x_crossover_, y_crossover_, z_crossover_);
 
-    // Run crossover. Perform dual pushes in increasing order and primal pushes
-    // in decreasing order of the scaling factors from the final IPM iterate.
-    {
+    // Count the superbasic variables, i.e. the pushes that crossover would
+    // need to perform.
+    Int superbasics = 0;
+    for (Int j = 0; j < n+m; j++) {
+        if (basis_->IsBasic(j)) {
+            if (z_crossover_[j] != 0.0)
+                superbasics++;
+        } else if (basis_->IsNonbasic(j)) {
+            if (x_crossover_[j] != lb[j] && x_crossover_[j] != ub[j] &&
+                !(std::isinf(lb[j]) && std::isinf(ub[j]) &&
+                  x_crossover_[j] == 0.0))
+                superbasics++;
+        }
+    }
+    info_.superbasics_crossover = superbasics;
+
+    if (control_.crossover_handoff() >= 0.0 &&
+        superbasics > control_.crossover_handoff() * m) {
+        // Skip the push phases and hand off the basis from the IPM, which is
+        // a crash basis for the simplex method. Nonbasic variables are moved
+        // to their nearer bound (or zero if free) and the dual variables of
+        // basic variables to zero.
+        control_.Log()
+            << " " << superbasics << " superbasics, basis handed off\n";
+        info_.handoff_crossover = 1;
+        info_.status_crossover = IPX_STATUS_optimal;
+        for (Int j = 0; j < n+m; j++) {
+            if (basis_->IsBasic(j)) {
+                z_crossover_[j] = 0.0;
+            } else {
+                const double x = x_crossover_[j];
+                if (std::isfinite(lb[j]) && std::isfinite(ub[j]))
+                    x_crossover_[j] = x-lb[j] <= ub[j]-x ? lb[j] : ub[j];
+                else if (std::isfinite(lb[j]))
+                    x_crossover_[j] = lb[j];
+                else if (std::isfinite(ub[j]))
+                    x_crossover_[j] = ub[j];
+                else
+                    x_crossover_[j] = 0.0;
+            }
+        }
+    } else {
+        // Run crossover. Perform dual pushes in increasing order and primal
+        // pushes in decreasing order of the scaling factors from the final
+        // IPM iterate.
         Vector weights(n+m);
         for (Int j = 0; j < n+m; j++)
             weights[j] = iterate_->ScalingFactor(j);
@@ -379,6 +507,10 @@ void LpSolver::RunCrossover() {
             crossover.primal_pivots() + crossover.dual_pivots();
         info_.pushes_crossover =
             crossover.primal_pushes() + crossover.dual_pushes();
+        info_.pushes_batched_crossover =
+            crossover.primal_pushes_batched() + crossover.dual_pushes_batched();
+        info_.time_crossover_primal = crossover.time_primal();
+        info_.time_crossover_dual = crossover.time_dual();
         if (info_.status_crossover != IPX_STATUS_optimal) {
             // Crossover failed. Discard solution.
             x_crossover_.resize(0);
@@ -431,6 +563,12 @@ void LpSolver::PrintSummary() {
                    << StatusString(info_.status_ipm) << '\n'
                    << Textline("Status crossover:")
                    << StatusString(info_.status_crossover) << '\n';
+    if (info_.correctors > 0) {
+        control_.Log()
+            << Textline("centrality correctors:") << info_.correctors
+            << ", est. IPM iterations saved: "
+            << Fixed(info_.correctors_iter_saved, 0, 0) << '\n';
+    }
     if (info_.status_ipm == IPX_STATUS_optimal ||
         info_.status_ipm == IPX_STATUS_imprecise) {
         control_.Log()
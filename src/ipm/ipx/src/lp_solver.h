@@ -9,6 +9,7 @@
 #include "ipm.h"
 #include "iterate.h"
 #include "model.h"
+#include "normal_cholesky.h"
 
 namespace ipx {
 
@@ -51,6 +52,27 @@ public:
     Int GetBasicSolution(double* x, double* slack, double* y, double* z,
                          Int* cbasis, Int* vbasis) const;
 
+    // Returns a point from the last call to Solve() for warm starting the IPM
+    // on a related LP by LoadIPMStartingPoint(). This is an IPM iterate that
+    // is still well centered, or the final iterate if no such iterate was
+    // saved. @x, @z: size num_var arrays, where z = zl-zu. @slack, @y: size
+    // num_constr arrays. Returns -1 if no IPM iterate was available and 0
+    // otherwise.
+    Int GetIPMWarmStartPoint(double* x, double* slack, double* y,
+                             double* z) const;
+
+    // Loads a starting point for the IPM in the next call to Solve(), such as
+    // the point of a related LP from GetIPMWarmStartPoint(). The
+    // point replaces the starting point computed by the IPM and is shifted
+    // into the interior of the LP passed to Solve(); it does not need to be
+    // feasible for that LP. It is used in the next call to Solve() only, and
+    // only if the dimensions of the LP agree with @num_var and @num_constr.
+    // @x, @z: size num_var arrays, where z = zl-zu.
+    // @slack, @y: size num_constr arrays.
+    void LoadIPMStartingPoint(Int num_var, Int num_constr, const double* x,
+                              const double* slack, const double* y,
+                              const double* z);
+
     // Returns/sets all paramters. Without calling SetParameters(), the solver
     // uses the default values of a Parameters object.
     Parameters GetParameters() const;
@@ -101,9 +123,17 @@ public:
     Int SymbolicInvert(Int* rowcounts, Int* colcounts);
 
 private:
+    // In the default setting the initial IPM uses the Cholesky factorization
+    // if the # entries in the factor is at most kCholeskyMaxFill times the #
+    // entries in AI. The ordering is skipped if a bound on the # entries in
+    // the normal matrix exceeds that limit already.
+    static constexpr double kCholeskyMaxFill = 20.0;
+
     void InteriorPointSolve();
     void RunIPM();
+    void AnalyseCholesky();
     void ComputeStartingPoint(IPM& ipm);
+    void WarmStartingPoint(IPM& ipm);
     void RunInitialIPM(IPM& ipm);
     void BuildStartingBasis();
     void RunMainIPM(IPM& ipm);
@@ -116,6 +146,15 @@ private:
     std::unique_ptr<Iterate> iterate_;
     std::unique_ptr<Basis> basis_;
 
+    // Symbolic Cholesky factorization of the normal matrix if it is used as
+    // preconditioner in the initial IPM; otherwise NULL.
+    std::unique_ptr<NormalCholesky> cholesky_;
+    std::unique_ptr<Iterate> warm_iterate_; // postprocessed
+
+    // Starting point for the IPM in the user model, loaded by
+    // LoadIPMStartingPoint(). Empty if no point is loaded.
+    std::vector<double> start_x_, start_slack_, start_y_, start_z_;
+
     // Basic solution computed by crossover and basic status of each variable
     // (one of IPX_nonbasic_lb, IPX_nonbasic_ub, IPX_basic, IPX_superbasic).
     // If crossover was not run or failed, then basic_statuses_ is empty.
@@ -19,6 +19,16 @@ void LuUpdate::SolveDense(const Vector& rhs, Vector& lhs, char trans) {
     _SolveDense(rhs, lhs, trans);
 }
 
+void LuUpdate::SolveDense(Int nrhs, const double* rhs, double* lhs,
+                          char trans) {
+    _SolveDense(nrhs, rhs, lhs, trans);
+}
+
+void LuUpdate::SolveSparse(Int nz, const Int* bi, const double* bx,
+                           IndexedVector& lhs, char trans) {
+    _SolveSparse(nz, bi, bx, lhs, trans);
+}
+
 void LuUpdate::FtranForUpdate(Int nz, const Int* bi, const double* bx) {
     _FtranForUpdate(nz, bi, bx);
 }
@@ -64,6 +64,21 @@ public:
     // @trans: 't' or 'T' for transposed system
     void SolveDense(const Vector& rhs, Vector& lhs, char trans);
 
+    // Solves linear systems with @nrhs dense right-hand sides at once.
+    // @rhs, @lhs: size dim*nrhs arrays holding the vectors columnwise, may
+    //             point to the same array.
+    // @trans: 't' or 'T' for transposed systems
+    void SolveDense(Int nrhs, const double* rhs, double* lhs, char trans);
+
+    // Solves linear system with sparse right-hand side. The factorization is
+    // not prepared for an update.
+    // @nz, @bi, @bx: right-hand side as compressed sparse vector; @bi must
+    //                not contain duplicates.
+    // @lhs: size dim vector returning the solution.
+    // @trans: 't' or 'T' for transposed system
+    void SolveSparse(Int nz, const Int* bi, const double* bx,
+                     IndexedVector& lhs, char trans);
+
     // Solves B*x=b in preparation for replacing a column of B by b.
     // @nz, @bi, @bx: b as compressed sparse vector.
     // @lhs: size dim vector returning x.
@@ -112,6 +127,10 @@ private:
     virtual void _GetFactors(SparseMatrix* L, SparseMatrix* U, Int* rowperm,
                              Int* colperm, std::vector<Int>* dep_cols) = 0;
     virtual void _SolveDense(const Vector& rhs, Vector& lhs, char trans) = 0;
+    virtual void _SolveDense(Int nrhs, const double* rhs, double* lhs,
+                             char trans) = 0;
+    virtual void _SolveSparse(Int nz, const Int* bi, const double* bx,
+                              IndexedVector& lhs, char trans) = 0;
     virtual void _FtranForUpdate(Int nz, const Int* bi, const double* bx) = 0;
     virtual void _FtranForUpdate(Int nz, const Int* bi, const double* bx,
                                 IndexedVector& lhs) = 0;
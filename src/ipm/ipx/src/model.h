@@ -70,6 +70,10 @@ public:
     // rightmost identity matrix).
     Int cols() const { return num_cols_; }
 
+    // Returns the number of variables and constraints of the user model.
+    Int num_var() const { return num_var_; }
+    Int num_constr() const { return num_constr_; }
+
     // Returns the number of columns classified as dense.
     Int num_dense_cols() const { return num_dense_cols_; }
 
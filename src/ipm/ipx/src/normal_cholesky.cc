@@ -0,0 +1,602 @@
+// Copyright (c) 2018-2019 ERGO-Code. See license.txt for license.
+
+#include "normal_cholesky.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include "timer.h"
+
+namespace ipx {
+
+NormalCholesky::NormalCholesky(const Model& model) : model_(model) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    const SparseMatrix& AI = model_.AI();
+    const SparseMatrix& AIt = model_.AIt();
+
+    // Build the graph of (1), i.e. the pattern of its off-diagonal entries.
+    std::vector<Int> adjp(m+1), adji;
+    std::vector<Int> mark(m, -1);
+    for (Int i = 0; i < m; i++) {
+        adjp[i] = adji.size();
+        mark[i] = i;
+        for (Int p = AIt.begin(i); p < AIt.end(i); p++) {
+            Int j = AIt.index(p);
+            if (j >= n || model_.IsDenseColumn(j))
+                continue;
+            for (Int q = AI.begin(j); q < AI.end(j); q++) {
+                Int r = AI.index(q);
+                if (mark[r] != i) {
+                    mark[r] = i;
+                    adji.push_back(r);
+                }
+            }
+        }
+    }
+    adjp[m] = adji.size();
+
+    ComputeOrdering(adjp, adji);
+    ComputeSymbolic(adjp, adji);
+    diag_.resize(m);
+    work_.resize(m);
+}
+
+double NormalCholesky::NormalMatrixNonzeros(const Model& model) {
+    const Int n = model.cols();
+    const SparseMatrix& AI = model.AI();
+    double nz = 0.0;
+    for (Int j = 0; j < n; j++) {
+        if (model.IsDenseColumn(j))
+            continue;
+        double colnz = AI.end(j) - AI.begin(j);
+        nz += 0.5 * colnz * (colnz-1.0);
+    }
+    return nz;
+}
+
+// Approximate minimum degree ordering on the quotient graph. Each variable is
+// adjacent to variables and to elements, which are eliminated variables that
+// have not been absorbed. Element p holds the variables adjacent to p when p
+// was eliminated. The external degree of variable i is bounded by the number
+// of variables adjacent to i plus, for each element e adjacent to i, the
+// number of variables of e that are not in the newest element; elements that
+// are contained in the newest element are absorbed.
+void NormalCholesky::ComputeOrdering(const std::vector<Int>& adjp,
+                                     const std::vector<Int>& adji) {
+    const Int m = model_.rows();
+    std::vector<std::vector<Int>> vadj(m), eadj(m), evar(m);
+    std::vector<Int> degree(m);
+    for (Int i = 0; i < m; i++) {
+        vadj[i].assign(adji.begin()+adjp[i], adji.begin()+adjp[i+1]);
+        degree[i] = vadj[i].size();
+    }
+
+    // Doubly linked lists of variables with equal degree.
+    std::vector<Int> head(m+1, -1), next(m, -1), prev(m, -1);
+    auto insert = [&](Int i) {
+        Int d = degree[i];
+        prev[i] = -1;
+        next[i] = head[d];
+        if (head[d] >= 0)
+            prev[head[d]] = i;
+        head[d] = i;
+    };
+    auto remove = [&](Int i) {
+        if (prev[i] >= 0)
+            next[prev[i]] = next[i];
+        else
+            head[degree[i]] = next[i];
+        if (next[i] >= 0)
+            prev[next[i]] = prev[i];
+    };
+    for (Int i = m-1; i >= 0; i--)
+        insert(i);
+
+    std::vector<char> eliminated(m, 0), absorbed(m, 0);
+    std::vector<Int> mark(m, -1), wmark(m, -1), w(m);
+    perm_.resize(m);
+    Int mindeg = 0;
+    for (Int k = 0; k < m; k++) {
+        while (head[mindeg] < 0)
+            mindeg++;
+        const Int p = head[mindeg];
+        remove(p);
+        perm_[k] = p;
+        eliminated[p] = 1;
+
+        // Form the new element from the variables adjacent to p and the
+        // variables of the elements adjacent to p, which are absorbed.
+        std::vector<Int>& Lp = evar[p];
+        mark[p] = k;
+        for (Int v : vadj[p]) {
+            if (!eliminated[v] && mark[v] != k) {
+                mark[v] = k;
+                Lp.push_back(v);
+            }
+        }
+        for (Int e : eadj[p]) {
+            if (absorbed[e])
+                continue;
+            for (Int v : evar[e]) {
+                if (!eliminated[v] && mark[v] != k) {
+                    mark[v] = k;
+                    Lp.push_back(v);
+                }
+            }
+            absorbed[e] = 1;
+            std::vector<Int>().swap(evar[e]);
+        }
+        std::vector<Int>().swap(vadj[p]);
+        std::vector<Int>().swap(eadj[p]);
+
+        // w[e] = # variables of element e that are not in Lp.
+        for (Int i : Lp) {
+            for (Int e : eadj[i]) {
+                if (absorbed[e])
+                    continue;
+                if (wmark[e] != k) {
+                    wmark[e] = k;
+                    w[e] = evar[e].size();
+                }
+                w[e]--;
+            }
+        }
+
+        // Update the adjacency and the degree of the variables in Lp.
+        const Int num_left = m-k-1;
+        for (Int i : Lp) {
+            remove(i);
+            Int deg = Lp.size()-1;
+            std::vector<Int>& ea = eadj[i];
+            Int put = 0;
+            for (Int e : ea) {
+                if (absorbed[e])
+                    continue;
+                if (w[e] == 0) {
+                    absorbed[e] = 1;
+                    std::vector<Int>().swap(evar[e]);
+                    continue;
+                }
+                ea[put++] = e;
+                deg += w[e];
+            }
+            ea.resize(put);
+            ea.push_back(p);
+            std::vector<Int>& va = vadj[i];
+            put = 0;
+            for (Int v : va) {
+                if (eliminated[v] || mark[v] == k)
+                    continue;
+                va[put++] = v;
+            }
+            va.resize(put);
+            deg += put;
+            degree[i] = std::min(deg, std::max(num_left-1, (Int) 0));
+            insert(i);
+            mindeg = std::min(mindeg, degree[i]);
+        }
+    }
+}
+
+void NormalCholesky::ComputeSymbolic(const std::vector<Int>& adjp,
+                                     const std::vector<Int>& adji) {
+    const Int m = model_.rows();
+    iperm_.resize(m);
+    for (Int k = 0; k < m; k++)
+        iperm_[perm_[k]] = k;
+
+    // Elimination tree of the permuted matrix.
+    std::vector<Int> parent(m, -1), ancestor(m, -1);
+    for (Int k = 0; k < m; k++) {
+        Int i0 = perm_[k];
+        for (Int p = adjp[i0]; p < adjp[i0+1]; p++) {
+            Int inext;
+            for (Int i = iperm_[adji[p]]; i >= 0 && i < k; i = inext) {
+                inext = ancestor[i];
+                ancestor[i] = k;
+                if (inext < 0)
+                    parent[i] = k;
+            }
+        }
+    }
+
+    // Postorder the elimination tree, visiting children in increasing order,
+    // and renumber so that the subtree of each node is a contiguous range
+    // ending at the node.
+    {
+        std::vector<Int> head(m, -1), next(m, -1), stack, post;
+        for (Int k = m-1; k >= 0; k--) {
+            if (parent[k] >= 0) {
+                next[k] = head[parent[k]];
+                head[parent[k]] = k;
+            }
+        }
+        post.reserve(m);
+        for (Int root = 0; root < m; root++) {
+            if (parent[root] >= 0)
+                continue;
+            stack.push_back(root);
+            while (!stack.empty()) {
+                Int k = stack.back();
+                if (head[k] >= 0) {
+                    Int child = head[k];
+                    head[k] = next[child];
+                    stack.push_back(child);
+                } else {
+                    stack.pop_back();
+                    post.push_back(k);
+                }
+            }
+        }
+        assert((Int) post.size() == m);
+        std::vector<Int> ipost(m), newperm(m), newparent(m);
+        for (Int k = 0; k < m; k++)
+            ipost[post[k]] = k;
+        for (Int k = 0; k < m; k++) {
+            newperm[k] = perm_[post[k]];
+            Int pk = parent[post[k]];
+            newparent[k] = pk >= 0 ? ipost[pk] : -1;
+        }
+        perm_ = newperm;
+        parent = newparent;
+        for (Int k = 0; k < m; k++)
+            iperm_[perm_[k]] = k;
+    }
+
+    // Column counts of L from the row subtrees: the pattern of row k of L is
+    // the set of nodes on the paths up the tree from each i < k adjacent to k.
+    std::vector<Int> colcount(m, 1), flag(m, -1), num_children(m, 0);
+    for (Int k = 0; k < m; k++) {
+        flag[k] = k;
+        Int i0 = perm_[k];
+        for (Int p = adjp[i0]; p < adjp[i0+1]; p++) {
+            for (Int j = iperm_[adji[p]]; j < k && flag[j] != k;
+                 j = parent[j]) {
+                flag[j] = k;
+                colcount[j]++;
+            }
+        }
+        if (parent[k] >= 0)
+            num_children[parent[k]]++;
+    }
+    nonzeros_ = 0;
+    flops_ = 0.0;
+    for (Int k = 0; k < m; k++) {
+        nonzeros_ += colcount[k];
+        flops_ += (double) colcount[k] * colcount[k];
+    }
+
+    // Fundamental supernodes: column k+1 joins the supernode of column k if
+    // k is its only child and the pattern of k is that of k+1 plus k.
+    snode_begin_.clear();
+    snode_of_.resize(m);
+    for (Int k = 0; k < m; k++) {
+        if (k == 0 || parent[k-1] != k || num_children[k] != 1 ||
+            colcount[k-1] != colcount[k]+1)
+            snode_begin_.push_back(k);
+        snode_of_[k] = snode_begin_.size()-1;
+    }
+    const Int num_snodes = snode_begin_.size();
+    snode_begin_.push_back(m);
+
+    // Row indices of each supernode are those of its first column.
+    rowptr_.assign(num_snodes+1, 0);
+    valptr_.assign(num_snodes+1, 0);
+    for (Int s = 0; s < num_snodes; s++) {
+        Int nrow = colcount[snode_begin_[s]];
+        Int ncol = snode_begin_[s+1]-snode_begin_[s];
+        rowptr_[s+1] = rowptr_[s] + nrow;
+        valptr_[s+1] = valptr_[s] + nrow*ncol;
+    }
+    rowidx_.resize(rowptr_[num_snodes]);
+    std::vector<Int> put(num_snodes);
+    for (Int s = 0; s < num_snodes; s++) {
+        rowidx_[rowptr_[s]] = snode_begin_[s];
+        put[s] = rowptr_[s]+1;
+    }
+    std::fill(flag.begin(), flag.end(), -1);
+    for (Int k = 0; k < m; k++) {
+        flag[k] = k;
+        Int i0 = perm_[k];
+        for (Int p = adjp[i0]; p < adjp[i0+1]; p++) {
+            for (Int j = iperm_[adji[p]]; j < k && flag[j] != k;
+                 j = parent[j]) {
+                flag[j] = k;
+                Int s = snode_of_[j];
+                if (snode_begin_[s] == j)
+                    rowidx_[put[s]++] = k;
+            }
+        }
+    }
+    for (Int s = 0; s < num_snodes; s++)
+        assert(put[s] == rowptr_[s+1]);
+
+    // For each supernode the descendants that update it, and the position of
+    // its first row in their row indices.
+    std::vector<Int> count(num_snodes+1, 0);
+    for (int pass = 0; pass < 2; pass++) {
+        for (Int d = 0; d < num_snodes; d++) {
+            Int ncol = snode_begin_[d+1]-snode_begin_[d];
+            Int last = -1;
+            for (Int p = rowptr_[d]+ncol; p < rowptr_[d+1]; p++) {
+                Int s = snode_of_[rowidx_[p]];
+                if (s == last)
+                    continue;
+                last = s;
+                if (pass == 0) {
+                    count[s+1]++;
+                } else {
+                    upd_snode_[count[s]] = d;
+                    upd_pos_[count[s]] = p-rowptr_[d];
+                    count[s]++;
+                }
+            }
+        }
+        if (pass == 0) {
+            for (Int s = 0; s < num_snodes; s++)
+                count[s+1] += count[s];
+            upd_ptr_ = count;
+            upd_snode_.resize(count[num_snodes]);
+            upd_pos_.resize(count[num_snodes]);
+        }
+    }
+
+    // Tree of supernodes and the flops in each subtree.
+    std::vector<Int> snode_parent(num_snodes, -1);
+    std::vector<double> subtree_flops(num_snodes, 0.0);
+    snode_first_.resize(num_snodes);
+    for (Int s = 0; s < num_snodes; s++)
+        snode_first_[s] = s;
+    for (Int s = 0; s < num_snodes; s++) {
+        for (Int k = snode_begin_[s]; k < snode_begin_[s+1]; k++)
+            subtree_flops[s] += (double) colcount[k] * colcount[k];
+        Int pk = parent[snode_begin_[s+1]-1];
+        if (pk >= 0) {
+            Int ps = snode_of_[pk];
+            snode_parent[s] = ps;
+            subtree_flops[ps] += subtree_flops[s];
+            snode_first_[ps] = std::min(snode_first_[ps], snode_first_[s]);
+        }
+    }
+
+    // Split the tree into subtrees that are factorized in parallel, such that
+    // each has at most a fraction of the flops or is a single supernode. The
+    // roots of the subtrees that are split are factorized afterwards.
+    #ifdef _OPENMP
+    const Int num_threads = omp_get_max_threads();
+    #else
+    const Int num_threads = 1;
+    #endif
+    std::vector<Int> snode_head(num_snodes, -1), snode_next(num_snodes, -1);
+    std::vector<Int> stack;
+    for (Int s = num_snodes-1; s >= 0; s--) {
+        if (snode_parent[s] >= 0) {
+            snode_next[s] = snode_head[snode_parent[s]];
+            snode_head[snode_parent[s]] = s;
+        } else {
+            stack.push_back(s);
+        }
+    }
+    const double max_flops = flops_ / (4*num_threads);
+    subtrees_.clear();
+    top_snodes_.clear();
+    while (!stack.empty()) {
+        Int s = stack.back();
+        stack.pop_back();
+        if (num_threads > 1 && subtree_flops[s] > max_flops &&
+            snode_head[s] >= 0) {
+            top_snodes_.push_back(s);
+            for (Int c = snode_head[s]; c >= 0; c = snode_next[c])
+                stack.push_back(c);
+        } else {
+            subtrees_.push_back(s);
+        }
+    }
+    std::sort(top_snodes_.begin(), top_snodes_.end());
+    std::sort(subtrees_.begin(), subtrees_.end(), [&](Int s1, Int s2) {
+            if (subtree_flops[s1] != subtree_flops[s2])
+                return subtree_flops[s1] > subtree_flops[s2];
+            return s1 < s2;
+        });
+    snode_dropped_.assign(num_snodes, 0);
+}
+
+void NormalCholesky::Factorize(const double* W, Info* info) {
+    const Int m = model_.rows();
+    const Int num_snodes = snode_begin_.size()-1;
+    Timer timer;
+    factorized_ = false;
+    value_.resize(valptr_[num_snodes]);
+
+    #pragma omp parallel if (subtrees_.size() > 1)
+    {
+        Workspace work;
+        work.relpos.resize(m);
+        #pragma omp for schedule(dynamic, 1)
+        for (Int t = 0; t < (Int) subtrees_.size(); t++)
+            FactorizeSubtree(subtrees_[t], W, work);
+    }
+    Workspace work;
+    work.relpos.resize(m);
+    for (Int s : top_snodes_)
+        FactorizeSupernode(s, W, work);
+
+    dropped_ = 0;
+    for (Int d : snode_dropped_)
+        dropped_ += d;
+    factorized_ = true;
+    info->chol_dropped += dropped_;
+    info->time_chol_factorize += timer.Elapsed();
+}
+
+void NormalCholesky::FactorizeSubtree(Int s, const double* W,
+                                      Workspace& work) {
+    for (Int t = snode_first_[s]; t <= s; t++)
+        FactorizeSupernode(t, W, work);
+}
+
+void NormalCholesky::FactorizeSupernode(Int s, const double* W,
+                                        Workspace& work) {
+    const Int n = model_.cols();
+    const SparseMatrix& AI = model_.AI();
+    const SparseMatrix& AIt = model_.AIt();
+    const Int first = snode_begin_[s];
+    const Int ncol = snode_begin_[s+1]-first;
+    const Int nrow = rowptr_[s+1]-rowptr_[s];
+    const Int* rows = &rowidx_[rowptr_[s]];
+    double* L = &value_[valptr_[s]];
+
+    std::fill(L, L+nrow*ncol, 0.0);
+    for (Int p = 0; p < nrow; p++)
+        work.relpos[rows[p]] = p;
+
+    // Assemble the lower triangular part of the columns of (1).
+    for (Int c = 0; c < ncol; c++) {
+        const Int k = first+c;
+        const Int i = perm_[k];
+        double* Lc = L + c*nrow;
+        Lc[c] = W ? W[n+i] : 0.0;
+        for (Int p = AIt.begin(i); p < AIt.end(i); p++) {
+            Int j = AIt.index(p);
+            if (j >= n || model_.IsDenseColumn(j))
+                continue;
+            double a = W ? AIt.value(p) * W[j] : AIt.value(p);
+            for (Int q = AI.begin(j); q < AI.end(j); q++) {
+                Int r = iperm_[AI.index(q)];
+                if (r >= k)
+                    Lc[work.relpos[r]] += a * AI.value(q);
+            }
+        }
+        diag_[k] = Lc[c];
+    }
+
+    // Subtract the updates from the descendants.
+    for (Int u = upd_ptr_[s]; u < upd_ptr_[s+1]; u++) {
+        const Int d = upd_snode_[u];
+        const Int p1 = upd_pos_[u];
+        const Int* drows = &rowidx_[rowptr_[d]];
+        const Int dnrow = rowptr_[d+1]-rowptr_[d];
+        const Int dncol = snode_begin_[d+1]-snode_begin_[d];
+        const double* Ld = &value_[valptr_[d]];
+        Int p2 = p1;
+        while (p2 < dnrow && drows[p2] < first+ncol)
+            p2++;
+        const Int nr = dnrow-p1;
+        const Int nc = p2-p1;
+        work.update.assign(nr*nc, 0.0);
+        for (Int b = 0; b < nc; b++) {
+            double* Ub = &work.update[b*nr];
+            for (Int t = 0; t < dncol; t++) {
+                const double* Lt = Ld + t*dnrow + p1;
+                const double alpha = Lt[b];
+                if (alpha == 0.0)
+                    continue;
+                for (Int a = b; a < nr; a++)
+                    Ub[a] += alpha * Lt[a];
+            }
+        }
+        for (Int b = 0; b < nc; b++) {
+            double* Lc = L + (drows[p1+b]-first)*nrow;
+            const double* Ub = &work.update[b*nr];
+            for (Int a = b; a < nr; a++)
+                Lc[work.relpos[drows[p1+a]]] -= Ub[a];
+        }
+    }
+
+    // Dense Cholesky factorization of the supernode.
+    Int dropped = 0;
+    for (Int c = 0; c < ncol; c++) {
+        double* Lc = L + c*nrow;
+        for (Int t = 0; t < c; t++) {
+            const double* Lt = L + t*nrow;
+            const double alpha = Lt[c];
+            if (alpha == 0.0)
+                continue;
+            for (Int a = c; a < nrow; a++)
+                Lc[a] -= alpha * Lt[a];
+        }
+        const double pivot = Lc[c];
+        if (pivot > kPivotZeroTol * diag_[first+c] && std::isfinite(pivot)) {
+            const double d = std::sqrt(pivot);
+            Lc[c] = d;
+            for (Int a = c+1; a < nrow; a++)
+                Lc[a] /= d;
+        } else {
+            Lc[c] = INFINITY;
+            for (Int a = c+1; a < nrow; a++)
+                Lc[a] = 0.0;
+            dropped++;
+        }
+    }
+    snode_dropped_[s] = dropped;
+}
+
+double NormalCholesky::time() const {
+    return time_;
+}
+
+void NormalCholesky::reset_time() {
+    time_ = 0.0;
+}
+
+void NormalCholesky::_Apply(const Vector& rhs, Vector& lhs,
+                            double* rhs_dot_lhs) {
+    const Int m = model_.rows();
+    const Int num_snodes = snode_begin_.size()-1;
+    Timer timer;
+
+    assert(factorized_);
+    assert((int)lhs.size() == m);
+    assert((int)rhs.size() == m);
+
+    for (Int k = 0; k < m; k++)
+        work_[k] = rhs[perm_[k]];
+
+    // Solve with L.
+    for (Int s = 0; s < num_snodes; s++) {
+        const Int first = snode_begin_[s];
+        const Int ncol = snode_begin_[s+1]-first;
+        const Int nrow = rowptr_[s+1]-rowptr_[s];
+        const Int* rows = &rowidx_[rowptr_[s]];
+        const double* L = &value_[valptr_[s]];
+        for (Int c = 0; c < ncol; c++) {
+            const double* Lc = L + c*nrow;
+            const double x = work_[first+c] / Lc[c];
+            work_[first+c] = x;
+            if (x != 0.0) {
+                for (Int a = c+1; a < nrow; a++)
+                    work_[rows[a]] -= Lc[a] * x;
+            }
+        }
+    }
+
+    // Solve with L'.
+    for (Int s = num_snodes-1; s >= 0; s--) {
+        const Int first = snode_begin_[s];
+        const Int ncol = snode_begin_[s+1]-first;
+        const Int nrow = rowptr_[s+1]-rowptr_[s];
+        const Int* rows = &rowidx_[rowptr_[s]];
+        const double* L = &value_[valptr_[s]];
+        for (Int c = ncol-1; c >= 0; c--) {
+            const double* Lc = L + c*nrow;
+            double x = work_[first+c];
+            for (Int a = c+1; a < nrow; a++)
+                x -= Lc[a] * work_[rows[a]];
+            work_[first+c] = x / Lc[c];
+        }
+    }
+
+    double rldot = 0.0;
+    for (Int k = 0; k < m; k++) {
+        lhs[perm_[k]] = work_[k];
+        rldot += work_[k] * rhs[perm_[k]];
+    }
+    if (rhs_dot_lhs)
+        *rhs_dot_lhs = rldot;
+    time_ += timer.Elapsed();
+}
+
+}  // namespace ipx
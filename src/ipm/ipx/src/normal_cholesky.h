@@ -0,0 +1,116 @@
+// Copyright (c) 2018-2019 ERGO-Code. See license.txt for license.
+
+#ifndef IPX_NORMAL_CHOLESKY_H_
+#define IPX_NORMAL_CHOLESKY_H_
+
+#include <vector>
+#include "linear_operator.h"
+#include "model.h"
+
+namespace ipx {
+
+// NormalCholesky provides inverse operations with a sparse Cholesky
+// factorization of the matrix
+//
+//   AI*W*AI' - sum_{j dense} W[j]*AI[:,j]*AI[:,j]',                (1)
+//
+// which is the normal matrix without the columns that the model classifies as
+// dense. Here AI is the m-by-(n+m) matrix defined by the model, and W is a
+// diagonal (weight) matrix provided by the user. Used as a preconditioner for
+// the normal matrix, the dense columns are a low rank correction that the CR
+// method resolves in a few iterations.
+//
+// The rows are ordered by approximate minimum degree and the elimination tree
+// is postordered. The ordering and the symbolic factorization depend only on
+// the sparsity pattern of AI and are computed once by the constructor. The
+// numeric factorization is supernodal and left-looking. Independent subtrees
+// of the elimination tree are factorized in parallel if OpenMP is available.
+
+class NormalCholesky : public LinearOperator {
+public:
+    // Constructor stores a reference to the model and computes the symbolic
+    // factorization. The model must be valid as long as the object is used.
+    explicit NormalCholesky(const Model& model);
+
+    // Returns the # entries in the Cholesky factor.
+    Int nonzeros() const { return nonzeros_; }
+
+    // Returns the # flops of a numeric factorization.
+    double flops() const { return flops_; }
+
+    // Returns an upper bound for the # off-diagonal entries in the lower
+    // triangle of (1), which is cheap to compute without the ordering.
+    static double NormalMatrixNonzeros(const Model& model);
+
+    // Factorizes (1). W must either hold n+m entries, or be NULL, in which
+    // case the first n entries are assumed 1.0 and the last m entries are
+    // assumed 0.0. A pivot that has lost all significant digits to
+    // cancellation is replaced by infinity, which drops the component from
+    // subsequent solves. The # dropped pivots and the time are added to
+    // info->chol_dropped and info->time_chol_factorize.
+    void Factorize(const double* W, Info* info);
+
+    // Returns the # pivots dropped in the last call to Factorize().
+    Int dropped() const { return dropped_; }
+
+    // Returns computation time for calls to Apply() since last reset_time().
+    double time() const;
+    void reset_time();
+
+private:
+    // A pivot is dropped if it is at most this fraction of the diagonal
+    // entry of (1).
+    static constexpr double kPivotZeroTol = 1e-14;
+
+    struct Workspace {
+        std::vector<Int> relpos;        // position of row in supernode
+        std::vector<double> update;     // dense update from a descendant
+    };
+
+    void _Apply(const Vector& rhs, Vector& lhs, double* rhs_dot_lhs) override;
+
+    void ComputeOrdering(const std::vector<Int>& adjp,
+                         const std::vector<Int>& adji);
+    void ComputeSymbolic(const std::vector<Int>& adjp,
+                         const std::vector<Int>& adji);
+    void FactorizeSupernode(Int s, const double* W, Workspace& work);
+    void FactorizeSubtree(Int s, const double* W, Workspace& work);
+
+    const Model& model_;
+    bool factorized_{false};
+    Int nonzeros_{0};
+    double flops_{0.0};
+    Int dropped_{0};
+    double time_{0.0};
+
+    std::vector<Int> perm_;     // row perm_[k] of AI is pivot k
+    std::vector<Int> iperm_;    // inverse of perm_
+
+    // Supernode s has columns snode_begin_[s] to snode_begin_[s+1]-1. Its
+    // row indices are rowidx_[rowptr_[s]..rowptr_[s+1]-1], starting with its
+    // columns. The entries of L are stored columnwise in a dense block of
+    // these rows at value_[valptr_[s]].
+    std::vector<Int> snode_begin_;
+    std::vector<Int> snode_of_;         // supernode of each column
+    std::vector<Int> snode_first_;      // first supernode in subtree of s
+    std::vector<Int> rowptr_, rowidx_;
+    std::vector<Int> valptr_;
+    std::vector<double> value_;
+
+    // The descendants of supernode s that update it are
+    // upd_snode_[upd_ptr_[s]..upd_ptr_[s+1]-1], in increasing order, with
+    // the positions of the first row of s in their row indices in upd_pos_.
+    std::vector<Int> upd_ptr_, upd_snode_, upd_pos_;
+
+    // Subtrees that are factorized in parallel, and the remaining supernodes
+    // that are factorized afterwards.
+    std::vector<Int> subtrees_, top_snodes_;
+    std::vector<Int> snode_dropped_;
+
+    std::vector<double> diag_;          // diagonal of (1) in pivot order
+    Vector work_;                       // permuted right-hand side
+};
+
+}  // namespace ipx
+
+#endif  // IPX_NORMAL_CHOLESKY_H_
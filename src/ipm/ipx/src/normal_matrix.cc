@@ -2,6 +2,9 @@
 
 #include "normal_matrix.h"
 #include <cassert>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "timer.h"
 #include "utils.h"
 
@@ -19,6 +22,12 @@ namespace ipx {
 // is the fastest on average (about 20% better than the best two-pass variant),
 // and also the fastest on most LP models. Therefore, it is used for
 // matrix-vector products of the form AA' here and in SplittedNormalMatrix.
+//
+// The one-pass variant scatters into lhs and cannot be split among threads
+// without a reduction over per-thread copies of lhs. When multiple threads
+// are available, method 2 is used instead, as each entry of the intermediate
+// result and of lhs is computed by one thread in a fixed order. Hence the
+// result does not depend on the number of threads.
 #define MATVECMETHOD 1
 
 NormalMatrix::NormalMatrix(const Model& model) : model_(model) {
@@ -60,7 +69,9 @@ void NormalMatrix::_Apply(const Vector& rhs, Vector& lhs,
     assert((int)lhs.size() == m);
     assert((int)rhs.size() == m);
 
-    if (W_) {
+    if (UseParallel()) {
+        ApplyParallel(rhs, lhs);
+    } else if (W_) {
         #if MATVECMETHOD == 1
         for (Int i = 0; i < m; i++)
             lhs[i] = rhs[i] * W_[n+i];
@@ -125,4 +136,51 @@ void NormalMatrix::_Apply(const Vector& rhs, Vector& lhs,
     time_ += timer.Elapsed();
 }
 
+bool NormalMatrix::UseParallel() const {
+    #ifdef _OPENMP
+    const Int n = model_.cols();
+    return model_.AI().colptr()[n] >= kParallelMinNonzeros &&
+        omp_get_max_threads() > 1 && !omp_in_parallel();
+    #else
+    return false;
+    #endif
+}
+
+void NormalMatrix::ApplyParallel(const Vector& rhs, Vector& lhs) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    const Int* Ap = model_.AI().colptr();
+    const Int* Ai = model_.AI().rowidx();
+    const double* Ax = model_.AI().values();
+    const Int* Atp = model_.AIt().colptr();
+    const Int* Ati = model_.AIt().rowidx();
+    const double* Atx = model_.AIt().values();
+    const double* W = W_;
+    if ((Int)work_.size() < n+m)
+        work_.resize(n+m);
+    double* work = &work_[0];
+
+    // work[0..n-1] = W*A'*rhs by columns of A, then lhs = A*work by rows of
+    // A. If W is NULL, the first n weights are 1.0 and the last m are 0.0.
+    #pragma omp parallel
+    {
+        #pragma omp for schedule(static, 256)
+        for (Int j = 0; j < n; j++) {
+            Int begin = Ap[j], end = Ap[j+1];
+            double d = 0.0;
+            for (Int p = begin; p < end; p++)
+                d += rhs[Ai[p]] * Ax[p];
+            work[j] = W ? d * W[j] : d;
+        }
+        #pragma omp for schedule(static, 256)
+        for (Int i = 0; i < m; i++) {
+            Int begin = Atp[i], end = Atp[i+1]-1; // skip identity entry
+            double d = W ? rhs[i] * W[n+i] : 0.0;
+            for (Int p = begin; p < end; p++)
+                d += work[Ati[p]] * Atx[p];
+            lhs[i] = d;
+        }
+    }
+}
+
 }  // namespace ipx
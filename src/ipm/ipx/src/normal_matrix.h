@@ -32,12 +32,18 @@ public:
     void reset_time();
 
 private:
+    // Products are computed by multiple threads if the model has at least
+    // this many nonzeros in A and OpenMP provides more than one thread.
+    static constexpr Int kParallelMinNonzeros = 20000;
+
     void _Apply(const Vector& rhs, Vector& lhs, double* rhs_dot_lhs) override;
+    bool UseParallel() const;
+    void ApplyParallel(const Vector& rhs, Vector& lhs);
 
     const Model& model_;
     const double* W_{nullptr};
     bool prepared_{false};
-    Vector work_;            // size n+m workspace (2-pass matvec products only)
+    Vector work_;            // size n+m workspace (2-pass/parallel products)
     double time_{0.0};
 };
 
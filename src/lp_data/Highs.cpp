@@ -22,6 +22,7 @@
 #include "io/Filereader.h"
 #include "io/HighsIO.h"
 #include "io/LoadOptions.h"
+#include "lp_data/HighsLpDecomposition.h"
 #include "lp_data/HighsLpUtils.h"
 #include "lp_data/HighsModelUtils.h"
 #include "lp_data/HighsSolution.h"
@@ -405,6 +406,8 @@ basis_.valid_, hmos_[0].basis_.valid_);
 #endif
   HighsPrintMessage(options_.output, options_.message_level, ML_VERBOSE,
                     "Solving %s\n", lp_.model_name_.c_str());
+  info_.lp_block_count = 0;
+  info_.presolve_reused = 0;
 
   double this_presolve_time = -1;
   double this_solve_presolved_lp_time = -1;
@@ -523,7 +526,12 @@ basis_.valid_, hmos_[0].basis_.valid_);
         options_.dual_objective_value_upper_bound = HIGHS_CONST_INF;
         this_solve_presolved_lp_time = -timer_.read(timer_.solve_clock);
         timer_.start(timer_.solve_clock);
-        call_status = runLpSolver(solved_hmo, "Solving the presolved LP");
+        if (options_.decompose_presolved_lp &&
+            runLpSolverByBlocks(solved_hmo)) {
+          call_status = HighsStatus::OK;
+        } else {
+          call_status = runLpSolver(solved_hmo, "Solving the presolved LP");
+        }
         timer_.stop(timer_.solve_clock);
         this_solve_presolved_lp_time += timer_.read(timer_.solve_clock);
         // Restore the dual objective cut-off
@@ -1524,6 +1532,56 @@ HighsPresolveStatus Highs::runPresolve() {
   if (presolve_.has_run_) presolve_.clear();
   double start_presolve = timer_.readRunHighsClock();
 
+  HighsPresolveStatus presolve_return_status;
+  std::string reuse_decision;
+  if (options_.presolve_reuse && presolve_.reuse(lp_, reuse_decision)) {
+    const double reuse_time = timer_.readRunHighsClock() - start_presolve;
+    HighsLogMessage(options_.logfile, HighsMessageType::INFO,
+                    "Presolve reused since %s: %d cost steps replayed in "
+                    "%.3gs, saving %.3gs",
+                    reuse_decision.c_str(),
+                    presolve_.data_.presolve_[0].numCostSteps(), reuse_time,
+                    presolve_.reuse_.presolve_time - reuse_time);
+    presolve_return_status = presolve_.presolve_status_;
+    info_.presolve_reused = 1;
+  } else {
+    if (options_.presolve_reuse)
+      HighsLogMessage(options_.logfile, HighsMessageType::INFO,
+                      "Presolve not reused since %s", reuse_decision.c_str());
+    presolve_return_status = runPresolveFromScratch(start_presolve);
+    if (presolve_return_status == HighsPresolveStatus::Timeout)
+      return presolve_return_status;
+  }
+
+  // Handle max case.
+  if (presolve_return_status == HighsPresolveStatus::Reduced &&
+      lp_.sense_ == ObjSense::MAXIMIZE)
+    presolve_.negateReducedLpCost();
+
+  // Update reduction counts.
+  switch (presolve_.presolve_status_) {
+    case HighsPresolveStatus::Reduced: {
+      HighsLp& reduced_lp = presolve_.getReducedProblem();
+      presolve_.info_.n_cols_removed = lp_.numCol_ - reduced_lp.numCol_;
+      presolve_.info_.n_rows_removed = lp_.numRow_ - reduced_lp.numRow_;
+      presolve_.info_.n_nnz_removed =
+          (int)lp_.Avalue_.size() - (int)reduced_lp.Avalue_.size();
+      break;
+    }
+    case HighsPresolveStatus::ReducedToEmpty: {
+      presolve_.info_.n_cols_removed = lp_.numCol_;
+      presolve_.info_.n_rows_removed = lp_.numRow_;
+      presolve_.info_.n_nnz_removed = (int)lp_.Avalue_.size();
+      break;
+    }
+    default:
+      break;
+  }
+  return presolve_return_status;
+}
+
+HighsPresolveStatus Highs::runPresolveFromScratch(
+    const double start_presolve) {
   // Set time limit.
   if (options_.time_limit > 0 && options_.time_limit < HIGHS_CONST_INF) {
     double left = options_.time_limit - start_presolve;
@@ -1562,33 +1620,13 @@ HighsPresolveStatus Highs::runPresolve() {
 
   presolve_.data_.presolve_[0].message_level = options_.message_level;
   presolve_.data_.presolve_[0].output = options_.output;
+  presolve_.data_.presolve_[0].postsolveLog.setSpillSize(
+      (size_t)options_.presolve_log_spill_size << 20);
+  presolve_.data_.presolve_[0].recordCostSteps = options_.presolve_reuse;
 
   HighsPresolveStatus presolve_return_status = presolve_.run();
-
-  // Handle max case.
-  if (presolve_return_status == HighsPresolveStatus::Reduced &&
-      lp_.sense_ == ObjSense::MAXIMIZE)
-    presolve_.negateReducedLpCost();
-
-  // Update reduction counts.
-  switch (presolve_.presolve_status_) {
-    case HighsPresolveStatus::Reduced: {
-      HighsLp& reduced_lp = presolve_.getReducedProblem();
-      presolve_.info_.n_cols_removed = lp_.numCol_ - reduced_lp.numCol_;
-      presolve_.info_.n_rows_removed = lp_.numRow_ - reduced_lp.numRow_;
-      presolve_.info_.n_nnz_removed =
-          (int)lp_.Avalue_.size() - (int)reduced_lp.Avalue_.size();
-      break;
-    }
-    case HighsPresolveStatus::ReducedToEmpty: {
-      presolve_.info_.n_cols_removed = lp_.numCol_;
-      presolve_.info_.n_rows_removed = lp_.numRow_;
-      presolve_.info_.n_nnz_removed = (int)lp_.Avalue_.size();
-      break;
-    }
-    default:
-      break;
-  }
+  if (options_.presolve_reuse)
+    presolve_.saveForReuse(lp_, timer_.readRunHighsClock() - start_presolve);
   return presolve_return_status;
 }
 
@@ -1650,6 +1688,102 @@ HighsStatus Highs::runLpSolver(const int model_index, const string message) {
   return return_status;
 }
 
+bool Highs::runLpSolverByBlocks(const int model_index) {
+  HighsModelObject& model = hmos_[model_index];
+  HighsLpDecomposition decomposition;
+  decomposeLp(model.lp_, decomposition);
+  const int num_block = (int)decomposition.block.size();
+  if (num_block < 2) return false;
+  HighsLogMessage(options_.logfile, HighsMessageType::INFO,
+                  "Solving the presolved LP as %d blocks of %d components",
+                  num_block, decomposition.num_component);
+
+  // Each block is solved serially with its own options and timer, and
+  // without logging
+  double time_limit = HIGHS_CONST_INF;
+  if (options_.time_limit < HIGHS_CONST_INF)
+    time_limit =
+        std::max(options_.time_limit - timer_.readRunHighsClock(), 0.0);
+  std::vector<HighsLp> block_lp(num_block);
+  std::vector<HighsOptions> block_options(num_block, options_);
+  std::vector<HighsTimer> block_timer(num_block);
+  std::vector<HighsModelObject> block_model;
+  block_model.reserve(num_block);
+  for (int block = 0; block < num_block; block++) {
+    HighsOptions& options = block_options[block];
+    options.logfile = NULL;
+    options.output = NULL;
+    options.highs_min_threads = 1;
+    options.highs_max_threads = 1;
+    options.time_limit = time_limit;
+    block_timer[block].startRunHighsClock();
+    block_model.push_back(HighsModelObject(block_lp[block], options,
+                                           block_timer[block]));
+  }
+  std::vector<HighsStatus> block_status(num_block);
+#pragma omp parallel for schedule(dynamic, 1)
+  for (int block = 0; block < num_block; block++) {
+    extractLpBlock(model.lp_, decomposition, block, block_lp[block]);
+    block_status[block] = solveLp(block_model[block], "Solving the block");
+  }
+
+  // As when solving the LP whole, postsolve needs the scaled LP of
+  // each block to be optimal, and the cleanup after postsolve will
+  // remove any unscaled infeasibilities
+  bool optimal = true;
+  bool unscaled_optimal = true;
+  for (int block = 0; block < num_block; block++) {
+    const HighsIterationCounts& counts = block_model[block].iteration_counts_;
+    info_.simplex_iteration_count += counts.simplex;
+    info_.ipm_iteration_count += counts.ipm;
+    info_.crossover_iteration_count += counts.crossover;
+    if (block_status[block] == HighsStatus::Error ||
+        block_model[block].scaled_model_status_ != HighsModelStatus::OPTIMAL)
+      optimal = false;
+    if (block_model[block].unscaled_model_status_ != HighsModelStatus::OPTIMAL)
+      unscaled_optimal = false;
+  }
+  if (!optimal) {
+    HighsLogMessage(options_.logfile, HighsMessageType::INFO,
+                    "Not all blocks are optimal: solving the presolved LP "
+                    "whole");
+    return false;
+  }
+  info_.lp_block_count = num_block;
+
+  // Merge the solutions and bases of the blocks
+  const HighsLp& lp = model.lp_;
+  HighsSolution& solution = model.solution_;
+  HighsBasis& basis = model.basis_;
+  solution.col_value.resize(lp.numCol_);
+  solution.col_dual.resize(lp.numCol_);
+  solution.row_value.resize(lp.numRow_);
+  solution.row_dual.resize(lp.numRow_);
+  basis.col_status.resize(lp.numCol_);
+  basis.row_status.resize(lp.numRow_);
+  double objective = lp.offset_;
+  for (int block = 0; block < num_block; block++) {
+    insertLpBlockSolution(decomposition.block[block],
+                          block_model[block].solution_,
+                          block_model[block].basis_, solution, basis);
+    objective +=
+        block_model[block].unscaled_solution_params_.objective_function_value;
+  }
+  basis.valid_ = true;
+  resetModelStatusAndSolutionParams(model);
+  model.scaled_model_status_ = HighsModelStatus::OPTIMAL;
+  model.scaled_solution_params_.primal_status =
+      PrimalDualStatus::STATUS_FEASIBLE_POINT;
+  model.scaled_solution_params_.dual_status =
+      PrimalDualStatus::STATUS_FEASIBLE_POINT;
+  model.scaled_solution_params_.objective_function_value = objective;
+  if (unscaled_optimal) {
+    model.unscaled_model_status_ = HighsModelStatus::OPTIMAL;
+    model.unscaled_solution_params_ = model.scaled_solution_params_;
+  }
+  return true;
+}
+
 HighsStatus Highs::writeSolution(const std::string filename,
                                  const bool pretty) const {
   HighsStatus return_status = HighsStatus::OK;
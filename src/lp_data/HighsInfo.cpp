@@ -25,6 +25,8 @@ void HighsInfo::clear() {
   num_dual_infeasibilities = -1;
   max_dual_infeasibility = 0;
   sum_dual_infeasibilities = 0;
+  lp_block_count = 0;
+  presolve_reused = 0;
 }
 
 inline const char* bool2string(bool b) { return b ? "true" : "false"; }
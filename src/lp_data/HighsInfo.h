@@ -115,6 +115,8 @@ struct HighsInfoStruct {
   int num_dual_infeasibilities;
   double max_dual_infeasibility;
   double sum_dual_infeasibilities;
+  int lp_block_count;
+  int presolve_reused;
 };
 
 class HighsInfo : public HighsInfoStruct {
@@ -227,6 +229,21 @@ class HighsInfo : public HighsInfoStruct {
         "sum_dual_infeasibilities", "Sum of dual infeasibilities", advanced,
         &sum_dual_infeasibilities, 0);
     records.push_back(record_double);
+
+    advanced = true;
+    record_int = new InfoRecordInt(
+        "lp_block_count",
+        "Number of blocks of the presolved LP solved separately: 0 => "
+        "Solved whole",
+        advanced, &lp_block_count, 0);
+    records.push_back(record_int);
+
+    record_int = new InfoRecordInt(
+        "presolve_reused",
+        "Reductions of the previous presolve reused for new costs: 0 => No; "
+        "1 => Yes",
+        advanced, &presolve_reused, 0);
+    records.push_back(record_int);
   }
 
  public:
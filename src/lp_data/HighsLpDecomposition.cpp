@@ -0,0 +1,170 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsLpDecomposition.cpp
+ * @brief Decomposition of an LP into independent blocks
+ */
+#include "lp_data/HighsLpDecomposition.h"
+
+#include <algorithm>
+
+// Root of the set containing the column, halving the path to it
+static int findRoot(std::vector<int>& parent, int col) {
+  while (parent[col] != col) {
+    parent[col] = parent[parent[col]];
+    col = parent[col];
+  }
+  return col;
+}
+
+void decomposeLp(const HighsLp& lp, HighsLpDecomposition& decomposition) {
+  const int numCol = lp.numCol_;
+  const int numRow = lp.numRow_;
+  decomposition.block.clear();
+  decomposition.row_in_block.assign(numRow, -1);
+
+  // Join the columns of each row, represented by the first column
+  // found in the row
+  std::vector<int> parent(numCol);
+  for (int col = 0; col < numCol; col++) parent[col] = col;
+  std::vector<int> row_col(numRow, -1);
+  for (int col = 0; col < numCol; col++) {
+    for (int el = lp.Astart_[col]; el < lp.Astart_[col + 1]; el++) {
+      const int row = lp.Aindex_[el];
+      if (row_col[row] < 0) {
+        row_col[row] = col;
+        continue;
+      }
+      const int root = findRoot(parent, row_col[row]);
+      const int col_root = findRoot(parent, col);
+      if (root < col_root) {
+        parent[col_root] = root;
+      } else if (col_root < root) {
+        parent[root] = col_root;
+      }
+    }
+  }
+
+  // Number the components in order of their first column, followed
+  // by one for each empty row
+  std::vector<int> col_component(numCol);
+  std::vector<HighsLpBlock> component;
+  for (int col = 0; col < numCol; col++) {
+    const int root = findRoot(parent, col);
+    if (root == col) {
+      col_component[col] = (int)component.size();
+      component.push_back(HighsLpBlock());
+    } else {
+      col_component[col] = col_component[root];
+    }
+    HighsLpBlock& block = component[col_component[col]];
+    block.col.push_back(col);
+    block.num_nz += lp.Astart_[col + 1] - lp.Astart_[col];
+  }
+  for (int row = 0; row < numRow; row++) {
+    if (row_col[row] >= 0) {
+      component[col_component[row_col[row]]].row.push_back(row);
+    } else {
+      component.push_back(HighsLpBlock());
+      component.back().row.push_back(row);
+    }
+  }
+  decomposition.num_component = (int)component.size();
+
+  // Components with enough nonzeros are blocks of their own, and the
+  // others are batched in order
+  HighsLpBlock batch;
+  for (HighsLpBlock& block : component) {
+    if (block.num_nz >= lp_decomposition_min_block_nonzeros) {
+      decomposition.block.push_back(std::move(block));
+      continue;
+    }
+    batch.col.insert(batch.col.end(), block.col.begin(), block.col.end());
+    batch.row.insert(batch.row.end(), block.row.begin(), block.row.end());
+    batch.num_nz += block.num_nz;
+    if (batch.num_nz >= lp_decomposition_min_block_nonzeros) {
+      decomposition.block.push_back(std::move(batch));
+      batch = HighsLpBlock();
+    }
+  }
+  if (batch.col.size() || batch.row.size())
+    decomposition.block.push_back(std::move(batch));
+
+  // Solving the largest blocks first balances the load on the threads
+  std::stable_sort(decomposition.block.begin(), decomposition.block.end(),
+                   [](const HighsLpBlock& block0, const HighsLpBlock& block1) {
+                     return block0.num_nz > block1.num_nz;
+                   });
+  for (HighsLpBlock& block : decomposition.block) {
+    std::sort(block.col.begin(), block.col.end());
+    std::sort(block.row.begin(), block.row.end());
+    for (int ix = 0; ix < (int)block.row.size(); ix++)
+      decomposition.row_in_block[block.row[ix]] = ix;
+  }
+}
+
+void extractLpBlock(const HighsLp& lp,
+                    const HighsLpDecomposition& decomposition, const int block,
+                    HighsLp& block_lp) {
+  const HighsLpBlock& lp_block = decomposition.block[block];
+  const int numCol = (int)lp_block.col.size();
+  const int numRow = (int)lp_block.row.size();
+  block_lp.numCol_ = numCol;
+  block_lp.numRow_ = numRow;
+  block_lp.sense_ = lp.sense_;
+  block_lp.offset_ = 0;
+  block_lp.model_name_ = lp.model_name_;
+
+  block_lp.Astart_.resize(numCol + 1);
+  block_lp.Aindex_.resize(lp_block.num_nz);
+  block_lp.Avalue_.resize(lp_block.num_nz);
+  block_lp.colCost_.resize(numCol);
+  block_lp.colLower_.resize(numCol);
+  block_lp.colUpper_.resize(numCol);
+  int num_nz = 0;
+  for (int ix = 0; ix < numCol; ix++) {
+    const int col = lp_block.col[ix];
+    block_lp.Astart_[ix] = num_nz;
+    for (int el = lp.Astart_[col]; el < lp.Astart_[col + 1]; el++) {
+      block_lp.Aindex_[num_nz] = decomposition.row_in_block[lp.Aindex_[el]];
+      block_lp.Avalue_[num_nz] = lp.Avalue_[el];
+      num_nz++;
+    }
+    block_lp.colCost_[ix] = lp.colCost_[col];
+    block_lp.colLower_[ix] = lp.colLower_[col];
+    block_lp.colUpper_[ix] = lp.colUpper_[col];
+  }
+  block_lp.Astart_[numCol] = num_nz;
+
+  block_lp.rowLower_.resize(numRow);
+  block_lp.rowUpper_.resize(numRow);
+  for (int ix = 0; ix < numRow; ix++) {
+    const int row = lp_block.row[ix];
+    block_lp.rowLower_[ix] = lp.rowLower_[row];
+    block_lp.rowUpper_[ix] = lp.rowUpper_[row];
+  }
+}
+
+void insertLpBlockSolution(const HighsLpBlock& block,
+                           const HighsSolution& block_solution,
+                           const HighsBasis& block_basis,
+                           HighsSolution& solution, HighsBasis& basis) {
+  for (int ix = 0; ix < (int)block.col.size(); ix++) {
+    const int col = block.col[ix];
+    solution.col_value[col] = block_solution.col_value[ix];
+    solution.col_dual[col] = block_solution.col_dual[ix];
+    basis.col_status[col] = block_basis.col_status[ix];
+  }
+  for (int ix = 0; ix < (int)block.row.size(); ix++) {
+    const int row = block.row[ix];
+    solution.row_value[row] = block_solution.row_value[ix];
+    solution.row_dual[row] = block_solution.row_dual[ix];
+    basis.row_status[row] = block_basis.row_status[ix];
+  }
+}
@@ -0,0 +1,58 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsLpDecomposition.h
+ * @brief Decomposition of an LP into independent blocks
+ */
+#ifndef LP_DATA_HIGHS_LP_DECOMPOSITION_H_
+#define LP_DATA_HIGHS_LP_DECOMPOSITION_H_
+
+#include <vector>
+
+#include "lp_data/HighsLp.h"
+
+// Connected components with fewer nonzeros than this are batched into
+// blocks of at least this many nonzeros, so that the cost of
+// scheduling a block stays small relative to solving it
+const int lp_decomposition_min_block_nonzeros = 1000;
+
+// A union of connected components of the constraint matrix of an LP,
+// solved as an LP of its own
+struct HighsLpBlock {
+  std::vector<int> col;
+  std::vector<int> row;
+  int num_nz = 0;
+};
+
+struct HighsLpDecomposition {
+  int num_component = 0;
+  // Blocks in decreasing order of their number of nonzeros
+  std::vector<HighsLpBlock> block;
+  // The index of each row of the LP within its block
+  std::vector<int> row_in_block;
+};
+
+// Find the connected components of the constraint matrix of the LP
+// and group them into blocks. The columns and rows of each block are
+// in increasing order
+void decomposeLp(const HighsLp& lp, HighsLpDecomposition& decomposition);
+
+// Form the LP of a block
+void extractLpBlock(const HighsLp& lp,
+                    const HighsLpDecomposition& decomposition, const int block,
+                    HighsLp& block_lp);
+
+// Copy the solution and basis of the LP of a block into those of the
+// LP, which must already have their full size
+void insertLpBlockSolution(const HighsLpBlock& block,
+                           const HighsSolution& block_solution,
+                           const HighsBasis& block_basis,
+                           HighsSolution& solution, HighsBasis& basis);
+
+#endif  // LP_DATA_HIGHS_LP_DECOMPOSITION_H_
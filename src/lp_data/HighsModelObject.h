@@ -10,6 +10,7 @@
 #ifndef LP_DATA_HIGHS_MODEL_OBJECT_H_
 #define LP_DATA_HIGHS_MODEL_OBJECT_H_
 
+#include "ipm/IpxSolution.h"
 #include "lp_data/HighsLp.h"
 #include "lp_data/HighsOptions.h"
 #include "simplex/HFactor.h"
@@ -39,6 +40,7 @@ class HighsModelObject {
   HighsIterationCounts iteration_counts_;
   HighsBasis basis_;
   HighsSolution solution_;
+  IpxInteriorSolution ipx_interior_solution_;
 
   HighsLp simplex_lp_;
   SimplexBasis simplex_basis_;
@@ -261,6 +261,8 @@ struct HighsOptionsStruct {
 
   // Advanced options
   bool run_crossover;
+  bool ipm_warm_start;
+  double ipm_simplex_handoff;
   bool run_as_hsol;
   bool mps_parser_type_free;
   int keep_n_rows;
@@ -278,10 +280,23 @@ struct HighsOptionsStruct {
   bool less_infeasible_DSE_check;
   bool less_infeasible_DSE_choose_row;
   bool use_original_HFactor_logic;
+  int presolve_log_spill_size;
+  bool decompose_presolved_lp;
+  bool presolve_reuse;
 
   // Options for MIP solver
   int mip_max_nodes;
   int mip_report_level;
+  double mip_heuristic_effort;
+  int mip_rins_max_nodes;
+  int mip_cut_rounds;
+  bool mip_pool_cuts_at_nodes;
+  bool mip_propagation;
+  bool mip_conflict_analysis;
+  bool mip_presolve;
+  bool mip_root_restarts;
+  std::string mip_checkpoint_file;
+  double mip_checkpoint_interval;
 
   // Switch for MIP solver
   bool mip;
@@ -529,6 +544,65 @@ class HighsOptions : public HighsOptionsStruct {
                             advanced, &mip_report_level, 0, 1, 2);
     records.push_back(record_int);
 
+    record_double = new OptionRecordDouble(
+        "mip_heuristic_effort",
+        "Fraction of MIP solver time spent in primal heuristics", advanced,
+        &mip_heuristic_effort, 0.0, 0.05, 1.0);
+    records.push_back(record_double);
+
+    record_int = new OptionRecordInt(
+        "mip_rins_max_nodes", "MIP solver max number of nodes in RINS sub-MIPs",
+        advanced, &mip_rins_max_nodes, 0, 500, HIGHS_CONST_I_INF);
+    records.push_back(record_int);
+
+    record_int = new OptionRecordInt(
+        "mip_cut_rounds", "MIP solver max number of root cut separation rounds",
+        advanced, &mip_cut_rounds, 0, 10, HIGHS_CONST_I_INF);
+    records.push_back(record_int);
+
+    record_bool = new OptionRecordBool(
+        "mip_pool_cuts_at_nodes",
+        "Add violated cuts from the cut pool to the LP at tree nodes", advanced,
+        &mip_pool_cuts_at_nodes, false);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_propagation",
+        "Propagate bound changes through the rows before solving node LPs",
+        advanced, &mip_propagation, true);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_conflict_analysis",
+        "Learn conflicts from infeasible nodes and use them in propagation",
+        advanced, &mip_conflict_analysis, true);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_presolve",
+        "Presolve the MIP using integrality before branch-and-bound",
+        advanced, &mip_presolve, true);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_root_restarts",
+        "Presolve the MIP again if many columns are fixed at the root node",
+        advanced, &mip_root_restarts, true);
+    records.push_back(record_bool);
+
+    record_string = new OptionRecordString(
+        "mip_checkpoint_file",
+        "File to which the MIP solver writes checkpoints, and from which it "
+        "resumes",
+        advanced, &mip_checkpoint_file, FILENAME_DEFAULT);
+    records.push_back(record_string);
+
+    record_double = new OptionRecordDouble(
+        "mip_checkpoint_interval",
+        "Time in seconds between MIP solver checkpoints", advanced,
+        &mip_checkpoint_interval, 0, 60, HIGHS_CONST_INF);
+    records.push_back(record_double);
+
     // Advanced options
     advanced = true;
 
@@ -537,6 +611,20 @@ class HighsOptions : public HighsOptionsStruct {
                                        advanced, &run_crossover, true);
     records.push_back(record_bool);
 
+    record_bool = new OptionRecordBool(
+        "ipm_warm_start",
+        "Start IPX from the interior solution of the previous IPX solve",
+        advanced, &ipm_warm_start, false);
+    records.push_back(record_bool);
+
+    record_double = new OptionRecordDouble(
+        "ipm_simplex_handoff",
+        "Skip IPX crossover and start the simplex solver from the IPX basis if "
+        "the number of superbasics exceeds this multiple of the number of "
+        "rows: negative for never",
+        advanced, &ipm_simplex_handoff, -1, -1, HIGHS_CONST_INF);
+    records.push_back(record_double);
+
     record_bool = new OptionRecordBool(
         "run_as_hsol", "Run HiGHS simplex solver as if it were hsol", advanced,
         &run_as_hsol, false);
@@ -642,6 +730,26 @@ class HighsOptions : public HighsOptionsStruct {
                              &less_infeasible_DSE_choose_row, true);
     records.push_back(record_bool);
 
+    record_int = new OptionRecordInt(
+        "presolve_log_spill_size",
+        "Size in MB of the log of presolve reductions above which it is "
+        "moved to a memory-mapped temporary file: 0 => never",
+        advanced, &presolve_log_spill_size, 0, 1024, HIGHS_CONST_I_INF);
+    records.push_back(record_int);
+
+    record_bool = new OptionRecordBool(
+        "decompose_presolved_lp",
+        "Solve the independent blocks of the presolved LP in parallel",
+        advanced, &decompose_presolved_lp, true);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "presolve_reuse",
+        "Reuse the reductions of the last presolve when the LP is "
+        "unchanged or only its costs have changed",
+        advanced, &presolve_reuse, false);
+    records.push_back(record_bool);
+
     record_bool =
         new OptionRecordBool("mip", "Use mip solver.", advanced, &mip, false);
     records.push_back(record_bool);
@@ -190,7 +190,7 @@ HighsStatus solveLp(HighsModelObject& model, const string message) {
     call_status = solveLpIpx(
         options, model.timer_, model.lp_, imprecise_solution, model.basis_,
         model.solution_, model.iteration_counts_, model.unscaled_model_status_,
-        model.unscaled_solution_params_);
+        model.unscaled_solution_params_, model.ipx_interior_solution_);
     return_status =
         interpretCallStatus(call_status, return_status, "solveLpIpx");
     if (return_status == HighsStatus::Error) return return_status;
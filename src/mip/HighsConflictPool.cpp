@@ -0,0 +1,28 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsConflictPool.h"
+
+void HighsConflictPool::setup(const int numCol) {
+  conflicts_.clear();
+  col_conflicts_.assign(numCol, std::vector<int>());
+}
+
+int HighsConflictPool::addConflict(
+    const std::vector<HighsConflictLiteral>& literals) {
+  if (literals.size() == 0 ||
+      (int)literals.size() > mip_conflict_max_literals)
+    return -1;
+  if ((int)conflicts_.size() >= mip_conflict_max_num) return -1;
+  const int conflict = conflicts_.size();
+  conflicts_.push_back(literals);
+  for (const HighsConflictLiteral& literal : literals)
+    col_conflicts_[literal.col].push_back(conflict);
+  return conflict;
+}
@@ -0,0 +1,55 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_CONFLICT_POOL_H_
+#define MIP_HIGHS_CONFLICT_POOL_H_
+
+#include <vector>
+
+// Conflicts with more literals than this rarely prune anything
+const int mip_conflict_max_literals = 20;
+// Conflicts are only derived from this many candidate literals
+const int mip_conflict_max_candidates = 50;
+// Limit on the number of conflicts kept
+const int mip_conflict_max_num = 10000;
+
+// The bound x[col] <= value if upper is true, otherwise x[col] >= value
+struct HighsConflictLiteral {
+  int col;
+  bool upper;
+  double value;
+};
+
+// A conflict is a set of bound literals that cannot all hold in any
+// feasible solution. Conflicts are learned from infeasible nodes and
+// used in domain propagation, so the pool keeps the conflicts
+// containing each column.
+class HighsConflictPool {
+ public:
+  void setup(const int numCol);
+
+  // Add a conflict, returning its index, or -1 if it is too long or
+  // the pool is full
+  int addConflict(const std::vector<HighsConflictLiteral>& literals);
+
+  const std::vector<HighsConflictLiteral>& getConflict(
+      const int conflict) const {
+    return conflicts_[conflict];
+  }
+  const std::vector<int>& getColConflicts(const int col) const {
+    return col_conflicts_[col];
+  }
+  int getNumConflicts() const { return (int)conflicts_.size(); }
+
+ private:
+  std::vector<std::vector<HighsConflictLiteral>> conflicts_;
+  std::vector<std::vector<int>> col_conflicts_;
+};
+
+#endif
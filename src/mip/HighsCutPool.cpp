@@ -0,0 +1,161 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsCutPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <utility>
+
+size_t HighsCutPool::hashSupport(const std::vector<int>& index) const {
+  size_t hash = index.size();
+  for (int ix : index) hash = hash * 31 + std::hash<int>()(ix);
+  return hash;
+}
+
+HighsCutStatus HighsCutPool::addCut(const std::vector<int>& index,
+                                    const std::vector<double>& value,
+                                    const double lower, int& cut) {
+  double norm = 0;
+  for (double v : value) norm += v * v;
+  norm = std::sqrt(norm);
+  cut = -1;
+  if (norm == 0) return HighsCutStatus::kEmpty;
+
+  // Look for a cut with the same support and parallel coefficients
+  const size_t hash = hashSupport(index);
+  auto range = support_hash_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    HighsCut& pool_cut = cuts_[it->second];
+    if (pool_cut.index != index) continue;
+    const double ratio = pool_cut.value[0] / value[0];
+    if (ratio <= 0) continue;
+    bool parallel = true;
+    for (int ix = 1; ix < (int)index.size(); ix++) {
+      if (std::fabs(pool_cut.value[ix] - ratio * value[ix]) >
+          1e-9 * std::fabs(pool_cut.value[ix])) {
+        parallel = false;
+        break;
+      }
+    }
+    if (!parallel) continue;
+    cut = it->second;
+    // Keep the stronger right hand side
+    if (lower / norm <= pool_cut.lower / pool_cut.norm)
+      return HighsCutStatus::kRedundant;
+    pool_cut.lower = ratio * lower;
+    pool_cut.age = 0;
+    return HighsCutStatus::kStrengthened;
+  }
+
+  if (free_slots_.size() > 0) {
+    cut = free_slots_.back();
+    free_slots_.pop_back();
+  } else {
+    cut = (int)cuts_.size();
+    cuts_.resize(cut + 1);
+  }
+  HighsCut& new_cut = cuts_[cut];
+  new_cut.index = index;
+  new_cut.value = value;
+  new_cut.lower = lower;
+  new_cut.norm = norm;
+  new_cut.age = 0;
+  new_cut.in_lp = false;
+  new_cut.deleted = false;
+  support_hash_.insert(std::make_pair(hash, cut));
+  num_cuts_++;
+  num_cuts_added_++;
+  return HighsCutStatus::kAdded;
+}
+
+double HighsCutPool::violation(const int cut,
+                               const std::vector<double>& col_value) const {
+  const HighsCut& this_cut = cuts_[cut];
+  double activity = 0;
+  for (int ix = 0; ix < (int)this_cut.index.size(); ix++)
+    activity += this_cut.value[ix] * col_value[this_cut.index[ix]];
+  return this_cut.lower - activity;
+}
+
+double HighsCutPool::efficacy(const int cut,
+                              const std::vector<double>& col_value) const {
+  return violation(cut, col_value) / cuts_[cut].norm;
+}
+
+double HighsCutPool::parallelism(const int cut0, const int cut1,
+                                 std::vector<double>& workspace) const {
+  const HighsCut& this_cut = cuts_[cut0];
+  const HighsCut& other_cut = cuts_[cut1];
+  for (int ix = 0; ix < (int)this_cut.index.size(); ix++)
+    workspace[this_cut.index[ix]] = this_cut.value[ix];
+  double dot = 0;
+  for (int ix = 0; ix < (int)other_cut.index.size(); ix++)
+    dot += other_cut.value[ix] * workspace[other_cut.index[ix]];
+  for (int ix = 0; ix < (int)this_cut.index.size(); ix++)
+    workspace[this_cut.index[ix]] = 0;
+  return std::fabs(dot) / (this_cut.norm * other_cut.norm);
+}
+
+void HighsCutPool::separate(const std::vector<double>& col_value,
+                            const int max_num_cut, std::vector<int>& cut_set) {
+  cut_set.clear();
+  std::vector<std::pair<double, int>> candidates;
+  for (int cut = 0; cut < (int)cuts_.size(); cut++) {
+    if (cuts_[cut].deleted || cuts_[cut].in_lp) continue;
+    const double cut_efficacy = efficacy(cut, col_value);
+    if (cut_efficacy >= mip_cut_min_efficacy)
+      candidates.push_back(std::make_pair(-cut_efficacy, cut));
+  }
+  std::sort(candidates.begin(), candidates.end());
+
+  std::vector<double> workspace(col_value.size(), 0);
+  for (const std::pair<double, int>& candidate : candidates) {
+    if ((int)cut_set.size() >= max_num_cut) break;
+    const int cut = candidate.second;
+    bool accept = true;
+    for (int selected : cut_set) {
+      if (parallelism(cut, selected, workspace) > mip_cut_max_parallelism) {
+        accept = false;
+        break;
+      }
+    }
+    if (accept) cut_set.push_back(cut);
+  }
+}
+
+void HighsCutPool::ageCuts(const std::vector<double>& col_value) {
+  for (int cut = 0; cut < (int)cuts_.size(); cut++) {
+    HighsCut& this_cut = cuts_[cut];
+    if (this_cut.deleted || this_cut.in_lp) continue;
+    if (efficacy(cut, col_value) >= mip_cut_min_efficacy) {
+      this_cut.age = 0;
+    } else if (++this_cut.age > mip_cut_max_age) {
+      removeCut(cut);
+    }
+  }
+}
+
+void HighsCutPool::removeCut(const int cut) {
+  HighsCut& this_cut = cuts_[cut];
+  auto range = support_hash_.equal_range(hashSupport(this_cut.index));
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == cut) {
+      support_hash_.erase(it);
+      break;
+    }
+  }
+  this_cut.deleted = true;
+  this_cut.index.clear();
+  this_cut.value.clear();
+  free_slots_.push_back(cut);
+  num_cuts_--;
+  num_cuts_removed_++;
+}
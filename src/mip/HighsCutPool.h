@@ -0,0 +1,92 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_CUT_POOL_H_
+#define MIP_HIGHS_CUT_POOL_H_
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+// Cuts are only worth adding to the LP if they cut off the LP
+// solution by a sufficient distance
+const double mip_cut_min_efficacy = 1e-4;
+// Cuts whose normals are closer than this to one already selected are
+// not added in the same round
+const double mip_cut_max_parallelism = 0.95;
+// Cuts not violated for this many separation rounds leave the pool
+const int mip_cut_max_age = 10;
+// Limit on the number of cuts added to the LP in one round
+const int mip_cut_max_per_round = 100;
+
+// A globally valid cut sum_j value[j] * x[index[j]] >= lower
+struct HighsCut {
+  std::vector<int> index;
+  std::vector<double> value;
+  double lower;
+  double norm;
+  int age = 0;
+  bool in_lp = false;
+  bool deleted = false;
+};
+
+enum class HighsCutStatus {
+  // The cut is new to the pool
+  kAdded = 0,
+  // The cut is a multiple of one in the pool, whose right hand side
+  // it strengthens
+  kStrengthened,
+  // The cut is implied by one in the pool
+  kRedundant,
+  kEmpty
+};
+
+class HighsCutPool {
+ public:
+  // Add a cut to the pool. Unless the cut is empty, cut is set to the
+  // index of the new cut, or of the equivalent cut in the pool
+  HighsCutStatus addCut(const std::vector<int>& index,
+                        const std::vector<double>& value, const double lower,
+                        int& cut);
+
+  // Choose the most efficacious violated cuts that are not in the LP
+  // and not too parallel to each other
+  void separate(const std::vector<double>& col_value, const int max_num_cut,
+                std::vector<int>& cut_set);
+
+  double violation(const int cut, const std::vector<double>& col_value) const;
+  double efficacy(const int cut, const std::vector<double>& col_value) const;
+
+  // Age cuts outside the LP, and remove those that have been
+  // violated by none of the recent LP solutions
+  void ageCuts(const std::vector<double>& col_value);
+
+  HighsCut& getCut(const int cut) { return cuts_[cut]; }
+  const HighsCut& getCut(const int cut) const { return cuts_[cut]; }
+  // Cuts are indexed by slot, and slots of removed cuts are reused
+  int getNumCutSlots() const { return (int)cuts_.size(); }
+  int getNumCuts() const { return num_cuts_; }
+  int getNumCutsAdded() const { return num_cuts_added_; }
+  int getNumCutsRemoved() const { return num_cuts_removed_; }
+
+ private:
+  size_t hashSupport(const std::vector<int>& index) const;
+  double parallelism(const int cut0, const int cut1,
+                     std::vector<double>& workspace) const;
+  void removeCut(const int cut);
+
+  std::vector<HighsCut> cuts_;
+  std::vector<int> free_slots_;
+  std::unordered_multimap<size_t, int> support_hash_;
+  int num_cuts_ = 0;
+  int num_cuts_added_ = 0;
+  int num_cuts_removed_ = 0;
+};
+
+#endif
@@ -0,0 +1,349 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsDomain.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "lp_data/HConst.h"
+
+void HighsDomain::setup(const HighsLp& mip) {
+  mip_ = &mip;
+  const int numCol = mip.numCol_;
+  const int numRow = mip.numRow_;
+
+  // Form the row-wise copy of the matrix
+  ARstart_.assign(numRow + 1, 0);
+  ARindex_.resize(mip.Astart_[numCol]);
+  ARvalue_.resize(mip.Astart_[numCol]);
+  for (int k = 0; k < mip.Astart_[numCol]; k++) ARstart_[mip.Aindex_[k] + 1]++;
+  for (int row = 0; row < numRow; row++) ARstart_[row + 1] += ARstart_[row];
+  std::vector<int> row_fill(ARstart_.begin(), ARstart_.end() - 1);
+  for (int col = 0; col < numCol; col++) {
+    for (int k = mip.Astart_[col]; k < mip.Astart_[col + 1]; k++) {
+      const int put = row_fill[mip.Aindex_[k]]++;
+      ARindex_[put] = col;
+      ARvalue_[put] = mip.Avalue_[k];
+    }
+  }
+
+  col_lower_ = mip.colLower_;
+  col_upper_ = mip.colUpper_;
+  computeActivities();
+  row_queue_.clear();
+  row_queued_.assign(numRow, 0);
+  num_set_bounds_ = 0;
+  num_bound_changes_ = 0;
+}
+
+void HighsDomain::computeActivities() {
+  const HighsLp& mip = *mip_;
+  min_activity_.assign(mip.numRow_, 0);
+  max_activity_.assign(mip.numRow_, 0);
+  num_inf_min_activity_.assign(mip.numRow_, 0);
+  num_inf_max_activity_.assign(mip.numRow_, 0);
+  for (int col = 0; col < mip.numCol_; col++) {
+    for (int k = mip.Astart_[col]; k < mip.Astart_[col + 1]; k++) {
+      const int row = mip.Aindex_[k];
+      const double value = mip.Avalue_[k];
+      const double min_bound = value > 0 ? col_lower_[col] : col_upper_[col];
+      const double max_bound = value > 0 ? col_upper_[col] : col_lower_[col];
+      if (std::fabs(min_bound) >= HIGHS_CONST_INF) {
+        num_inf_min_activity_[row]++;
+      } else {
+        min_activity_[row] += value * min_bound;
+      }
+      if (std::fabs(max_bound) >= HIGHS_CONST_INF) {
+        num_inf_max_activity_[row]++;
+      } else {
+        max_activity_[row] += value * max_bound;
+      }
+    }
+  }
+}
+
+double HighsDomain::getMinActivity(const int row) const {
+  return num_inf_min_activity_[row] ? -HIGHS_CONST_INF : min_activity_[row];
+}
+
+double HighsDomain::getMaxActivity(const int row) const {
+  return num_inf_max_activity_[row] ? HIGHS_CONST_INF : max_activity_[row];
+}
+
+void HighsDomain::updateActivity(const double coefficient,
+                                 const double old_value,
+                                 const double new_value, double& activity,
+                                 int& num_inf) const {
+  if (std::fabs(old_value) >= HIGHS_CONST_INF) {
+    num_inf--;
+  } else {
+    activity -= coefficient * old_value;
+  }
+  if (std::fabs(new_value) >= HIGHS_CONST_INF) {
+    num_inf++;
+  } else {
+    activity += coefficient * new_value;
+  }
+}
+
+void HighsDomain::changeLower(const int col, const double value) {
+  const HighsLp& mip = *mip_;
+  const double old_value = col_lower_[col];
+  for (int k = mip.Astart_[col]; k < mip.Astart_[col + 1]; k++) {
+    const int row = mip.Aindex_[k];
+    if (mip.Avalue_[k] > 0) {
+      updateActivity(mip.Avalue_[k], old_value, value, min_activity_[row],
+                     num_inf_min_activity_[row]);
+    } else {
+      updateActivity(mip.Avalue_[k], old_value, value, max_activity_[row],
+                     num_inf_max_activity_[row]);
+    }
+  }
+  col_lower_[col] = value;
+  // Relaxing a bound when moving to a new domain may also relax bounds
+  // implied by the rows, so they are propagated again
+  queueRows(col);
+}
+
+void HighsDomain::changeUpper(const int col, const double value) {
+  const HighsLp& mip = *mip_;
+  const double old_value = col_upper_[col];
+  for (int k = mip.Astart_[col]; k < mip.Astart_[col + 1]; k++) {
+    const int row = mip.Aindex_[k];
+    if (mip.Avalue_[k] > 0) {
+      updateActivity(mip.Avalue_[k], old_value, value, max_activity_[row],
+                     num_inf_max_activity_[row]);
+    } else {
+      updateActivity(mip.Avalue_[k], old_value, value, min_activity_[row],
+                     num_inf_min_activity_[row]);
+    }
+  }
+  col_upper_[col] = value;
+  queueRows(col);
+}
+
+void HighsDomain::queueRows(const int col) {
+  const HighsLp& mip = *mip_;
+  for (int k = mip.Astart_[col]; k < mip.Astart_[col + 1]; k++) {
+    const int row = mip.Aindex_[k];
+    if (row_queued_[row]) continue;
+    row_queued_[row] = 1;
+    row_queue_.push_back(row);
+  }
+  if (conflict_pool_ == nullptr) return;
+  if ((int)conflict_queued_.size() < conflict_pool_->getNumConflicts())
+    conflict_queued_.resize(conflict_pool_->getNumConflicts(), 0);
+  for (int conflict : conflict_pool_->getColConflicts(col)) {
+    if (conflict_queued_[conflict]) continue;
+    conflict_queued_[conflict] = 1;
+    conflict_queue_.push_back(conflict);
+  }
+}
+
+bool HighsDomain::tightenLower(const int col, double value) {
+  if (std::fabs(value) > mip_propagation_max_bound) return false;
+  const HighsLp& mip = *mip_;
+  const bool integer =
+      (int)mip.integrality_.size() == mip.numCol_ && mip.integrality_[col];
+  const double lower = col_lower_[col];
+  const double upper = col_upper_[col];
+  if (integer) {
+    value = std::ceil(value - mip_propagation_feasibility_tolerance);
+    if (value <= lower) return false;
+  } else if (lower > -HIGHS_CONST_INF) {
+    double width = upper < HIGHS_CONST_INF ? upper - lower : std::fabs(value);
+    width = std::max(width, 1.0);
+    if (value - lower <= mip_propagation_min_continuous_change * width)
+      return false;
+  }
+  if (value > upper + mip_propagation_feasibility_tolerance) {
+    infeasible_ = true;
+    return false;
+  }
+  // Fix the column rather than leave a tiny domain, which the LP
+  // solver handles badly
+  if (value > upper - mip_propagation_feasibility_tolerance) value = upper;
+  changeLower(col, value);
+  num_bound_changes_++;
+  return true;
+}
+
+bool HighsDomain::tightenUpper(const int col, double value) {
+  if (std::fabs(value) > mip_propagation_max_bound) return false;
+  const HighsLp& mip = *mip_;
+  const bool integer =
+      (int)mip.integrality_.size() == mip.numCol_ && mip.integrality_[col];
+  const double lower = col_lower_[col];
+  const double upper = col_upper_[col];
+  if (integer) {
+    value = std::floor(value + mip_propagation_feasibility_tolerance);
+    if (value >= upper) return false;
+  } else if (upper < HIGHS_CONST_INF) {
+    double width = lower > -HIGHS_CONST_INF ? upper - lower : std::fabs(value);
+    width = std::max(width, 1.0);
+    if (upper - value <= mip_propagation_min_continuous_change * width)
+      return false;
+  }
+  if (value < lower - mip_propagation_feasibility_tolerance) {
+    infeasible_ = true;
+    return false;
+  }
+  if (value < lower + mip_propagation_feasibility_tolerance) value = lower;
+  changeUpper(col, value);
+  num_bound_changes_++;
+  return true;
+}
+
+bool HighsDomain::propagateRow(const int row) {
+  const HighsLp& mip = *mip_;
+  const double row_lower = mip.rowLower_[row];
+  const double row_upper = mip.rowUpper_[row];
+  const double tolerance = mip_propagation_feasibility_tolerance;
+  if (num_inf_min_activity_[row] == 0 &&
+      min_activity_[row] > row_upper + tolerance)
+    return false;
+  if (num_inf_max_activity_[row] == 0 &&
+      max_activity_[row] < row_lower - tolerance)
+    return false;
+
+  // Bounds are implied only if at most one entry in the row has an
+  // infinite contribution to the relevant activity
+  if ((row_upper >= HIGHS_CONST_INF || num_inf_min_activity_[row] > 1) &&
+      (row_lower <= -HIGHS_CONST_INF || num_inf_max_activity_[row] > 1))
+    return true;
+  for (int k = ARstart_[row]; k < ARstart_[row + 1]; k++) {
+    const int col = ARindex_[k];
+    const double value = ARvalue_[k];
+    // With a finite row upper bound, the minimum activity of the
+    // other entries in the row bounds value * x[col] from above
+    if (row_upper < HIGHS_CONST_INF && num_inf_min_activity_[row] <= 1) {
+      const double bound = value > 0 ? col_lower_[col] : col_upper_[col];
+      const bool inf_bound = std::fabs(bound) >= HIGHS_CONST_INF;
+      if (inf_bound || num_inf_min_activity_[row] == 0) {
+        const double residual =
+            inf_bound ? min_activity_[row] : min_activity_[row] - value * bound;
+        const double implied = (row_upper - residual) / value;
+        if (value > 0) {
+          tightenUpper(col, implied);
+        } else {
+          tightenLower(col, implied);
+        }
+        if (infeasible_) return false;
+      }
+    }
+    // With a finite row lower bound, the maximum activity of the
+    // other entries in the row bounds value * x[col] from below
+    if (row_lower > -HIGHS_CONST_INF && num_inf_max_activity_[row] <= 1) {
+      const double bound = value > 0 ? col_upper_[col] : col_lower_[col];
+      const bool inf_bound = std::fabs(bound) >= HIGHS_CONST_INF;
+      if (inf_bound || num_inf_max_activity_[row] == 0) {
+        const double residual =
+            inf_bound ? max_activity_[row] : max_activity_[row] - value * bound;
+        const double implied = (row_lower - residual) / value;
+        if (value > 0) {
+          tightenLower(col, implied);
+        } else {
+          tightenUpper(col, implied);
+        }
+        if (infeasible_) return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool HighsDomain::propagateConflict(const int conflict) {
+  // If all but one literal of the conflict hold then the last one
+  // must not, and if they all hold the domain is infeasible
+  const std::vector<HighsConflictLiteral>& literals =
+      conflict_pool_->getConflict(conflict);
+  int num_free_literal = 0;
+  const HighsConflictLiteral* free_literal = nullptr;
+  for (const HighsConflictLiteral& literal : literals) {
+    const bool holds = literal.upper ? col_upper_[literal.col] <= literal.value
+                                     : col_lower_[literal.col] >= literal.value;
+    if (holds) continue;
+    if (++num_free_literal > 1) return true;
+    free_literal = &literal;
+  }
+  if (num_free_literal == 0) {
+    conflict_infeasible_ = true;
+    return false;
+  }
+  const HighsLp& mip = *mip_;
+  const int col = free_literal->col;
+  if ((int)mip.integrality_.size() != mip.numCol_ || !mip.integrality_[col])
+    return true;
+  if (free_literal->upper) {
+    tightenLower(col, free_literal->value + 1);
+  } else {
+    tightenUpper(col, free_literal->value - 1);
+  }
+  if (infeasible_) conflict_infeasible_ = true;
+  return !infeasible_;
+}
+
+bool HighsDomain::propagate(std::vector<double>& col_lower,
+                            std::vector<double>& col_upper) {
+  const HighsLp& mip = *mip_;
+  infeasible_ = false;
+  conflict_infeasible_ = false;
+  // Move to the new domain by changing only the bounds that differ
+  // from the current domain, unless it is time to recompute the row
+  // activities to remove any accumulated rounding error
+  if (++num_set_bounds_ % mip_propagation_recompute_frequency == 0) {
+    col_lower_ = col_lower;
+    col_upper_ = col_upper;
+    computeActivities();
+    for (int row = 0; row < mip.numRow_; row++) {
+      if (row_queued_[row]) continue;
+      row_queued_[row] = 1;
+      row_queue_.push_back(row);
+    }
+  } else {
+    for (int col = 0; col < mip.numCol_; col++) {
+      if (col_lower[col] != col_lower_[col]) changeLower(col, col_lower[col]);
+      if (col_upper[col] != col_upper_[col]) changeUpper(col, col_upper[col]);
+    }
+  }
+  for (int col = 0; col < mip.numCol_; col++) {
+    const double tolerance = mip_propagation_feasibility_tolerance;
+    if (col_lower_[col] > col_upper_[col] + tolerance) infeasible_ = true;
+  }
+
+  // Propagate the queued rows and conflicts, which may queue further
+  // rows and conflicts. Slow convergence of continuous bounds is cut
+  // off by a work limit
+  const int max_num_row_propagation =
+      mip_propagation_max_passes * std::max(mip.numRow_, 1);
+  int row_ix = 0;
+  int conflict_ix = 0;
+  while (row_ix < (int)row_queue_.size() ||
+         conflict_ix < (int)conflict_queue_.size()) {
+    for (; row_ix < (int)row_queue_.size(); row_ix++) {
+      const int row = row_queue_[row_ix];
+      row_queued_[row] = 0;
+      if (infeasible_ || row_ix >= max_num_row_propagation) continue;
+      if (!propagateRow(row)) infeasible_ = true;
+    }
+    for (; conflict_ix < (int)conflict_queue_.size(); conflict_ix++) {
+      const int conflict = conflict_queue_[conflict_ix];
+      conflict_queued_[conflict] = 0;
+      if (infeasible_) continue;
+      if (!propagateConflict(conflict)) infeasible_ = true;
+    }
+  }
+  row_queue_.clear();
+  conflict_queue_.clear();
+  if (infeasible_) return false;
+  col_lower = col_lower_;
+  col_upper = col_upper_;
+  return true;
+}
@@ -0,0 +1,97 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_DOMAIN_H_
+#define MIP_HIGHS_DOMAIN_H_
+
+#include <vector>
+
+#include "lp_data/HighsLp.h"
+#include "mip/HighsConflictPool.h"
+
+// Tolerance for bounds crossing and for rounding implied bounds of
+// integer columns
+const double mip_propagation_feasibility_tolerance = 1e-6;
+// Bounds on continuous columns are only tightened if the domain
+// shrinks by at least this fraction of its width
+const double mip_propagation_min_continuous_change = 0.05;
+// Implied bounds larger than this are not trusted
+const double mip_propagation_max_bound = 1e9;
+// Limit on the work in one call to propagate, as a multiple of the
+// number of rows
+const int mip_propagation_max_passes = 10;
+// Row activities are updated incrementally, so they are recomputed
+// from scratch every so many calls to propagate
+const int mip_propagation_recompute_frequency = 1000;
+
+// The domain of the columns of a MIP together with the minimum and
+// maximum activities of its rows. Each bound change updates the
+// activities of the rows in its column, and these rows are queued to
+// be propagated, possibly leading to further bound changes. Any
+// conflicts containing the column are queued and propagated too.
+class HighsDomain {
+ public:
+  void setup(const HighsLp& mip);
+  void setConflictPool(const HighsConflictPool* conflict_pool) {
+    conflict_pool_ = conflict_pool;
+  }
+
+  // Change the domain to the given bounds and propagate. Returns
+  // false if the domain is found to be infeasible, and otherwise
+  // returns the tightened bounds
+  bool propagate(std::vector<double>& col_lower,
+                 std::vector<double>& col_upper);
+
+  const std::vector<double>& getColLower() const { return col_lower_; }
+  const std::vector<double>& getColUpper() const { return col_upper_; }
+  double getMinActivity(const int row) const;
+  double getMaxActivity(const int row) const;
+  int getNumBoundChanges() const { return num_bound_changes_; }
+  // Whether the last infeasibility was detected by a conflict
+  bool isConflictInfeasible() const { return conflict_infeasible_; }
+
+ private:
+  void computeActivities();
+  void changeLower(const int col, const double value);
+  void changeUpper(const int col, const double value);
+  void updateActivity(const double coefficient, const double old_value,
+                      const double new_value, double& activity,
+                      int& num_inf) const;
+  void queueRows(const int col);
+  bool propagateRow(const int row);
+  bool propagateConflict(const int conflict);
+  bool tightenLower(const int col, double value);
+  bool tightenUpper(const int col, double value);
+
+  const HighsLp* mip_ = nullptr;
+  std::vector<int> ARstart_;
+  std::vector<int> ARindex_;
+  std::vector<double> ARvalue_;
+
+  std::vector<double> col_lower_;
+  std::vector<double> col_upper_;
+  // Finite parts of the row activity bounds, and the number of
+  // infinite contributions to each
+  std::vector<double> min_activity_;
+  std::vector<double> max_activity_;
+  std::vector<int> num_inf_min_activity_;
+  std::vector<int> num_inf_max_activity_;
+
+  std::vector<int> row_queue_;
+  std::vector<char> row_queued_;
+  const HighsConflictPool* conflict_pool_ = nullptr;
+  std::vector<int> conflict_queue_;
+  std::vector<char> conflict_queued_;
+  bool infeasible_ = false;
+  bool conflict_infeasible_ = false;
+  int num_set_bounds_ = 0;
+  int num_bound_changes_ = 0;
+};
+
+#endif
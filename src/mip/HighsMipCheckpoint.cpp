@@ -0,0 +1,251 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsMipCheckpoint.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+static const char mip_checkpoint_magic[8] = {'H', 'i', 'G', 'H',
+                                             'S', 'C', 'K', 'P'};
+
+// FNV-1a hash of a block of memory
+static void hashBytes(uint64_t& hash, const void* data, const size_t size) {
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  for (size_t ix = 0; ix < size; ix++) {
+    hash ^= bytes[ix];
+    hash *= 1099511628211ull;
+  }
+}
+
+template <typename T>
+static void hashVector(uint64_t& hash, const std::vector<T>& data) {
+  const size_t size = data.size();
+  hashBytes(hash, &size, sizeof(size));
+  if (size) hashBytes(hash, &data[0], size * sizeof(T));
+}
+
+uint64_t hashMipModel(const HighsLp& lp) {
+  uint64_t hash = 14695981039346656037ull;
+  const int sense = (int)lp.sense_;
+  hashBytes(hash, &lp.numCol_, sizeof(lp.numCol_));
+  hashBytes(hash, &lp.numRow_, sizeof(lp.numRow_));
+  hashBytes(hash, &sense, sizeof(sense));
+  hashBytes(hash, &lp.offset_, sizeof(lp.offset_));
+  hashVector(hash, lp.Astart_);
+  hashVector(hash, lp.Aindex_);
+  hashVector(hash, lp.Avalue_);
+  hashVector(hash, lp.colCost_);
+  hashVector(hash, lp.colLower_);
+  hashVector(hash, lp.colUpper_);
+  hashVector(hash, lp.rowLower_);
+  hashVector(hash, lp.rowUpper_);
+  hashVector(hash, lp.integrality_);
+  return hash;
+}
+
+// The checkpoint is serialized into a buffer in native byte order,
+// since it is only read back on the machine that wrote it
+template <typename T>
+static void put(std::string& buffer, const T& value) {
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+static void putVector(std::string& buffer, const std::vector<T>& data) {
+  put(buffer, (int)data.size());
+  if (data.size())
+    buffer.append(reinterpret_cast<const char*>(&data[0]),
+                  data.size() * sizeof(T));
+}
+
+template <typename T>
+static bool get(const std::string& buffer, size_t& pos, T& value) {
+  if (pos + sizeof(T) > buffer.size()) return false;
+  std::memcpy(&value, &buffer[pos], sizeof(T));
+  pos += sizeof(T);
+  return true;
+}
+
+template <typename T>
+static bool getVector(const std::string& buffer, size_t& pos,
+                      std::vector<T>& data) {
+  int size;
+  if (!get(buffer, pos, size) || size < 0) return false;
+  if (pos + size * sizeof(T) > buffer.size()) return false;
+  data.resize(size);
+  if (size) std::memcpy(&data[0], &buffer[pos], size * sizeof(T));
+  pos += size * sizeof(T);
+  return true;
+}
+
+bool writeMipCheckpoint(const std::string& filename,
+                        const HighsMipCheckpoint& checkpoint) {
+  std::string buffer;
+  buffer.append(mip_checkpoint_magic, sizeof(mip_checkpoint_magic));
+  put(buffer, mip_checkpoint_version);
+  put(buffer, checkpoint.model_hash);
+  put(buffer, checkpoint.num_nodes_formed);
+  put(buffer, checkpoint.num_nodes_solved);
+  put(buffer, checkpoint.num_nodes_pruned);
+  put(buffer, checkpoint.num_integer_solutions);
+  put(buffer, checkpoint.best_objective);
+  putVector(buffer, checkpoint.best_solution);
+
+  put(buffer, (int)checkpoint.nodes.size());
+  for (const HighsCheckpointNode& node : checkpoint.nodes) {
+    put(buffer, node.id);
+    put(buffer, node.parent_id);
+    put(buffer, node.level);
+    put(buffer, node.branch_col);
+    put(buffer, node.parent_objective);
+    putVector(buffer, node.index);
+    putVector(buffer, node.lower);
+    putVector(buffer, node.upper);
+  }
+
+  put(buffer, (int)checkpoint.cuts.size());
+  for (const HighsCheckpointCut& cut : checkpoint.cuts) {
+    putVector(buffer, cut.index);
+    putVector(buffer, cut.value);
+    put(buffer, cut.lower);
+  }
+
+  put(buffer, (int)checkpoint.conflicts.size());
+  for (const std::vector<HighsConflictLiteral>& conflict :
+       checkpoint.conflicts) {
+    put(buffer, (int)conflict.size());
+    for (const HighsConflictLiteral& literal : conflict) {
+      put(buffer, literal.col);
+      put(buffer, (char)literal.upper);
+      put(buffer, literal.value);
+    }
+  }
+
+  // Write to a temporary file and then replace any previous
+  // checkpoint with it
+  const std::string temp_filename = filename + ".tmp";
+  FILE* file = fopen(temp_filename.c_str(), "wb");
+  if (file == NULL) return false;
+  bool ok = fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+  ok = fclose(file) == 0 && ok;
+  if (!ok) {
+    remove(temp_filename.c_str());
+    return false;
+  }
+  if (rename(temp_filename.c_str(), filename.c_str()) != 0) {
+    // Renaming onto an existing file fails on some platforms
+    remove(filename.c_str());
+    if (rename(temp_filename.c_str(), filename.c_str()) != 0) return false;
+  }
+  return true;
+}
+
+bool readMipCheckpoint(const std::string& filename,
+                       HighsMipCheckpoint& checkpoint) {
+  FILE* file = fopen(filename.c_str(), "rb");
+  if (file == NULL) return false;
+  std::string buffer;
+  char block[65536];
+  size_t num_read;
+  while ((num_read = fread(block, 1, sizeof(block), file)) > 0)
+    buffer.append(block, num_read);
+  fclose(file);
+
+  size_t pos = sizeof(mip_checkpoint_magic);
+  if (buffer.size() < pos ||
+      std::memcmp(&buffer[0], mip_checkpoint_magic, pos) != 0)
+    return false;
+  int version;
+  if (!get(buffer, pos, version) || version != mip_checkpoint_version)
+    return false;
+  if (!get(buffer, pos, checkpoint.model_hash) ||
+      !get(buffer, pos, checkpoint.num_nodes_formed) ||
+      !get(buffer, pos, checkpoint.num_nodes_solved) ||
+      !get(buffer, pos, checkpoint.num_nodes_pruned) ||
+      !get(buffer, pos, checkpoint.num_integer_solutions) ||
+      !get(buffer, pos, checkpoint.best_objective) ||
+      !getVector(buffer, pos, checkpoint.best_solution))
+    return false;
+
+  int num_nodes;
+  if (!get(buffer, pos, num_nodes) || num_nodes < 0) return false;
+  checkpoint.nodes.clear();
+  for (int ix = 0; ix < num_nodes; ix++) {
+    HighsCheckpointNode node;
+    if (!get(buffer, pos, node.id) || !get(buffer, pos, node.parent_id) ||
+        !get(buffer, pos, node.level) || !get(buffer, pos, node.branch_col) ||
+        !get(buffer, pos, node.parent_objective) ||
+        !getVector(buffer, pos, node.index) ||
+        !getVector(buffer, pos, node.lower) ||
+        !getVector(buffer, pos, node.upper))
+      return false;
+    if (node.lower.size() != node.index.size() ||
+        node.upper.size() != node.index.size())
+      return false;
+    checkpoint.nodes.push_back(std::move(node));
+  }
+
+  int num_cuts;
+  if (!get(buffer, pos, num_cuts) || num_cuts < 0) return false;
+  checkpoint.cuts.clear();
+  for (int ix = 0; ix < num_cuts; ix++) {
+    HighsCheckpointCut cut;
+    if (!getVector(buffer, pos, cut.index) ||
+        !getVector(buffer, pos, cut.value) || !get(buffer, pos, cut.lower))
+      return false;
+    if (cut.value.size() != cut.index.size()) return false;
+    checkpoint.cuts.push_back(std::move(cut));
+  }
+
+  int num_conflicts;
+  if (!get(buffer, pos, num_conflicts) || num_conflicts < 0) return false;
+  checkpoint.conflicts.clear();
+  for (int ix = 0; ix < num_conflicts; ix++) {
+    int num_literals;
+    if (!get(buffer, pos, num_literals) || num_literals < 0) return false;
+    std::vector<HighsConflictLiteral> conflict(num_literals);
+    for (HighsConflictLiteral& literal : conflict) {
+      char upper;
+      if (!get(buffer, pos, literal.col) || !get(buffer, pos, upper) ||
+          !get(buffer, pos, literal.value))
+        return false;
+      literal.upper = upper != 0;
+    }
+    checkpoint.conflicts.push_back(std::move(conflict));
+  }
+  return pos == buffer.size();
+}
+
+bool HighsMipCheckpointWriter::busy() const {
+  return pending_.valid() && pending_.wait_for(std::chrono::seconds(0)) !=
+                                 std::future_status::ready;
+}
+
+void HighsMipCheckpointWriter::write(const std::string& filename,
+                                     HighsMipCheckpoint checkpoint) {
+  wait();
+  pending_ = std::async(
+      std::launch::async,
+      [filename](const HighsMipCheckpoint& checkpoint) {
+        return writeMipCheckpoint(filename, checkpoint);
+      },
+      std::move(checkpoint));
+}
+
+void HighsMipCheckpointWriter::wait() {
+  if (!pending_.valid()) return;
+  if (pending_.get()) {
+    num_written_++;
+  } else {
+    num_failed_++;
+  }
+}
@@ -0,0 +1,93 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_MIP_CHECKPOINT_H_
+#define MIP_HIGHS_MIP_CHECKPOINT_H_
+
+#include <cstdint>
+#include <future>
+#include <string>
+#include <vector>
+
+#include "lp_data/HConst.h"
+#include "lp_data/HighsLp.h"
+#include "mip/HighsConflictPool.h"
+
+// Checkpoints written by a different version of the format are ignored
+const int mip_checkpoint_version = 1;
+
+// An open node, with the column bounds that differ from those of the
+// model
+struct HighsCheckpointNode {
+  int id;
+  int parent_id;
+  int level;
+  int branch_col;
+  double parent_objective;
+  std::vector<int> index;
+  std::vector<double> lower;
+  std::vector<double> upper;
+};
+
+struct HighsCheckpointCut {
+  std::vector<int> index;
+  std::vector<double> value;
+  double lower;
+};
+
+// The state of the branch-and-bound tree search from which a later
+// run on the same model can continue
+struct HighsMipCheckpoint {
+  uint64_t model_hash = 0;
+  int num_nodes_formed = 0;
+  int num_nodes_solved = 0;
+  int num_nodes_pruned = 0;
+  int num_integer_solutions = 0;
+  double best_objective = HIGHS_CONST_INF;
+  std::vector<double> best_solution;
+  std::vector<HighsCheckpointNode> nodes;
+  std::vector<HighsCheckpointCut> cuts;
+  std::vector<std::vector<HighsConflictLiteral>> conflicts;
+};
+
+// Identifies the model, so that a checkpoint is only used to resume
+// the run that wrote it
+uint64_t hashMipModel(const HighsLp& lp);
+
+bool writeMipCheckpoint(const std::string& filename,
+                        const HighsMipCheckpoint& checkpoint);
+// Returns false if the file cannot be read or is not a checkpoint
+bool readMipCheckpoint(const std::string& filename,
+                       HighsMipCheckpoint& checkpoint);
+
+// Writes checkpoints in a background thread so that the tree search
+// is not stalled. Each checkpoint is written to a temporary file that
+// then replaces the previous one, so a run killed while writing
+// leaves the previous checkpoint intact.
+class HighsMipCheckpointWriter {
+ public:
+  ~HighsMipCheckpointWriter() { wait(); }
+
+  // Whether the previous checkpoint is still being written
+  bool busy() const;
+  // Start writing the checkpoint, first waiting for the previous one
+  void write(const std::string& filename, HighsMipCheckpoint checkpoint);
+  // Wait for the checkpoint being written, if any
+  void wait();
+
+  int getNumWritten() const { return num_written_; }
+  int getNumFailed() const { return num_failed_; }
+
+ private:
+  std::future<bool> pending_;
+  int num_written_ = 0;
+  int num_failed_ = 0;
+};
+
+#endif
@@ -0,0 +1,270 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsMipHeuristics.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "io/HighsIO.h"
+#include "lp_data/HConst.h"
+
+HighsMipHeuristicStats::HighsMipHeuristicStats() {
+  records_.resize((int)HighsMipHeuristic::kCount);
+  records_[(int)HighsMipHeuristic::kSimpleRounding].name = "Simple rounding";
+  records_[(int)HighsMipHeuristic::kShiftRounding].name = "Shift rounding";
+  records_[(int)HighsMipHeuristic::kFractionalDiving].name =
+      "Fractional diving";
+  records_[(int)HighsMipHeuristic::kCoefficientDiving].name =
+      "Coefficient diving";
+  records_[(int)HighsMipHeuristic::kRins].name = "RINS";
+}
+
+double HighsMipHeuristicStats::successRate(
+    const HighsMipHeuristicRecord& record) const {
+  return (record.num_success + 1.0) / (record.num_call + 2.0);
+}
+
+bool HighsMipHeuristicStats::allowCall(const HighsMipHeuristic heuristic,
+                                       const double effort,
+                                       const double elapsed_time) const {
+  if (effort <= 0) return false;
+  const HighsMipHeuristicRecord& record = records_[(int)heuristic];
+  // Every heuristic gets one chance
+  if (record.num_call == 0) return true;
+  // Otherwise share the budget according to success rates
+  double sum_success_rate = 0;
+  for (const HighsMipHeuristicRecord& other : records_)
+    sum_success_rate += successRate(other);
+  const double budget =
+      effort * elapsed_time * successRate(record) / sum_success_rate;
+  return record.time <= budget;
+}
+
+void HighsMipHeuristicStats::recordCall(const HighsMipHeuristic heuristic,
+                                        const double time,
+                                        const bool success) {
+  HighsMipHeuristicRecord& record = records_[(int)heuristic];
+  record.num_call++;
+  if (success) record.num_success++;
+  record.time += time;
+}
+
+double HighsMipHeuristicStats::getTotalTime() const {
+  double total_time = 0;
+  for (const HighsMipHeuristicRecord& record : records_)
+    total_time += record.time;
+  return total_time;
+}
+
+void HighsMipHeuristicStats::report(FILE* output,
+                                    const int message_level) const {
+  HighsPrintMessage(
+      output, message_level, ML_MINIMAL,
+      "Heuristic            |     Calls | Successes |     Time\n");
+  for (const HighsMipHeuristicRecord& record : records_)
+    HighsPrintMessage(output, message_level, ML_MINIMAL,
+                      "%-20s | %9d | %9d | %8.3f\n", record.name.c_str(),
+                      record.num_call, record.num_success, record.time);
+}
+
+void HighsMipRounding::setup(const HighsLp& mip) {
+  mip_ = &mip;
+  const int numCol = mip.numCol_;
+  const int numRow = mip.numRow_;
+
+  // Form the row-wise copy of the matrix
+  ARstart_.assign(numRow + 1, 0);
+  ARindex_.resize(mip.Astart_[numCol]);
+  ARvalue_.resize(mip.Astart_[numCol]);
+  for (int k = 0; k < mip.Astart_[numCol]; k++) ARstart_[mip.Aindex_[k] + 1]++;
+  for (int row = 0; row < numRow; row++) ARstart_[row + 1] += ARstart_[row];
+  std::vector<int> row_fill(ARstart_.begin(), ARstart_.end() - 1);
+  for (int col = 0; col < numCol; col++) {
+    for (int k = mip.Astart_[col]; k < mip.Astart_[col + 1]; k++) {
+      const int put = row_fill[mip.Aindex_[k]]++;
+      ARindex_[put] = col;
+      ARvalue_[put] = mip.Avalue_[k];
+    }
+  }
+
+  // Count the locks: decreasing a column with a positive coefficient
+  // may violate a finite row lower bound, and so on.
+  down_locks_.assign(numCol, 0);
+  up_locks_.assign(numCol, 0);
+  for (int col = 0; col < numCol; col++) {
+    for (int k = mip.Astart_[col]; k < mip.Astart_[col + 1]; k++) {
+      const int row = mip.Aindex_[k];
+      const bool has_lower = mip.rowLower_[row] > -HIGHS_CONST_INF;
+      const bool has_upper = mip.rowUpper_[row] < HIGHS_CONST_INF;
+      if (mip.Avalue_[k] > 0) {
+        if (has_lower) down_locks_[col]++;
+        if (has_upper) up_locks_[col]++;
+      } else {
+        if (has_upper) down_locks_[col]++;
+        if (has_lower) up_locks_[col]++;
+      }
+    }
+  }
+}
+
+void HighsMipRounding::computeRowActivities(
+    const std::vector<double>& solution,
+    std::vector<double>& row_activity) const {
+  const HighsLp& mip = *mip_;
+  row_activity.assign(mip.numRow_, 0);
+  for (int col = 0; col < mip.numCol_; col++) {
+    if (solution[col] == 0) continue;
+    for (int k = mip.Astart_[col]; k < mip.Astart_[col + 1]; k++)
+      row_activity[mip.Aindex_[k]] += mip.Avalue_[k] * solution[col];
+  }
+}
+
+double HighsMipRounding::rowViolation(const int row,
+                                      const double activity) const {
+  if (activity < mip_->rowLower_[row]) return mip_->rowLower_[row] - activity;
+  if (activity > mip_->rowUpper_[row]) return activity - mip_->rowUpper_[row];
+  return 0;
+}
+
+bool HighsMipRounding::isFeasible(const std::vector<double>& solution) const {
+  const HighsLp& mip = *mip_;
+  const bool have_integrality = (int)mip.integrality_.size() == mip.numCol_;
+  for (int col = 0; col < mip.numCol_; col++) {
+    const double tolerance = mip_heuristic_feasibility_tolerance;
+    if (solution[col] < mip.colLower_[col] - tolerance) return false;
+    if (solution[col] > mip.colUpper_[col] + tolerance) return false;
+    if (have_integrality && mip.integrality_[col] &&
+        isFractional(solution[col]))
+      return false;
+  }
+  std::vector<double> row_activity;
+  computeRowActivities(solution, row_activity);
+  for (int row = 0; row < mip.numRow_; row++)
+    if (rowViolation(row, row_activity[row]) >
+        mip_heuristic_feasibility_tolerance)
+      return false;
+  return true;
+}
+
+bool HighsMipRounding::isFractional(const double value) {
+  return std::fabs(value - std::floor(value + 0.5)) >
+         mip_heuristic_integrality_tolerance;
+}
+
+double HighsMipRounding::objectiveValue(
+    const std::vector<double>& solution) const {
+  double objective = mip_->offset_;
+  for (int col = 0; col < mip_->numCol_; col++)
+    objective += mip_->colCost_[col] * solution[col];
+  return objective;
+}
+
+bool HighsMipRounding::simpleRounding(const std::vector<double>& col_lower,
+                                      const std::vector<double>& col_upper,
+                                      const std::vector<double>& value,
+                                      std::vector<double>& solution) const {
+  // Round each fractional integer variable in a direction in which
+  // it has no locks, so an LP-feasible point stays feasible
+  const HighsLp& mip = *mip_;
+  const bool have_integrality = (int)mip.integrality_.size() == mip.numCol_;
+  solution = value;
+  for (int col = 0; col < mip.numCol_; col++) {
+    if (!have_integrality || !mip.integrality_[col]) continue;
+    if (!isFractional(value[col])) {
+      solution[col] = std::floor(value[col] + 0.5);
+      continue;
+    }
+    if (down_locks_[col] == 0 && std::floor(value[col]) >= col_lower[col]) {
+      solution[col] = std::floor(value[col]);
+    } else if (up_locks_[col] == 0 &&
+               std::ceil(value[col]) <= col_upper[col]) {
+      solution[col] = std::ceil(value[col]);
+    } else {
+      return false;
+    }
+  }
+  return isFeasible(solution);
+}
+
+bool HighsMipRounding::shiftRounding(const std::vector<double>& col_lower,
+                                     const std::vector<double>& col_upper,
+                                     const std::vector<double>& value,
+                                     std::vector<double>& solution) const {
+  const HighsLp& mip = *mip_;
+  const bool have_integrality = (int)mip.integrality_.size() == mip.numCol_;
+  solution = value;
+  std::vector<double> row_activity;
+  computeRowActivities(solution, row_activity);
+
+  // Change in the total row violation if col is moved by delta
+  auto violationChange = [&](const int col, const double delta) {
+    double change = 0;
+    for (int k = mip.Astart_[col]; k < mip.Astart_[col + 1]; k++) {
+      const int row = mip.Aindex_[k];
+      const double activity = row_activity[row];
+      change += rowViolation(row, activity + mip.Avalue_[k] * delta) -
+                rowViolation(row, activity);
+    }
+    return change;
+  };
+  auto applyShift = [&](const int col, const double delta) {
+    solution[col] += delta;
+    for (int k = mip.Astart_[col]; k < mip.Astart_[col + 1]; k++)
+      row_activity[mip.Aindex_[k]] += mip.Avalue_[k] * delta;
+  };
+
+  // Round each fractional integer variable in the direction that
+  // increases the total violation least, breaking ties by cost
+  for (int col = 0; col < mip.numCol_; col++) {
+    if (!have_integrality || !mip.integrality_[col]) continue;
+    const double down_value = std::max(std::floor(value[col]), col_lower[col]);
+    const double up_value = std::min(std::ceil(value[col]), col_upper[col]);
+    if (!isFractional(value[col])) {
+      applyShift(col, std::floor(value[col] + 0.5) - solution[col]);
+      continue;
+    }
+    const double down_delta = down_value - solution[col];
+    const double up_delta = up_value - solution[col];
+    const double down_change = violationChange(col, down_delta);
+    const double up_change = violationChange(col, up_delta);
+    bool round_down;
+    if (std::fabs(down_change - up_change) >
+        mip_heuristic_feasibility_tolerance) {
+      round_down = down_change < up_change;
+    } else {
+      round_down =
+          mip.colCost_[col] * down_delta <= mip.colCost_[col] * up_delta;
+    }
+    applyShift(col, round_down ? down_delta : up_delta);
+  }
+
+  // Try to repair violated rows by shifting one of their variables
+  // by the amount needed, provided that the total violation reduces
+  for (int row = 0; row < mip.numRow_; row++) {
+    for (int k = ARstart_[row]; k < ARstart_[row + 1]; k++) {
+      const double violation = rowViolation(row, row_activity[row]);
+      if (violation <= mip_heuristic_feasibility_tolerance) break;
+      const double direction = row_activity[row] < mip.rowLower_[row] ? 1 : -1;
+      const int col = ARindex_[k];
+      double delta = direction * violation / ARvalue_[k];
+      if (have_integrality && mip.integrality_[col]) {
+        const double tolerance = mip_heuristic_integrality_tolerance;
+        delta = delta > 0 ? std::ceil(delta - tolerance)
+                          : std::floor(delta + tolerance);
+      }
+      if (delta == 0) continue;
+      const double new_value = solution[col] + delta;
+      if (new_value < col_lower[col] || new_value > col_upper[col]) continue;
+      if (violationChange(col, delta) < -mip_heuristic_feasibility_tolerance)
+        applyShift(col, delta);
+    }
+  }
+  return isFeasible(solution);
+}
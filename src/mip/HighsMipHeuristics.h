@@ -0,0 +1,105 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_MIP_HEURISTICS_H_
+#define MIP_HIGHS_MIP_HEURISTICS_H_
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "lp_data/HighsLp.h"
+
+enum class HighsMipHeuristic {
+  kSimpleRounding = 0,
+  kShiftRounding,
+  kFractionalDiving,
+  kCoefficientDiving,
+  kRins,
+  kCount
+};
+
+// Tolerances and limits used by the primal heuristics
+const double mip_heuristic_feasibility_tolerance = 1e-6;
+const double mip_heuristic_integrality_tolerance = 1e-6;
+// Dives and RINS are only considered every so many nodes in the tree
+const int mip_heuristic_node_frequency = 10;
+const int mip_dive_max_lp_solves = 100;
+// RINS is only worthwhile if enough integer variables agree
+const double mip_rins_min_fixed_fraction = 0.3;
+
+struct HighsMipHeuristicRecord {
+  std::string name;
+  int num_call = 0;
+  int num_success = 0;
+  double time = 0;
+};
+
+// Statistics of calls to the primal heuristics. A heuristic's share of
+// the time budget grows with its success rate, so heuristics that pay
+// off on a particular model are called more often.
+class HighsMipHeuristicStats {
+ public:
+  HighsMipHeuristicStats();
+
+  bool allowCall(const HighsMipHeuristic heuristic, const double effort,
+                 const double elapsed_time) const;
+  void recordCall(const HighsMipHeuristic heuristic, const double time,
+                  const bool success);
+  double getTotalTime() const;
+  const HighsMipHeuristicRecord& getRecord(
+      const HighsMipHeuristic heuristic) const {
+    return records_[(int)heuristic];
+  }
+  void report(FILE* output, const int message_level) const;
+
+ private:
+  double successRate(const HighsMipHeuristicRecord& record) const;
+
+  std::vector<HighsMipHeuristicRecord> records_;
+};
+
+// Rounding of LP solutions for the original MIP. The row-wise copy
+// of the matrix and the up/down locks of each column are set up once.
+class HighsMipRounding {
+ public:
+  void setup(const HighsLp& mip);
+
+  bool simpleRounding(const std::vector<double>& col_lower,
+                      const std::vector<double>& col_upper,
+                      const std::vector<double>& value,
+                      std::vector<double>& solution) const;
+  bool shiftRounding(const std::vector<double>& col_lower,
+                     const std::vector<double>& col_upper,
+                     const std::vector<double>& value,
+                     std::vector<double>& solution) const;
+
+  bool isFeasible(const std::vector<double>& solution) const;
+  double objectiveValue(const std::vector<double>& solution) const;
+
+  static bool isFractional(const double value);
+
+  // Number of rows that may be violated by decreasing/increasing a column
+  const std::vector<int>& getDownLocks() const { return down_locks_; }
+  const std::vector<int>& getUpLocks() const { return up_locks_; }
+
+ private:
+  void computeRowActivities(const std::vector<double>& solution,
+                            std::vector<double>& row_activity) const;
+  double rowViolation(const int row, const double activity) const;
+
+  const HighsLp* mip_ = nullptr;
+  std::vector<int> ARstart_;
+  std::vector<int> ARindex_;
+  std::vector<double> ARvalue_;
+  std::vector<int> down_locks_;
+  std::vector<int> up_locks_;
+};
+
+#endif
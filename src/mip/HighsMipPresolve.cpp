@@ -0,0 +1,568 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsMipPresolve.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <set>
+#include <string>
+#include <utility>
+
+#include "io/HighsIO.h"
+#include "lp_data/HConst.h"
+#include "mip/HighsDomain.h"
+
+using presolve::PresolveRule;
+using presolve::PresolveRuleInfo;
+
+HighsPresolveStatus HighsMipPresolve::run(const HighsLp& mip) {
+  num_rows_removed_ = 0;
+  HighsPresolveStatus status = presolve(mip);
+  postsolve_col_map_ = col_map_;
+  postsolve_fixed_value_ = fixed_value_;
+  return status;
+}
+
+HighsPresolveStatus HighsMipPresolve::restart(const HighsLp& reduced_mip) {
+  if (postsolve_col_map_.size() == 0) {
+    // The MIP was not presolved before the restart
+    postsolve_col_map_.resize(reduced_mip.numCol_);
+    for (int col = 0; col < reduced_mip.numCol_; col++)
+      postsolve_col_map_[col] = col;
+    postsolve_fixed_value_.assign(reduced_mip.numCol_, 0);
+  }
+  assert((int)postsolve_col_map_.size() == reduced_mip.numCol_);
+  HighsPresolveStatus status = presolve(reduced_mip);
+  if (status != HighsPresolveStatus::Reduced) return status;
+
+  // Compose the column maps, so that postsolve still recovers a
+  // solution of the original MIP
+  for (int col = 0; col < reduced_mip.numCol_; col++)
+    postsolve_fixed_value_[postsolve_col_map_[col]] = fixed_value_[col];
+  std::vector<int> col_map(col_map_.size());
+  for (int col = 0; col < (int)col_map_.size(); col++)
+    col_map[col] = postsolve_col_map_[col_map_[col]];
+  postsolve_col_map_.swap(col_map);
+  return status;
+}
+
+HighsPresolveStatus HighsMipPresolve::presolve(const HighsLp& mip) {
+  mip_ = mip;
+  reduced_mip_ = mip;
+  col_map_.resize(mip.numCol_);
+  reduced_col_.resize(mip.numCol_);
+  for (int col = 0; col < mip.numCol_; col++) {
+    col_map_[col] = col;
+    reduced_col_[col] = col;
+  }
+  fixed_value_.assign(mip.numCol_, 0);
+  cliques_.clear();
+  if ((int)mip.integrality_.size() != mip.numCol_ || mip.numCol_ == 0)
+    return HighsPresolveStatus::NotReduced;
+
+  if (!roundIntegerBounds()) return HighsPresolveStatus::Infeasible;
+  formRowwiseMatrix();
+  tightenCoefficients();
+  if (!probe()) return HighsPresolveStatus::Infeasible;
+  extractCliques();
+  if (!formReducedMip()) return HighsPresolveStatus::Infeasible;
+  timer_.updateInfo();
+
+  const std::vector<PresolveRule> rules = {
+      presolve::MIP_BOUND_ROUNDING, presolve::MIP_COEFFICIENT_TIGHTENING,
+      presolve::MIP_PROBING, presolve::MIP_CLIQUE};
+  bool reduced = getNumColsRemoved() > 0 || getNumRowsRemoved() > 0;
+  for (PresolveRule rule : rules)
+    if (timer_.getRuleInfo(rule).count_applied > 0) reduced = true;
+  return reduced ? HighsPresolveStatus::Reduced
+                 : HighsPresolveStatus::NotReduced;
+}
+
+void HighsMipPresolve::postsolve(const std::vector<double>& reduced_solution,
+                                 std::vector<double>& solution) const {
+  solution = postsolve_fixed_value_;
+  for (int col = 0; col < (int)postsolve_col_map_.size(); col++)
+    solution[postsolve_col_map_[col]] = reduced_solution[col];
+}
+
+void HighsMipPresolve::reduceSolution(
+    const std::vector<double>& solution,
+    std::vector<double>& reduced_solution) const {
+  reduced_solution.resize(col_map_.size());
+  for (int col = 0; col < (int)col_map_.size(); col++)
+    reduced_solution[col] = solution[col_map_[col]];
+}
+
+bool HighsMipPresolve::reduceCut(std::vector<int>& index,
+                                 std::vector<double>& value,
+                                 double& lower) const {
+  int num_kept = 0;
+  for (int ix = 0; ix < (int)index.size(); ix++) {
+    const int col = index[ix];
+    if (reduced_col_[col] < 0) {
+      lower -= value[ix] * fixed_value_[col];
+      continue;
+    }
+    index[num_kept] = reduced_col_[col];
+    value[num_kept] = value[ix];
+    num_kept++;
+  }
+  index.resize(num_kept);
+  value.resize(num_kept);
+  return num_kept > 0;
+}
+
+int HighsMipPresolve::getNumColsRemoved() const {
+  return (int)postsolve_fixed_value_.size() - (int)postsolve_col_map_.size();
+}
+
+int HighsMipPresolve::getNumRowsRemoved() const { return num_rows_removed_; }
+
+void HighsMipPresolve::report(FILE* output, const int message_level) const {
+  const std::vector<PresolveRule> rules = {
+      presolve::MIP_BOUND_ROUNDING, presolve::MIP_COEFFICIENT_TIGHTENING,
+      presolve::MIP_PROBING,        presolve::MIP_CLIQUE,
+      presolve::FIXED_COL,          presolve::REDUNDANT_ROW,
+      presolve::EMPTY_ROW};
+  HighsPrintMessage(
+      output, message_level, ML_MINIMAL,
+      "Presolve rule        |   Applied | Rows rmvd | Cols rmvd |     Time\n");
+  for (PresolveRule rule : rules) {
+    const PresolveRuleInfo& info = timer_.getRuleInfo(rule);
+    HighsPrintMessage(output, message_level, ML_MINIMAL,
+                      "%-20s | %9d | %9d | %9d | %8.3f\n",
+                      info.rule_name.c_str(), info.count_applied,
+                      info.rows_removed, info.cols_removed, info.total_time);
+  }
+}
+
+bool HighsMipPresolve::isInteger(const int col) const {
+  return mip_.integrality_[col] != 0;
+}
+
+bool HighsMipPresolve::isBinary(const int col) const {
+  return isInteger(col) && mip_.colLower_[col] == 0 &&
+         mip_.colUpper_[col] == 1;
+}
+
+void HighsMipPresolve::formRowwiseMatrix() {
+  const int numCol = mip_.numCol_;
+  const int numRow = mip_.numRow_;
+  const int num_nz = mip_.Astart_[numCol];
+  ARstart_.assign(numRow + 1, 0);
+  ARindex_.resize(num_nz);
+  ARposition_.resize(num_nz);
+  for (int k = 0; k < num_nz; k++) ARstart_[mip_.Aindex_[k] + 1]++;
+  for (int row = 0; row < numRow; row++) ARstart_[row + 1] += ARstart_[row];
+  std::vector<int> row_fill(ARstart_.begin(), ARstart_.end() - 1);
+  for (int col = 0; col < numCol; col++) {
+    for (int k = mip_.Astart_[col]; k < mip_.Astart_[col + 1]; k++) {
+      const int put = row_fill[mip_.Aindex_[k]]++;
+      ARindex_[put] = col;
+      ARposition_[put] = k;
+    }
+  }
+}
+
+bool HighsMipPresolve::roundIntegerBounds() {
+  timer_.recordStart(presolve::MIP_BOUND_ROUNDING);
+  const double tolerance = mip_propagation_feasibility_tolerance;
+  bool feasible = true;
+  for (int col = 0; col < mip_.numCol_; col++) {
+    double& lower = mip_.colLower_[col];
+    double& upper = mip_.colUpper_[col];
+    if (isInteger(col)) {
+      const double rounded_lower =
+          lower > -HIGHS_CONST_INF ? std::ceil(lower - tolerance) : lower;
+      const double rounded_upper =
+          upper < HIGHS_CONST_INF ? std::floor(upper + tolerance) : upper;
+      if (rounded_lower != lower) {
+        lower = rounded_lower;
+        timer_.addChange(presolve::MIP_BOUND_ROUNDING);
+      }
+      if (rounded_upper != upper) {
+        upper = rounded_upper;
+        timer_.addChange(presolve::MIP_BOUND_ROUNDING);
+      }
+    }
+    if (lower > upper + tolerance) feasible = false;
+  }
+  timer_.recordFinish(presolve::MIP_BOUND_ROUNDING);
+  return feasible;
+}
+
+void HighsMipPresolve::tightenCoefficients() {
+  // Write a one-sided row as sum_j a_j x_j <= b with maximum activity
+  // M > b. If a_j > 0 for an integer column x_j and the row is
+  // redundant when x_j <= u_j - 1, that is if d = b - (M - a_j) > 0,
+  // then a_j can be reduced by d and b by d * u_j without changing
+  // the integer solutions of the row, while tightening its LP
+  // relaxation. Similarly if a_j < 0 and the row is redundant when
+  // x_j >= l_j + 1.
+  timer_.recordStart(presolve::MIP_COEFFICIENT_TIGHTENING);
+  const double tolerance = mip_propagation_feasibility_tolerance;
+  for (int row = 0; row < mip_.numRow_; row++) {
+    const bool has_lower = mip_.rowLower_[row] > -HIGHS_CONST_INF;
+    const bool has_upper = mip_.rowUpper_[row] < HIGHS_CONST_INF;
+    if (has_lower == has_upper) continue;
+    const double sign = has_upper ? 1 : -1;
+    double rhs = has_upper ? mip_.rowUpper_[row] : -mip_.rowLower_[row];
+    double max_activity = 0;
+    bool finite = true;
+    for (int k = ARstart_[row]; k < ARstart_[row + 1]; k++) {
+      const int col = ARindex_[k];
+      const double value = sign * mip_.Avalue_[ARposition_[k]];
+      const double bound =
+          value > 0 ? mip_.colUpper_[col] : mip_.colLower_[col];
+      if (std::fabs(bound) >= HIGHS_CONST_INF) {
+        finite = false;
+        break;
+      }
+      max_activity += value * bound;
+    }
+    if (!finite || max_activity <= rhs + tolerance) continue;
+
+    bool tightened = false;
+    for (int k = ARstart_[row]; k < ARstart_[row + 1]; k++) {
+      const int col = ARindex_[k];
+      if (!isInteger(col) || mip_.colLower_[col] == mip_.colUpper_[col])
+        continue;
+      const double value = sign * mip_.Avalue_[ARposition_[k]];
+      const double reduction = rhs - (max_activity - std::fabs(value));
+      if (reduction <= tolerance * std::max(1.0, std::fabs(value))) continue;
+      const double bound =
+          value > 0 ? mip_.colUpper_[col] : mip_.colLower_[col];
+      const double new_value =
+          value > 0 ? value - reduction : value + reduction;
+      rhs -= (value - new_value) * bound;
+      max_activity -= (value - new_value) * bound;
+      mip_.Avalue_[ARposition_[k]] = sign * new_value;
+      timer_.addChange(presolve::MIP_COEFFICIENT_TIGHTENING);
+      tightened = true;
+    }
+    if (!tightened) continue;
+    if (has_upper) {
+      mip_.rowUpper_[row] = rhs;
+    } else {
+      mip_.rowLower_[row] = -rhs;
+    }
+  }
+  timer_.recordFinish(presolve::MIP_COEFFICIENT_TIGHTENING);
+}
+
+bool HighsMipPresolve::probe() {
+  // Propagate each value of a binary column. If both are infeasible
+  // then so is the MIP, and if one is infeasible then the column is
+  // fixed at the other value. Otherwise the bounds of each column are
+  // the weaker of its bounds in the two cases
+  timer_.recordStart(presolve::MIP_PROBING);
+  const int numCol = mip_.numCol_;
+  HighsDomain domain;
+  domain.setup(mip_);
+  std::vector<double> col_lower = mip_.colLower_;
+  std::vector<double> col_upper = mip_.colUpper_;
+  bool feasible = domain.propagate(col_lower, col_upper);
+
+  // Probe on the longest columns first, since they have most
+  // implications
+  std::vector<std::pair<int, int>> candidates;
+  for (int col = 0; col < numCol; col++) {
+    if (!isBinary(col)) continue;
+    const int length = mip_.Astart_[col + 1] - mip_.Astart_[col];
+    candidates.push_back(std::make_pair(-length, col));
+  }
+  std::sort(candidates.begin(), candidates.end());
+
+  const double max_work =
+      mip_presolve_probing_effort * (mip_.Astart_[numCol] + numCol);
+  double work = 0;
+  std::vector<double> down_lower, down_upper, up_lower, up_upper;
+  for (const std::pair<int, int>& candidate : candidates) {
+    if (!feasible || work > max_work) break;
+    const int col = candidate.second;
+    const int length = -candidate.first;
+    if (col_lower[col] == col_upper[col]) continue;
+    work += 2 * (numCol + length);
+    down_lower = col_lower;
+    down_upper = col_upper;
+    down_upper[col] = 0;
+    const bool down_feasible = domain.propagate(down_lower, down_upper);
+    up_lower = col_lower;
+    up_upper = col_upper;
+    up_lower[col] = 1;
+    const bool up_feasible = domain.propagate(up_lower, up_upper);
+    if (!down_feasible && !up_feasible) {
+      feasible = false;
+    } else if (!down_feasible) {
+      col_lower.swap(up_lower);
+      col_upper.swap(up_upper);
+    } else if (!up_feasible) {
+      col_lower.swap(down_lower);
+      col_upper.swap(down_upper);
+    } else {
+      for (int other = 0; other < numCol; other++) {
+        col_lower[other] = std::max(
+            col_lower[other], std::min(down_lower[other], up_lower[other]));
+        col_upper[other] = std::min(
+            col_upper[other], std::max(down_upper[other], up_upper[other]));
+      }
+    }
+  }
+
+  if (feasible) {
+    for (int col = 0; col < numCol; col++) {
+      if (col_lower[col] != mip_.colLower_[col])
+        timer_.addChange(presolve::MIP_PROBING);
+      if (col_upper[col] != mip_.colUpper_[col])
+        timer_.addChange(presolve::MIP_PROBING);
+    }
+    mip_.colLower_ = col_lower;
+    mip_.colUpper_ = col_upper;
+  }
+  timer_.recordFinish(presolve::MIP_PROBING);
+  return feasible;
+}
+
+void HighsMipPresolve::extractCliques() {
+  // Write each side of a row as sum_j a_j x_j <= b and let s be b
+  // less the minimum activity of the row. Binary columns with a_i +
+  // a_j > s cannot both be one, so if the binary columns with a_j > 0
+  // are sorted by decreasing a_j, the longest prefix in which the
+  // last two coefficients sum to more than s is a clique
+  timer_.recordStart(presolve::MIP_CLIQUE);
+  const double tolerance = mip_propagation_feasibility_tolerance;
+  const int max_num_clique =
+      std::max(1, (int)(mip_presolve_max_clique_fraction * mip_.numRow_));
+  const double max_work =
+      mip_presolve_clique_effort * mip_.Astart_[mip_.numCol_];
+  double work = 0;
+  std::set<std::vector<int>> cliques;
+  std::vector<std::pair<double, int>> binaries;
+  for (int row = 0; row < mip_.numRow_; row++) {
+    if ((int)cliques_.size() >= max_num_clique || work > max_work) break;
+    const int length = ARstart_[row + 1] - ARstart_[row];
+    work += 2 * length;
+    for (int side = 0; side < 2; side++) {
+      const bool upper = side == 0;
+      const double bound = upper ? mip_.rowUpper_[row] : -mip_.rowLower_[row];
+      if (bound >= HIGHS_CONST_INF) continue;
+      const double sign = upper ? 1 : -1;
+      double min_activity = 0;
+      bool finite = true;
+      binaries.clear();
+      for (int k = ARstart_[row]; k < ARstart_[row + 1]; k++) {
+        const int col = ARindex_[k];
+        const double value = sign * mip_.Avalue_[ARposition_[k]];
+        const double col_bound =
+            value > 0 ? mip_.colLower_[col] : mip_.colUpper_[col];
+        if (std::fabs(col_bound) >= HIGHS_CONST_INF) {
+          finite = false;
+          break;
+        }
+        min_activity += value * col_bound;
+        if (value > 0 && isBinary(col))
+          binaries.push_back(std::make_pair(-value, col));
+      }
+      if (!finite || binaries.size() < 2) continue;
+      const double slack = bound - min_activity;
+      std::sort(binaries.begin(), binaries.end());
+      if (-binaries[0].first - binaries[1].first <= slack + tolerance)
+        continue;
+      int size = 2;
+      while (size < (int)binaries.size() &&
+             -binaries[size - 1].first - binaries[size].first >
+                 slack + tolerance)
+        size++;
+
+      // A row that is already the set packing row of the clique is
+      // not strengthened by it
+      bool set_packing = size == length;
+      for (int ix = 0; ix < size; ix++)
+        if (std::fabs(-binaries[ix].first - slack) > tolerance)
+          set_packing = false;
+      if (set_packing) continue;
+
+      std::vector<int> clique(size);
+      for (int ix = 0; ix < size; ix++) clique[ix] = binaries[ix].second;
+      std::sort(clique.begin(), clique.end());
+      if (!cliques.insert(clique).second) continue;
+      cliques_.push_back(clique);
+      timer_.addChange(presolve::MIP_CLIQUE);
+    }
+  }
+  timer_.recordFinish(presolve::MIP_CLIQUE);
+}
+
+bool HighsMipPresolve::formReducedMip() {
+  const int numCol = mip_.numCol_;
+  const int numRow = mip_.numRow_;
+  const double tolerance = mip_propagation_feasibility_tolerance;
+
+  // Remove fixed columns, unless all columns are fixed
+  std::vector<int>& new_col = reduced_col_;
+  new_col.assign(numCol, -1);
+  col_map_.clear();
+  for (int col = 0; col < numCol; col++) {
+    fixed_value_[col] = mip_.colLower_[col];
+    if (mip_.colLower_[col] == mip_.colUpper_[col]) continue;
+    new_col[col] = (int)col_map_.size();
+    col_map_.push_back(col);
+  }
+  if (col_map_.size() == 0) {
+    for (int col = 0; col < numCol; col++) {
+      new_col[col] = col;
+      col_map_.push_back(col);
+    }
+  }
+
+  // Remove rows that hold for all values of the columns in their
+  // bounds, and shift the bounds of the other rows by the activity of
+  // the fixed columns
+  std::vector<double> min_activity(numRow, 0);
+  std::vector<double> max_activity(numRow, 0);
+  std::vector<double> fixed_activity(numRow, 0);
+  std::vector<int> num_inf_min_activity(numRow, 0);
+  std::vector<int> num_inf_max_activity(numRow, 0);
+  std::vector<int> num_kept_nz(numRow, 0);
+  for (int col = 0; col < numCol; col++) {
+    for (int k = mip_.Astart_[col]; k < mip_.Astart_[col + 1]; k++) {
+      const int row = mip_.Aindex_[k];
+      const double value = mip_.Avalue_[k];
+      const double min_bound =
+          value > 0 ? mip_.colLower_[col] : mip_.colUpper_[col];
+      const double max_bound =
+          value > 0 ? mip_.colUpper_[col] : mip_.colLower_[col];
+      if (std::fabs(min_bound) >= HIGHS_CONST_INF) {
+        num_inf_min_activity[row]++;
+      } else {
+        min_activity[row] += value * min_bound;
+      }
+      if (std::fabs(max_bound) >= HIGHS_CONST_INF) {
+        num_inf_max_activity[row]++;
+      } else {
+        max_activity[row] += value * max_bound;
+      }
+      if (new_col[col] < 0) {
+        fixed_activity[row] += value * fixed_value_[col];
+      } else {
+        num_kept_nz[row]++;
+      }
+    }
+  }
+  std::vector<int> new_row(numRow, -1);
+  int num_new_row = 0;
+  for (int row = 0; row < numRow; row++) {
+    const double lower = mip_.rowLower_[row];
+    const double upper = mip_.rowUpper_[row];
+    if (num_kept_nz[row] == 0) {
+      // The activity of an empty row is known, so check it
+      if (fixed_activity[row] < lower - tolerance ||
+          fixed_activity[row] > upper + tolerance)
+        return false;
+      timer_.addChange(presolve::EMPTY_ROW);
+      timer_.increaseCount(true, presolve::EMPTY_ROW);
+      num_rows_removed_++;
+      continue;
+    }
+    const bool lower_redundant =
+        lower <= -HIGHS_CONST_INF ||
+        (num_inf_min_activity[row] == 0 &&
+         min_activity[row] >= lower - mip_presolve_redundancy_tolerance *
+                                          std::max(1.0, std::fabs(lower)));
+    const bool upper_redundant =
+        upper >= HIGHS_CONST_INF ||
+        (num_inf_max_activity[row] == 0 &&
+         max_activity[row] <= upper + mip_presolve_redundancy_tolerance *
+                                          std::max(1.0, std::fabs(upper)));
+    if (lower_redundant && upper_redundant) {
+      timer_.addChange(presolve::REDUNDANT_ROW);
+      timer_.increaseCount(true, presolve::REDUNDANT_ROW);
+      num_rows_removed_++;
+      continue;
+    }
+    new_row[row] = num_new_row++;
+  }
+
+  // Cliques are valid rows, so any that lose all but one of their
+  // columns to fixing can be dropped
+  std::vector<std::vector<int>> col_cliques(numCol);
+  std::vector<double> clique_upper;
+  for (const std::vector<int>& clique : cliques_) {
+    int num_kept = 0;
+    double upper = 1;
+    for (int col : clique) {
+      if (new_col[col] < 0) {
+        upper -= fixed_value_[col];
+      } else {
+        num_kept++;
+      }
+    }
+    if (num_kept < 2) continue;
+    for (int col : clique)
+      if (new_col[col] >= 0)
+        col_cliques[col].push_back(num_new_row + (int)clique_upper.size());
+    clique_upper.push_back(upper);
+  }
+
+  HighsLp& reduced = reduced_mip_;
+  reduced = HighsLp();
+  reduced.numCol_ = (int)col_map_.size();
+  reduced.numRow_ = num_new_row + (int)clique_upper.size();
+  reduced.sense_ = mip_.sense_;
+  reduced.offset_ = mip_.offset_;
+  reduced.model_name_ = mip_.model_name_;
+  reduced.lp_name_ = mip_.lp_name_;
+  const bool have_col_names = (int)mip_.col_names_.size() == numCol;
+  const bool have_row_names = (int)mip_.row_names_.size() == numRow;
+  for (int col = 0; col < numCol; col++) {
+    if (new_col[col] < 0) {
+      reduced.offset_ += mip_.colCost_[col] * fixed_value_[col];
+      timer_.addChange(presolve::FIXED_COL);
+      timer_.increaseCount(false, presolve::FIXED_COL);
+      continue;
+    }
+    reduced.colCost_.push_back(mip_.colCost_[col]);
+    reduced.colLower_.push_back(mip_.colLower_[col]);
+    reduced.colUpper_.push_back(mip_.colUpper_[col]);
+    reduced.integrality_.push_back(mip_.integrality_[col]);
+    if (have_col_names) reduced.col_names_.push_back(mip_.col_names_[col]);
+    reduced.Astart_.push_back((int)reduced.Aindex_.size());
+    for (int k = mip_.Astart_[col]; k < mip_.Astart_[col + 1]; k++) {
+      const int row = new_row[mip_.Aindex_[k]];
+      if (row < 0) continue;
+      reduced.Aindex_.push_back(row);
+      reduced.Avalue_.push_back(mip_.Avalue_[k]);
+    }
+    for (int row : col_cliques[col]) {
+      reduced.Aindex_.push_back(row);
+      reduced.Avalue_.push_back(1);
+    }
+  }
+  reduced.Astart_.push_back((int)reduced.Aindex_.size());
+
+  for (int row = 0; row < numRow; row++) {
+    if (new_row[row] < 0) continue;
+    const double lower = mip_.rowLower_[row];
+    const double upper = mip_.rowUpper_[row];
+    reduced.rowLower_.push_back(
+        lower > -HIGHS_CONST_INF ? lower - fixed_activity[row] : lower);
+    reduced.rowUpper_.push_back(
+        upper < HIGHS_CONST_INF ? upper - fixed_activity[row] : upper);
+    if (have_row_names) reduced.row_names_.push_back(mip_.row_names_[row]);
+  }
+  for (int clique = 0; clique < (int)clique_upper.size(); clique++) {
+    reduced.rowLower_.push_back(-HIGHS_CONST_INF);
+    reduced.rowUpper_.push_back(clique_upper[clique]);
+    if (have_row_names)
+      reduced.row_names_.push_back("clique" + std::to_string(clique));
+  }
+  return true;
+}
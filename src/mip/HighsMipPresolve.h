@@ -0,0 +1,106 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_MIP_PRESOLVE_H_
+#define MIP_HIGHS_MIP_PRESOLVE_H_
+
+#include <cstdio>
+#include <vector>
+
+#include "lp_data/HighsLp.h"
+#include "presolve/Presolve.h"
+#include "presolve/PresolveAnalysis.h"
+#include "util/HighsTimer.h"
+
+// Limit on the work in probing, as a multiple of the number of
+// nonzeros and columns. Each probe propagates both values of a binary
+// column, which costs at least the number of columns
+const double mip_presolve_probing_effort = 100;
+// Limit on the work in clique extraction, as a multiple of the number
+// of nonzeros
+const double mip_presolve_clique_effort = 10;
+// Limit on the number of clique rows added, as a fraction of the
+// number of rows
+const double mip_presolve_max_clique_fraction = 0.5;
+// Rows are only removed as redundant if their activity bounds are
+// within this relative tolerance of the row bounds
+const double mip_presolve_redundancy_tolerance = 1e-9;
+
+// Presolve of a MIP using its integrality. Bounds of integer columns
+// are rounded, coefficients of integer columns are tightened, binary
+// columns are probed and cliques of binary columns are extracted from
+// the rows as set packing rows. Fixed columns and redundant rows are
+// then removed. No column is substituted out, so a solution of the
+// original MIP is recovered from one of the reduced MIP by restoring
+// the values of the fixed columns. Each rule has a work limit, and
+// its counts are recorded by the presolve timer.
+class HighsMipPresolve {
+ public:
+  HighsMipPresolve(HighsTimer& timer) : timer_(timer) {}
+
+  // Returns Infeasible, NotReduced or Reduced
+  HighsPresolveStatus run(const HighsLp& mip);
+  // Presolve the reduced MIP again, once its bounds have been
+  // tightened at the root node. Postsolve still recovers a solution
+  // of the original MIP
+  HighsPresolveStatus restart(const HighsLp& reduced_mip);
+  const HighsLp& getReducedMip() const { return reduced_mip_; }
+
+  // Recover a solution of the original MIP from one of the reduced
+  // MIP
+  void postsolve(const std::vector<double>& reduced_solution,
+                 std::vector<double>& solution) const;
+  // Transform a solution or a cut for the MIP given to the last call
+  // of run() or restart() into one for the reduced MIP. Returns false
+  // if no column of the cut remains
+  void reduceSolution(const std::vector<double>& solution,
+                      std::vector<double>& reduced_solution) const;
+  bool reduceCut(std::vector<int>& index, std::vector<double>& value,
+                 double& lower) const;
+
+  int getNumColsRemoved() const;
+  int getNumRowsRemoved() const;
+  void report(FILE* output, const int message_level) const;
+
+ private:
+  HighsPresolveStatus presolve(const HighsLp& mip);
+  bool isInteger(const int col) const;
+  bool isBinary(const int col) const;
+  void formRowwiseMatrix();
+  bool roundIntegerBounds();
+  void tightenCoefficients();
+  bool probe();
+  void extractCliques();
+  bool formReducedMip();
+
+  presolve::PresolveTimer timer_;
+  // The MIP with tightened bounds and coefficients
+  HighsLp mip_;
+  std::vector<int> ARstart_;
+  std::vector<int> ARindex_;
+  std::vector<int> ARposition_;
+  // Cliques of binary columns, at most one of which can be one, that
+  // are added to the reduced MIP as rows
+  std::vector<std::vector<int>> cliques_;
+
+  HighsLp reduced_mip_;
+  // The index in the presolved MIP of each column of the reduced MIP,
+  // the index in the reduced MIP of each column, or -1 if it is
+  // removed, and the values of the columns that are removed
+  std::vector<int> col_map_;
+  std::vector<int> reduced_col_;
+  std::vector<double> fixed_value_;
+  // The same maps relative to the original MIP, which differ from
+  // those above after a restart
+  std::vector<int> postsolve_col_map_;
+  std::vector<double> postsolve_fixed_value_;
+  int num_rows_removed_ = 0;
+};
+
+#endif
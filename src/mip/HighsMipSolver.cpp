@@ -14,14 +14,35 @@
 // Branch-and-bound code below here:
 // Solve a mixed integer problem using branch and bound.
 HighsMipStatus HighsMipSolver::runMipSolver() {
-  std::cout << "Warning: HiGHS MIP solver is under construction at the moment."
-            << std::endl
-            << "Running HiGHS MIP solver..." << std::endl;
+  HighsPrintMessage(
+      options_mip_.output, options_mip_.message_level, ML_MINIMAL,
+      "Warning: HiGHS MIP solver is under construction at the moment.\n"
+      "Running HiGHS MIP solver...\n");
 
   // Start timer.
   timer_.startRunHighsClock();
   double mip_solve_initial_time = timer_.readRunHighsClock();
 
+  // Presolve the MIP using integrality. The root node LP is still
+  // presolved as an LP
+  if (options_mip_.mip_presolve) {
+    HighsPresolveStatus presolve_status = mip_presolve_.run(original_mip_);
+    if (presolve_status == HighsPresolveStatus::Infeasible) {
+      HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                        ML_MINIMAL, "MIP presolve: model is infeasible\n");
+      return HighsMipStatus::kRootNodeNotOptimal;
+    }
+    if (presolve_status == HighsPresolveStatus::Reduced) {
+      mip_ = mip_presolve_.getReducedMip();
+      mip_presolved_ = true;
+    }
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      "MIP presolve: removed %d rows and %d columns\n",
+                      mip_presolve_.getNumRowsRemoved(),
+                      mip_presolve_.getNumColsRemoved());
+  }
+
   // Load root node lp in highs and turn printing off.
   passModel(mip_);
   // Set the options for this Highs instance according to the options for the
@@ -29,9 +50,14 @@ HighsMipStatus HighsMipSolver::runMipSolver() {
   options_ = options_mip_;
 
   // Report deviations from default options settings
-  writeHighsOptions("");
+  if (options_mip_.message_level & ML_MINIMAL) writeHighsOptions("");
   options_.message_level = 0;
 
+  use_conflicts_ =
+      options_mip_.mip_propagation && options_mip_.mip_conflict_analysis;
+  use_checkpoints_ = options_mip_.mip_checkpoint_file != "";
+  setupMipModel();
+
   const bool only_write_as_mps = false;  // true;//
   if (only_write_as_mps) {
     printf("Only writing out the MIP as MPS\n");
@@ -41,9 +67,11 @@ HighsMipStatus HighsMipSolver::runMipSolver() {
     return HighsMipStatus::kUnderDevelopment;
   }
   HighsMipStatus root_solve_status = solveRootNode();
+  if (root_solve_status == HighsMipStatus::kRootNodeOptimal)
+    root_solve_status = separateRootCuts();
   num_nodes_solved++;
   root_objective_ = info_.objective_function_value;
-  reportMipSolverProgressLine("", true);
+  if (options_mip_.mip_report_level == 1) reportMipSolverProgressLine("", true);
   reportMipSolverProgress(root_solve_status);
   if (root_solve_status != HighsMipStatus::kRootNodeOptimal)
     return root_solve_status;
@@ -51,16 +79,61 @@ HighsMipStatus HighsMipSolver::runMipSolver() {
   // Start tree by making root node.
   // Highs ignores integrality constraints.
   Node root(-1, 0.0, 0, 0);
-  root.col_lower_bound = lp_.colLower_;
-  root.col_upper_bound = lp_.colUpper_;
-  root.integer_variables = lp_.integrality_;
-  root.primal_solution = solution_.col_value;
-  root.objective_value = info_.objective_function_value;
+  bool root_feasible = true;
+  HighsMipStatus node_solve_status = setupRootNode(root, root_feasible);
+  if (node_solve_status != HighsMipStatus::kNodeOptimal)
+    return node_solve_status;
 
-  //  writeSolutionForIntegerVariables(root);
+  HighsMipStatus tree_solve_status = HighsMipStatus::kTreeExhausted;
+  if (root_feasible) {
+    // Continue the tree search of an earlier run if it left a
+    // checkpoint
+    if (use_checkpoints_) resumed_from_checkpoint_ = resumeFromCheckpoint();
+
+    if (!resumed_from_checkpoint_) {
+      // Look for an incumbent before branching, so that nodes can be
+      // pruned and columns fixed by their reduced costs
+      runHeuristics(root, true);
+      int num_fixed = fixRootColumns(root);
 
-  // Add and solve children.
-  HighsMipStatus tree_solve_status = solveTree(root);
+      // Presolve the MIP again if enough integer columns are fixed
+      // at the root. Checkpointed nodes are for the MIP at the start
+      // of the search, so there is no restart when checkpointing
+      for (int restart = 0; restart < mip_max_root_restarts; restart++) {
+        if (use_checkpoints_ || !options_mip_.mip_root_restarts) break;
+        int num_integer = 0;
+        for (int col = 0; col < mip_.numCol_; col++)
+          if (mip_.integrality_[col]) num_integer++;
+        if (num_fixed == 0 ||
+            num_fixed < mip_restart_min_fixed_fraction * num_integer)
+          break;
+        HighsMipStatus restart_status = restartRoot(root, root_feasible);
+        if (restart_status != HighsMipStatus::kRootNodeOptimal)
+          return restart_status;
+        if (!root_feasible) break;
+        runHeuristics(root, true);
+        num_fixed = fixRootColumns(root);
+      }
+    }
+
+    // Add and solve children.
+    if (root_feasible) tree_solve_status = solveTree(root);
+  }
+  if (use_checkpoints_) {
+    // A checkpoint is only of use if the tree search is incomplete
+    if (tree_solve_status == HighsMipStatus::kTreeExhausted) {
+      checkpoint_writer_.wait();
+      remove(options_mip_.mip_checkpoint_file.c_str());
+    } else {
+      writeCheckpoint(true);
+    }
+    if (checkpoint_writer_.getNumFailed())
+      HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                        ML_MINIMAL,
+                        "WARNING: failed to write %d MIP checkpoints to %s\n",
+                        checkpoint_writer_.getNumFailed(),
+                        options_mip_.mip_checkpoint_file.c_str());
+  }
   reportMipSolverProgress(tree_solve_status);
 
   // Stop and read the HiGHS clock, then work out time for this call
@@ -83,8 +156,57 @@ HighsMipStatus HighsMipSolver::runMipSolver() {
 
   HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
                     "Number of IFS found      = %9d\n", num_integer_solutions);
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
+                    "Number of cut rounds     = %9d\n", num_cut_rounds);
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
+                    "Number of cuts in LP     = %9d\n",
+                    (int)lp_cut_index_.size());
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
+                    "Number of cuts in pool   = %9d\n",
+                    cut_pool_.getNumCuts());
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
+                    "Number of cuts tightened = %9d\n",
+                    num_lp_cuts_tightened);
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
+                    "Max number of LP cuts    = %9d\n", max_num_lp_cuts);
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
+                    "Cuts removed at nodes    = %9d\n",
+                    num_node_lp_cuts_removed);
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
+                    "Number of LPs avoided    = %9d\n",
+                    num_nodes_propagated_infeasible);
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
+                    "Propagation time         = %9.3f\n", propagation_time);
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
+                    "Number of conflicts      = %9d\n",
+                    conflict_pool_.getNumConflicts());
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
+                    "Conflict pruned nodes    = %9d\n",
+                    num_nodes_pruned_by_conflicts);
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
+                    "Checkpoints written      = %9d\n",
+                    checkpoint_writer_.getNumWritten());
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
+                    "Reduced cost fixings     = %9d\n",
+                    num_reduced_cost_fixings);
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
+                    "Root restarts            = %9d\n", num_root_restarts);
+  heuristic_stats_.report(options_mip_.output, options_mip_.message_level);
+  if (options_mip_.mip_presolve)
+    mip_presolve_.report(options_mip_.output, options_mip_.message_level);
 
   if (tree_.getBestSolution().size() > 0) {
+    // Recover the incumbent for the original MIP, and check it
+    mip_solution_ = tree_.getBestSolution();
+    if (mip_presolved_) {
+      mip_presolve_.postsolve(tree_.getBestSolution(), mip_solution_);
+      HighsMipRounding original_rounding;
+      original_rounding.setup(original_mip_);
+      if (!original_rounding.isFeasible(mip_solution_))
+        HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                          ML_MINIMAL,
+                          "ERROR: postsolved solution is infeasible\n");
+    }
     if (num_nodes_unsolved)
       HighsPrintMessage(options_mip_.output, options_mip_.message_level,
                         ML_MINIMAL, "ERROR: number of nodes unsolved = %9d\n",
@@ -110,7 +232,8 @@ HighsMipStatus HighsMipSolver::runMipSolver() {
   }
 
   if (tree_solve_status != HighsMipStatus::kTreeExhausted) {
-    std::cout << "Warning: tree not explored entirely." << std::endl;
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL, "Warning: tree not explored entirely.\n");
     return tree_solve_status;
   }
 
@@ -313,6 +436,169 @@ HighsMipStatus HighsMipSolver::solveNode(Node& node, bool hotstart) {
   return HighsMipStatus::kNodeNotOptimal;
 }
 
+void HighsMipSolver::setupMipModel() {
+  // Set up the row-wise matrix and locks used when rounding
+  rounding_.setup(mip_);
+  domain_.setup(mip_);
+  conflict_pool_.setup(mip_.numCol_);
+  if (use_conflicts_) domain_.setConflictPool(&conflict_pool_);
+  if (use_checkpoints_) model_hash_ = hashMipModel(mip_);
+}
+
+HighsMipStatus HighsMipSolver::setupRootNode(Node& root, bool& root_feasible) {
+  root.col_lower_bound = lp_.colLower_;
+  root.col_upper_bound = lp_.colUpper_;
+  root.integer_variables = lp_.integrality_;
+  root.primal_solution = solution_.col_value;
+  root.objective_value = info_.objective_function_value;
+  root_reduced_cost_ = solution_.col_dual;
+
+  //  writeSolutionForIntegerVariables(root);
+
+  // Tighten the root bounds by propagation, in which case the root LP
+  // solution may violate them and has to be recomputed
+  root_feasible = true;
+  if (options_mip_.mip_propagation) {
+    const int num_bound_changes = domain_.getNumBoundChanges();
+    root_feasible = propagateNode(root);
+    if (root_feasible && domain_.getNumBoundChanges() > num_bound_changes) {
+      HighsMipStatus node_solve_status = solveNode(root);
+      if (node_solve_status == HighsMipStatus::kNodeInfeasible) {
+        root_feasible = false;
+      } else if (node_solve_status != HighsMipStatus::kNodeOptimal) {
+        return node_solve_status;
+      }
+      root_reduced_cost_ = solution_.col_dual;
+    }
+  }
+
+  global_col_lower_ = root.col_lower_bound;
+  global_col_upper_ = root.col_upper_bound;
+  return HighsMipStatus::kNodeOptimal;
+}
+
+int HighsMipSolver::fixRootColumns(Node& root) {
+  // An integer column at its lower bound l in the root LP solution,
+  // with reduced cost d > 0, is at most l + (z* - z) / d in any
+  // solution better than the incumbent, where z is the root LP
+  // objective and z* that of the incumbent. Similarly for a column at
+  // its upper bound with d < 0.
+  const std::vector<double>& incumbent = tree_.getBestSolution();
+  const double gap = tree_.getBestObjective() - root.objective_value;
+  if (incumbent.size() > 0 && gap >= 0 &&
+      mip_.sense_ == ObjSense::MINIMIZE &&
+      (int)root_reduced_cost_.size() == mip_.numCol_) {
+    const double tolerance = mip_propagation_feasibility_tolerance;
+    for (int col = 0; col < mip_.numCol_; col++) {
+      if (!mip_.integrality_[col]) continue;
+      double& lower = root.col_lower_bound[col];
+      double& upper = root.col_upper_bound[col];
+      const double reduced_cost = root_reduced_cost_[col];
+      const double value = root.primal_solution[col];
+      if (reduced_cost > unscaled_dual_feasibility_tolerance &&
+          lower > -HIGHS_CONST_INF && value <= lower + tolerance) {
+        // The incumbent satisfies the new bound up to the accuracy
+        // of the LP solution, so it is kept feasible explicitly
+        double new_upper =
+            lower + std::floor(gap / reduced_cost + tolerance);
+        new_upper = std::max(new_upper, std::ceil(incumbent[col] - tolerance));
+        if (new_upper < upper) {
+          upper = new_upper;
+          num_reduced_cost_fixings++;
+        }
+      } else if (reduced_cost < -unscaled_dual_feasibility_tolerance &&
+                 upper < HIGHS_CONST_INF && value >= upper - tolerance) {
+        double new_lower =
+            upper - std::floor(gap / -reduced_cost + tolerance);
+        new_lower =
+            std::min(new_lower, std::floor(incumbent[col] + tolerance));
+        if (new_lower > lower) {
+          lower = new_lower;
+          num_reduced_cost_fixings++;
+        }
+      }
+    }
+    global_col_lower_ = root.col_lower_bound;
+    global_col_upper_ = root.col_upper_bound;
+  }
+
+  int num_fixed = 0;
+  for (int col = 0; col < mip_.numCol_; col++)
+    if (mip_.integrality_[col] &&
+        root.col_lower_bound[col] == root.col_upper_bound[col])
+      num_fixed++;
+  return num_fixed;
+}
+
+HighsMipStatus HighsMipSolver::restartRoot(Node& root, bool& root_feasible) {
+  // Presolve the MIP with the bounds at the root, which hold for any
+  // solution better than the incumbent
+  HighsLp mip = mip_;
+  mip.colLower_ = root.col_lower_bound;
+  mip.colUpper_ = root.col_upper_bound;
+  HighsPresolveStatus presolve_status = mip_presolve_.restart(mip);
+  if (presolve_status == HighsPresolveStatus::Infeasible) {
+    root_feasible = false;
+    return HighsMipStatus::kRootNodeOptimal;
+  }
+  if (presolve_status != HighsPresolveStatus::Reduced)
+    return HighsMipStatus::kRootNodeOptimal;
+  const HighsLp& reduced_mip = mip_presolve_.getReducedMip();
+  num_root_restarts++;
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                    ML_MINIMAL,
+                    "Root restart %d: reduced MIP to %d rows and %d "
+                    "columns\n",
+                    num_root_restarts, reduced_mip.numRow_,
+                    reduced_mip.numCol_);
+
+  // The incumbent and the cuts carry over to the reduced MIP. The
+  // incumbent satisfies the root bounds, so the columns removed by
+  // presolve have their incumbent values
+  if (tree_.getBestSolution().size() > 0) {
+    std::vector<double> reduced_solution;
+    mip_presolve_.reduceSolution(tree_.getBestSolution(), reduced_solution);
+    const double best_objective = tree_.getBestObjective();
+    const int num_integer_solutions = tree_.getNumIntegerSolutions();
+    tree_ = Tree();
+    tree_.updateBestSolution(reduced_solution, best_objective);
+    tree_.setNumIntegerSolutions(num_integer_solutions);
+  }
+  HighsCutPool cut_pool;
+  for (int cut = 0; cut < cut_pool_.getNumCutSlots(); cut++) {
+    const HighsCut& pool_cut = cut_pool_.getCut(cut);
+    if (pool_cut.deleted) continue;
+    std::vector<int> index = pool_cut.index;
+    std::vector<double> value = pool_cut.value;
+    double lower = pool_cut.lower;
+    int new_cut;
+    if (mip_presolve_.reduceCut(index, value, lower))
+      cut_pool.addCut(index, value, lower, new_cut);
+  }
+  cut_pool_ = std::move(cut_pool);
+  lp_cut_index_.clear();
+
+  // Conflicts are for the columns of the previous MIP, so are lost
+  mip_ = reduced_mip;
+  mip_presolved_ = true;
+  passModel(mip_);
+  setupMipModel();
+
+  // Solve the new root LP, with the pool cuts that it violates
+  options_.presolve = options_mip_.presolve;
+  HighsMipStatus root_solve_status = solveRootNode();
+  if (root_solve_status == HighsMipStatus::kRootNodeOptimal)
+    root_solve_status = separateRootCuts();
+  if (root_solve_status != HighsMipStatus::kRootNodeOptimal)
+    return root_solve_status;
+  root_objective_ = info_.objective_function_value;
+
+  HighsMipStatus node_solve_status = setupRootNode(root, root_feasible);
+  if (node_solve_status != HighsMipStatus::kNodeOptimal)
+    return node_solve_status;
+  return HighsMipStatus::kRootNodeOptimal;
+}
+
 HighsMipStatus HighsMipSolver::solveRootNode() {
   HighsStatus lp_solve_status = HighsStatus::Error;
   HighsModelStatus use_model_status = HighsModelStatus::NOTSET;
@@ -325,6 +611,19 @@ HighsMipStatus HighsMipSolver::solveRootNode() {
     options_.message_level = 0;
   }
   lp_solve_status = run();
+  // Only a failure of LP presolve itself is worth solving again
+  // without it: an infeasible or unbounded root is reported as such
+  if (options_.presolve != off_string &&
+      lp_solve_status == HighsStatus::Error &&
+      model_status_ == HighsModelStatus::PRESOLVE_ERROR) {
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      "LP presolve failed on the root node: solving it "
+                      "without presolve\n");
+    options_.presolve = off_string;
+    clearSolver();
+    lp_solve_status = run();
+  }
   if (no_highs_log) {
     options_.logfile = save_logfile;
     options_.message_level = save_message_level;
@@ -356,7 +655,10 @@ HighsMipStatus HighsMipSolver::solveTree(Node& root) {
 
   tree_.setMipReportLevel(options_.mip_report_level);
 
-  tree_.branch(root);
+  // When resuming from a checkpoint, the tree already holds the open
+  // nodes
+  if (!resumed_from_checkpoint_) tree_.branch(root);
+  last_checkpoint_time_ = timer_.readRunHighsClock();
 
   // While stack not empty.
   //   Solve node.
@@ -366,6 +668,13 @@ HighsMipStatus HighsMipSolver::solveTree(Node& root) {
       return HighsMipStatus::kTimeout;
     if (tree_.getNumNodesFormed() > options_.mip_max_nodes)
       return HighsMipStatus::kMaxNodeReached;
+    // Only take a snapshot of the tree once the previous checkpoint
+    // has been written
+    if (use_checkpoints_ &&
+        timer_.readRunHighsClock() - last_checkpoint_time_ >=
+            options_mip_.mip_checkpoint_interval &&
+        !checkpoint_writer_.busy())
+      writeCheckpoint(false);
     Node& node = tree_.next();
     double best_objective;
     best_objective = tree_.getBestObjective();
@@ -378,7 +687,35 @@ HighsMipStatus HighsMipSolver::solveTree(Node& root) {
       tree_.pop();
       continue;
     }
+    if (options_mip_.mip_propagation && !propagateNode(node)) {
+      // Infeasibility is detected without solving the LP
+      if (options_.mip_report_level > 1)
+        printf("Node %9d (branch on %2d) infeasible by propagation\n",
+               node.id, node.branch_col);
+      num_nodes_propagated_infeasible++;
+      num_nodes_pruned++;
+      if (domain_.isConflictInfeasible()) {
+        num_nodes_pruned_by_conflicts++;
+      } else if (use_conflicts_) {
+        analyzePropagationConflict(node);
+      }
+      tree_.pop();
+      continue;
+    }
     HighsMipStatus node_solve_status = solveNode(node);
+    // Cuts from the pool are globally valid, so tighten the node LP
+    // with any that it violates
+    if (node_solve_status == HighsMipStatus::kNodeOptimal &&
+        options_mip_.mip_pool_cuts_at_nodes &&
+        node.objective_value < tree_.getBestObjective() &&
+        addPoolCutsToLp(node.primal_solution) > 0)
+      node_solve_status = solveNode(node);
+    // Cuts that are slack at this node are removed so that the node LP
+    // does not keep growing. They stay in the pool, so are added again
+    // at any node that violates them
+    if (node_solve_status == HighsMipStatus::kNodeOptimal &&
+        options_mip_.mip_pool_cuts_at_nodes)
+      num_node_lp_cuts_removed += removeSlackLpCuts();
     num_nodes_solved++;
 
     switch (node_solve_status) {
@@ -402,9 +739,11 @@ HighsMipStatus HighsMipSolver::solveTree(Node& root) {
                    best_objective);
           break;
         }
+        runHeuristics(node, false);
         tree_.branch(node);
         break;
       case HighsMipStatus::kNodeInfeasible:
+        if (use_conflicts_) analyzeLpConflict(node);
         reportMipSolverProgress(node_solve_status);
         if (options_.mip_report_level > 1) {
           printf("Node %9d (branch on %2d) infeasible\n", node.id,
@@ -447,6 +786,793 @@ HighsMipStatus HighsMipSolver::solveTree(Node& root) {
   return HighsMipStatus::kTreeExhausted;
 }
 
+void HighsMipSolver::writeCheckpoint(const bool final) {
+  HighsMipCheckpoint checkpoint;
+  checkpoint.model_hash = model_hash_;
+  checkpoint.num_nodes_formed = tree_.getNumNodesFormed();
+  checkpoint.num_nodes_solved = num_nodes_solved;
+  checkpoint.num_nodes_pruned = num_nodes_pruned;
+  checkpoint.num_integer_solutions = tree_.getNumIntegerSolutions();
+  checkpoint.best_objective = tree_.getBestObjective();
+  checkpoint.best_solution = tree_.getBestSolution();
+
+  // Open nodes are stored by their bounds that differ from those of
+  // the model, which are few for nodes deep in the tree
+  const int num_nodes = tree_.getNumNodesLeft();
+  checkpoint.nodes.resize(num_nodes);
+  for (int entry = 0; entry < num_nodes; entry++) {
+    const Node& node = tree_.getNode(entry);
+    HighsCheckpointNode& saved_node = checkpoint.nodes[entry];
+    saved_node.id = node.id;
+    saved_node.parent_id = node.parent_id;
+    saved_node.level = node.level;
+    saved_node.branch_col = node.branch_col;
+    saved_node.parent_objective = node.parent_objective;
+    for (int col = 0; col < mip_.numCol_; col++) {
+      if (node.col_lower_bound[col] == mip_.colLower_[col] &&
+          node.col_upper_bound[col] == mip_.colUpper_[col])
+        continue;
+      saved_node.index.push_back(col);
+      saved_node.lower.push_back(node.col_lower_bound[col]);
+      saved_node.upper.push_back(node.col_upper_bound[col]);
+    }
+  }
+
+  for (int cut = 0; cut < cut_pool_.getNumCutSlots(); cut++) {
+    const HighsCut& pool_cut = cut_pool_.getCut(cut);
+    if (pool_cut.deleted) continue;
+    HighsCheckpointCut saved_cut;
+    saved_cut.index = pool_cut.index;
+    saved_cut.value = pool_cut.value;
+    saved_cut.lower = pool_cut.lower;
+    checkpoint.cuts.push_back(std::move(saved_cut));
+  }
+
+  for (int conflict = 0; conflict < conflict_pool_.getNumConflicts();
+       conflict++)
+    checkpoint.conflicts.push_back(conflict_pool_.getConflict(conflict));
+
+  checkpoint_writer_.write(options_mip_.mip_checkpoint_file,
+                           std::move(checkpoint));
+  if (final) checkpoint_writer_.wait();
+  last_checkpoint_time_ = timer_.readRunHighsClock();
+}
+
+bool HighsMipSolver::resumeFromCheckpoint() {
+  HighsMipCheckpoint checkpoint;
+  if (!readMipCheckpoint(options_mip_.mip_checkpoint_file, checkpoint))
+    return false;
+  bool valid = checkpoint.model_hash == model_hash_ &&
+               (checkpoint.best_solution.size() == 0 ||
+                (int)checkpoint.best_solution.size() == mip_.numCol_);
+  for (const HighsCheckpointNode& saved_node : checkpoint.nodes) {
+    for (int col : saved_node.index)
+      if (col < 0 || col >= mip_.numCol_) valid = false;
+  }
+  if (!valid) {
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      "Ignoring MIP checkpoint %s written for a different "
+                      "model\n",
+                      options_mip_.mip_checkpoint_file.c_str());
+    return false;
+  }
+
+  int cut;
+  for (const HighsCheckpointCut& saved_cut : checkpoint.cuts)
+    cut_pool_.addCut(saved_cut.index, saved_cut.value, saved_cut.lower, cut);
+  if (use_conflicts_) {
+    for (const std::vector<HighsConflictLiteral>& conflict :
+         checkpoint.conflicts)
+      conflict_pool_.addConflict(conflict);
+  }
+  if (checkpoint.best_solution.size() > 0)
+    tree_.updateBestSolution(checkpoint.best_solution,
+                             checkpoint.best_objective);
+
+  // The node bounds are also restricted to the global bounds, which
+  // hold for every node
+  for (const HighsCheckpointNode& saved_node : checkpoint.nodes) {
+    std::unique_ptr<Node> node(
+        new Node(saved_node.parent_id, saved_node.parent_objective,
+                 saved_node.id, saved_node.level));
+    node->branch_col = saved_node.branch_col;
+    node->col_lower_bound = global_col_lower_;
+    node->col_upper_bound = global_col_upper_;
+    for (int ix = 0; ix < (int)saved_node.index.size(); ix++) {
+      const int col = saved_node.index[ix];
+      node->col_lower_bound[col] =
+          std::max(saved_node.lower[ix], global_col_lower_[col]);
+      node->col_upper_bound[col] =
+          std::min(saved_node.upper[ix], global_col_upper_[col]);
+    }
+    node->integer_variables = lp_.integrality_;
+    tree_.pushNode(std::move(node));
+  }
+
+  tree_.setNumNodesFormed(checkpoint.num_nodes_formed);
+  tree_.setNumIntegerSolutions(checkpoint.num_integer_solutions);
+  num_nodes_solved = checkpoint.num_nodes_solved;
+  num_nodes_pruned = checkpoint.num_nodes_pruned;
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                    ML_MINIMAL,
+                    "Resuming from MIP checkpoint %s with %d open nodes\n",
+                    options_mip_.mip_checkpoint_file.c_str(),
+                    (int)checkpoint.nodes.size());
+  return true;
+}
+
+HighsMipStatus HighsMipSolver::separateRootCuts() {
+  // Alternate between generating Gomory mixed-integer cuts from the
+  // current LP solution and re-solving the LP with the most
+  // efficacious of them until the root bound stalls
+  HighsMipStatus status = HighsMipStatus::kRootNodeOptimal;
+  if ((int)mip_.integrality_.size() != mip_.numCol_) return status;
+  double objective = info_.objective_function_value;
+  for (int round = 0; round < options_mip_.mip_cut_rounds; round++) {
+    if (timer_.readRunHighsClock() > options_.time_limit) break;
+    const int num_lp_cuts_tightened_before = num_lp_cuts_tightened;
+    generateGomoryCuts();
+    if (addPoolCutsToLp(solution_.col_value) == 0 &&
+        num_lp_cuts_tightened == num_lp_cuts_tightened_before)
+      break;
+    status = solveRootNode();
+    if (status != HighsMipStatus::kRootNodeOptimal) return status;
+    num_cut_rounds++;
+    cut_pool_.ageCuts(solution_.col_value);
+    const double improvement = info_.objective_function_value - objective;
+    objective = info_.objective_function_value;
+    if (improvement <= 1e-6 * std::max(1.0, std::fabs(objective))) break;
+  }
+  // Cuts that are not binding at the root only make node LPs bigger
+  if (removeSlackLpCuts() > 0) status = solveRootNode();
+  if (options_mip_.mip_report_level > 1)
+    printf("Root cuts: %d rounds; %d cuts in LP; objective %10.4g\n",
+           num_cut_rounds, (int)lp_cut_index_.size(),
+           info_.objective_function_value);
+  return status;
+}
+
+int HighsMipSolver::generateGomoryCuts() {
+  const int numCol = lp_.numCol_;
+  const int numRow = lp_.numRow_;
+  if (numRow == 0 || !basis_.valid_) return 0;
+  std::vector<int> basic_variables(numRow);
+  if (getBasicVariables(&basic_variables[0]) != HighsStatus::OK) return 0;
+  const std::vector<double>& col_value = solution_.col_value;
+  const std::vector<double>& row_value = solution_.row_value;
+  const std::vector<double>& incumbent = tree_.getBestSolution();
+
+  // Use the rows of the most fractional basic integer variables
+  const double min_fractionality = 0.01;
+  std::vector<std::pair<double, int>> candidates;
+  for (int row = 0; row < numRow; row++) {
+    const int col = basic_variables[row];
+    if (col < 0 || !mip_.integrality_[col]) continue;
+    const double fraction = col_value[col] - std::floor(col_value[col]);
+    const double fractionality = std::min(fraction, 1 - fraction);
+    if (fractionality < min_fractionality) continue;
+    candidates.push_back(std::make_pair(-fractionality, row));
+  }
+  std::sort(candidates.begin(), candidates.end());
+  if ((int)candidates.size() > mip_cut_max_per_round)
+    candidates.resize(mip_cut_max_per_round);
+
+  // Nonbasic variables are at the bound nearest to their value
+  auto atLower = [](const double value, const double lower,
+                    const double upper, bool& at_lower) {
+    const double tolerance = 1e-7 * std::max(1.0, std::fabs(value));
+    at_lower = std::fabs(value - lower) <= std::fabs(value - upper);
+    return std::fabs(value - (at_lower ? lower : upper)) <= tolerance;
+  };
+
+  std::vector<double> reduced_row(numCol);
+  std::vector<double> inverse_row(numRow);
+  std::vector<double> cut_value(numCol);
+  std::vector<double> row_multiplier(numRow);
+  std::vector<int> cut_index;
+  std::vector<double> cut_coefficient;
+  int num_new_cut = 0;
+  for (const std::pair<double, int>& candidate : candidates) {
+    const int basis_row = candidate.second;
+    const int basic_col = basic_variables[basis_row];
+    if (getReducedRow(basis_row, &reduced_row[0]) != HighsStatus::OK) continue;
+    if (getBasisInverseRow(basis_row, &inverse_row[0]) != HighsStatus::OK)
+      continue;
+
+    // The tableau row is x_b + sum_k a_k z_k = 0 over the nonbasic
+    // columns and row activities z_k. Shift each z_k by its bound so
+    // that x_b + sum_k a'_k z'_k = beta with z'_k >= 0
+    bool ok = true;
+    double beta = 0;
+    for (int col = 0; col < numCol; col++) {
+      reduced_row[col] = col == basic_col ? 0 : reduced_row[col];
+      if (basis_.col_status[col] == HighsBasisStatus::BASIC) continue;
+      if (std::fabs(reduced_row[col]) < HIGHS_CONST_TINY) {
+        reduced_row[col] = 0;
+        continue;
+      }
+      bool at_lower;
+      if (!atLower(col_value[col], lp_.colLower_[col], lp_.colUpper_[col],
+                   at_lower)) {
+        ok = false;
+        break;
+      }
+      const double bound = at_lower ? lp_.colLower_[col] : lp_.colUpper_[col];
+      beta -= reduced_row[col] * bound;
+    }
+    for (int row = 0; ok && row < numRow; row++) {
+      inverse_row[row] = -inverse_row[row];
+      if (basis_.row_status[row] == HighsBasisStatus::BASIC ||
+          std::fabs(inverse_row[row]) < HIGHS_CONST_TINY) {
+        inverse_row[row] = 0;
+        continue;
+      }
+      bool at_lower;
+      if (!atLower(row_value[row], lp_.rowLower_[row], lp_.rowUpper_[row],
+                   at_lower)) {
+        ok = false;
+        break;
+      }
+      const double bound = at_lower ? lp_.rowLower_[row] : lp_.rowUpper_[row];
+      beta -= inverse_row[row] * bound;
+    }
+    if (!ok) continue;
+    // Guard against numerical trouble in the tableau row
+    if (std::fabs(beta - col_value[basic_col]) >
+        1e-6 * std::max(1.0, std::fabs(beta)))
+      continue;
+    const double f0 = beta - std::floor(beta);
+    if (f0 < min_fractionality || f0 > 1 - min_fractionality) continue;
+
+    // Form the GMI cut sum_k g_k z'_k >= 1 and substitute back to
+    // get coefficients of the columns and row activities
+    double cut_lower = 1;
+    cut_value.assign(numCol, 0);
+    row_multiplier.assign(numRow, 0);
+    auto gmiCoefficient = [&](const double a, const bool integer) {
+      if (integer) {
+        const double f = a - std::floor(a);
+        return f <= f0 ? f / f0 : (1 - f) / (1 - f0);
+      }
+      return a >= 0 ? a / f0 : -a / (1 - f0);
+    };
+    for (int col = 0; col < numCol; col++) {
+      if (reduced_row[col] == 0) continue;
+      bool at_lower;
+      atLower(col_value[col], lp_.colLower_[col], lp_.colUpper_[col], at_lower);
+      const double bound = at_lower ? lp_.colLower_[col] : lp_.colUpper_[col];
+      const bool integer =
+          mip_.integrality_[col] && !HighsMipRounding::isFractional(bound);
+      const double a = at_lower ? reduced_row[col] : -reduced_row[col];
+      const double g = gmiCoefficient(a, integer);
+      cut_value[col] += at_lower ? g : -g;
+      cut_lower += at_lower ? g * bound : -g * bound;
+    }
+    for (int row = 0; row < numRow; row++) {
+      if (inverse_row[row] == 0) continue;
+      bool at_lower;
+      atLower(row_value[row], lp_.rowLower_[row], lp_.rowUpper_[row],
+              at_lower);
+      const double bound = at_lower ? lp_.rowLower_[row] : lp_.rowUpper_[row];
+      const double a = at_lower ? inverse_row[row] : -inverse_row[row];
+      const double g = gmiCoefficient(a, false);
+      row_multiplier[row] = at_lower ? g : -g;
+      cut_lower += at_lower ? g * bound : -g * bound;
+    }
+    for (int col = 0; col < numCol; col++)
+      for (int el = lp_.Astart_[col]; el < lp_.Astart_[col + 1]; el++)
+        cut_value[col] += row_multiplier[lp_.Aindex_[el]] * lp_.Avalue_[el];
+
+    // Remove tiny coefficients by relaxing with the column bounds, and
+    // discard cuts with a large dynamism
+    cut_index.clear();
+    cut_coefficient.clear();
+    double max_abs_value = 0;
+    double min_abs_value = HIGHS_CONST_INF;
+    for (int col = 0; col < numCol; col++) {
+      const double value = cut_value[col];
+      if (value == 0) continue;
+      if (std::fabs(value) < 1e-9) {
+        const double bound = value > 0 ? mip_.colUpper_[col]
+                                       : mip_.colLower_[col];
+        if (std::fabs(bound) < HIGHS_CONST_INF) {
+          cut_lower -= value * bound;
+          continue;
+        }
+      }
+      cut_index.push_back(col);
+      cut_coefficient.push_back(value);
+      max_abs_value = std::max(std::fabs(value), max_abs_value);
+      min_abs_value = std::min(std::fabs(value), min_abs_value);
+    }
+    if (cut_index.size() == 0 || max_abs_value > 1e6 * min_abs_value) continue;
+
+    // A valid cut is satisfied by any incumbent
+    if (incumbent.size() > 0) {
+      double activity = 0;
+      for (int ix = 0; ix < (int)cut_index.size(); ix++)
+        activity += cut_coefficient[ix] * incumbent[cut_index[ix]];
+      if (activity < cut_lower - mip_heuristic_feasibility_tolerance) continue;
+    }
+    int cut;
+    switch (cut_pool_.addCut(cut_index, cut_coefficient, cut_lower, cut)) {
+      case HighsCutStatus::kAdded:
+        num_new_cut++;
+        break;
+      case HighsCutStatus::kStrengthened:
+        if (cut_pool_.getCut(cut).in_lp) tightenLpCut(cut);
+        break;
+      default:
+        break;
+    }
+  }
+  return num_new_cut;
+}
+
+void HighsMipSolver::tightenLpCut(const int cut) {
+  // The LP row of a cut strengthened in the pool gets its new lower
+  // bound, which leaves the basis valid
+  for (int entry = 0; entry < (int)lp_cut_index_.size(); entry++) {
+    if (lp_cut_index_[entry] != cut) continue;
+    FILE* save_logfile = options_.logfile;
+    options_.logfile = NULL;
+    changeRowBounds(mip_.numRow_ + entry, cut_pool_.getCut(cut).lower,
+                    HIGHS_CONST_INF);
+    options_.logfile = save_logfile;
+    num_lp_cuts_tightened++;
+    return;
+  }
+}
+
+int HighsMipSolver::addPoolCutsToLp(const std::vector<double>& col_value) {
+  std::vector<int> cut_set;
+  cut_pool_.separate(col_value, mip_cut_max_per_round, cut_set);
+  const int num_new_row = cut_set.size();
+  if (num_new_row == 0) return 0;
+  std::vector<double> lower;
+  std::vector<double> upper(num_new_row, HIGHS_CONST_INF);
+  std::vector<int> start;
+  std::vector<int> index;
+  std::vector<double> value;
+  for (int cut : cut_set) {
+    HighsCut& this_cut = cut_pool_.getCut(cut);
+    lower.push_back(this_cut.lower);
+    start.push_back(index.size());
+    index.insert(index.end(), this_cut.index.begin(), this_cut.index.end());
+    value.insert(value.end(), this_cut.value.begin(), this_cut.value.end());
+    this_cut.in_lp = true;
+    lp_cut_index_.push_back(cut);
+  }
+  max_num_lp_cuts = std::max(max_num_lp_cuts, (int)lp_cut_index_.size());
+  // The new rows are basic so the basis remains valid
+  FILE* save_logfile = options_.logfile;
+  options_.logfile = NULL;
+  addRows(num_new_row, &lower[0], &upper[0], index.size(), &start[0],
+          &index[0], &value[0]);
+  options_.logfile = save_logfile;
+  return num_new_row;
+}
+
+int HighsMipSolver::removeSlackLpCuts() {
+  const int numRow = lp_.numRow_;
+  if (!basis_.valid_ || (int)solution_.row_value.size() != numRow) return 0;
+  std::vector<int> mask(numRow, 0);
+  std::vector<int> keep_cut_index;
+  HighsBasis basis;
+  basis.col_status = basis_.col_status;
+  int num_removed = 0;
+  for (int row = 0; row < numRow; row++) {
+    if (row >= mip_.numRow_) {
+      const int cut = lp_cut_index_[row - mip_.numRow_];
+      const double slack = solution_.row_value[row] - lp_.rowLower_[row];
+      if (basis_.row_status[row] == HighsBasisStatus::BASIC &&
+          slack > mip_heuristic_feasibility_tolerance) {
+        mask[row] = 1;
+        cut_pool_.getCut(cut).in_lp = false;
+        num_removed++;
+        continue;
+      }
+      keep_cut_index.push_back(cut);
+    }
+    basis.row_status.push_back(basis_.row_status[row]);
+  }
+  if (num_removed == 0) return 0;
+  // Deleting rows with basic slacks leaves a valid basis, but it has
+  // to be passed back explicitly
+  FILE* save_logfile = options_.logfile;
+  options_.logfile = NULL;
+  deleteRows(&mask[0]);
+  setBasis(basis);
+  options_.logfile = save_logfile;
+  lp_cut_index_ = keep_cut_index;
+  return num_removed;
+}
+
+bool HighsMipSolver::propagateNode(Node& node) {
+  const double start_time = timer_.readRunHighsClock();
+  const bool feasible =
+      domain_.propagate(node.col_lower_bound, node.col_upper_bound);
+  propagation_time += timer_.readRunHighsClock() - start_time;
+  return feasible;
+}
+
+void HighsMipSolver::analyzeLpConflict(const Node& node) {
+  // The row of the basis inverse for a basic variable that violates
+  // its bounds may give a proof of infeasibility
+  const int numCol = lp_.numCol_;
+  const int numRow = lp_.numRow_;
+  if ((int)solution_.col_value.size() != numCol ||
+      (int)solution_.row_value.size() != numRow)
+    return;
+  std::vector<int> basic_variables(numRow);
+  if (getBasicVariables(&basic_variables[0]) != HighsStatus::OK) return;
+  std::vector<std::pair<double, int>> candidates;
+  for (int row = 0; row < numRow; row++) {
+    const int var = basic_variables[row];
+    double value, lower, upper;
+    if (var >= 0) {
+      value = solution_.col_value[var];
+      lower = lp_.colLower_[var];
+      upper = lp_.colUpper_[var];
+    } else {
+      value = solution_.row_value[-var - 1];
+      lower = lp_.rowLower_[-var - 1];
+      upper = lp_.rowUpper_[-var - 1];
+    }
+    const double violation = std::max(lower - value, value - upper);
+    if (violation > mip_heuristic_feasibility_tolerance)
+      candidates.push_back(std::make_pair(-violation, row));
+  }
+  std::sort(candidates.begin(), candidates.end());
+  const int max_num_proof = 3;
+  if ((int)candidates.size() > max_num_proof) candidates.resize(max_num_proof);
+  std::vector<double> inverse_row(numRow);
+  for (const std::pair<double, int>& candidate : candidates) {
+    if (getBasisInverseRow(candidate.second, &inverse_row[0]) !=
+        HighsStatus::OK)
+      return;
+    if (analyzeInfeasibilityProof(node, inverse_row)) return;
+  }
+}
+
+bool HighsMipSolver::analyzeInfeasibilityProof(
+    const Node& node, const std::vector<double>& row_multiplier) {
+  // Aggregating the rows gives sum_j a_j x_j = sum_i y_i r_i, where
+  // the right hand side is bounded by the row bounds, so the
+  // aggregation is globally valid. It proves infeasibility if the
+  // column bounds at the node keep the left hand side out of range.
+  const int numCol = lp_.numCol_;
+  const int numRow = lp_.numRow_;
+  double rhs_lower = 0;
+  double rhs_upper = 0;
+  for (int row = 0; row < numRow; row++) {
+    const double y = row_multiplier[row];
+    if (std::fabs(y) < HIGHS_CONST_TINY) continue;
+    const double lower = y > 0 ? lp_.rowLower_[row] : lp_.rowUpper_[row];
+    const double upper = y > 0 ? lp_.rowUpper_[row] : lp_.rowLower_[row];
+    rhs_lower += std::fabs(lower) < HIGHS_CONST_INF ? y * lower
+                                                    : -HIGHS_CONST_INF;
+    rhs_upper += std::fabs(upper) < HIGHS_CONST_INF ? y * upper
+                                                    : HIGHS_CONST_INF;
+  }
+  std::vector<double> value(numCol, 0);
+  for (int col = 0; col < numCol; col++) {
+    for (int el = lp_.Astart_[col]; el < lp_.Astart_[col + 1]; el++) {
+      const double y = row_multiplier[lp_.Aindex_[el]];
+      if (std::fabs(y) >= HIGHS_CONST_TINY) value[col] += y * lp_.Avalue_[el];
+    }
+  }
+  double min_activity = 0;
+  double max_activity = 0;
+  for (int col = 0; col < numCol; col++) {
+    if (value[col] == 0) continue;
+    const double lower = node.col_lower_bound[col];
+    const double upper = node.col_upper_bound[col];
+    const double min_bound = value[col] > 0 ? lower : upper;
+    const double max_bound = value[col] > 0 ? upper : lower;
+    min_activity += std::fabs(min_bound) < HIGHS_CONST_INF
+                        ? value[col] * min_bound
+                        : -HIGHS_CONST_INF;
+    max_activity += std::fabs(max_bound) < HIGHS_CONST_INF
+                        ? value[col] * max_bound
+                        : HIGHS_CONST_INF;
+  }
+  // Write the proof as sum_j a_j x_j <= rhs with a minimum activity
+  // that exceeds rhs
+  double sign;
+  double slack;
+  if (min_activity > -HIGHS_CONST_INF && rhs_upper < HIGHS_CONST_INF &&
+      min_activity > rhs_upper) {
+    sign = 1;
+    slack = min_activity - rhs_upper;
+  } else if (max_activity < HIGHS_CONST_INF &&
+             rhs_lower > -HIGHS_CONST_INF && max_activity < rhs_lower) {
+    sign = -1;
+    slack = rhs_lower - max_activity;
+  } else {
+    return false;
+  }
+  const double tolerance =
+      mip_heuristic_feasibility_tolerance *
+      std::max(1.0, std::fabs(sign > 0 ? rhs_upper : rhs_lower));
+  if (slack <= tolerance) return false;
+
+  // Relax node bounds back to the global bounds, cheapest first, for
+  // as long as the proof remains valid. The remaining node bounds form
+  // the conflict.
+  std::vector<std::pair<double, int>> candidates;
+  for (int col = 0; col < numCol; col++) {
+    const double a = sign * value[col];
+    if (a == 0) continue;
+    double relax;
+    if (a > 0) {
+      if (node.col_lower_bound[col] <= global_col_lower_[col]) continue;
+      relax = global_col_lower_[col] > -HIGHS_CONST_INF
+                  ? a * (node.col_lower_bound[col] - global_col_lower_[col])
+                  : HIGHS_CONST_INF;
+    } else {
+      if (node.col_upper_bound[col] >= global_col_upper_[col]) continue;
+      relax = global_col_upper_[col] < HIGHS_CONST_INF
+                  ? -a * (global_col_upper_[col] - node.col_upper_bound[col])
+                  : HIGHS_CONST_INF;
+    }
+    candidates.push_back(std::make_pair(relax, col));
+  }
+  std::sort(candidates.begin(), candidates.end());
+  std::vector<HighsConflictLiteral> literals;
+  for (const std::pair<double, int>& candidate : candidates) {
+    if (candidate.first < slack - tolerance) {
+      slack -= candidate.first;
+      continue;
+    }
+    const int col = candidate.second;
+    if (sign * value[col] > 0) {
+      literals.push_back({col, false, node.col_lower_bound[col]});
+    } else {
+      literals.push_back({col, true, node.col_upper_bound[col]});
+    }
+  }
+  return addConflict(literals);
+}
+
+void HighsMipSolver::analyzePropagationConflict(const Node& node) {
+  // Candidate literals are the bounds at the node that are tighter
+  // than the global bounds
+  std::vector<HighsConflictLiteral> literals;
+  for (int col = 0; col < mip_.numCol_; col++) {
+    if (node.col_lower_bound[col] > global_col_lower_[col])
+      literals.push_back({col, false, node.col_lower_bound[col]});
+    if (node.col_upper_bound[col] < global_col_upper_[col])
+      literals.push_back({col, true, node.col_upper_bound[col]});
+  }
+  if ((int)literals.size() > mip_conflict_max_candidates) return;
+
+  // Propagation of the global bounds with all but one literal shows
+  // whether that literal can be dropped
+  std::vector<double> col_lower;
+  std::vector<double> col_upper;
+  auto isInfeasible = [&](const int skip) {
+    col_lower = global_col_lower_;
+    col_upper = global_col_upper_;
+    for (int ix = 0; ix < (int)literals.size(); ix++) {
+      if (ix == skip) continue;
+      const HighsConflictLiteral& literal = literals[ix];
+      if (literal.upper) {
+        col_upper[literal.col] = literal.value;
+      } else {
+        col_lower[literal.col] = literal.value;
+      }
+    }
+    return !domain_.propagate(col_lower, col_upper);
+  };
+  if (!isInfeasible(-1)) return;
+  for (int ix = (int)literals.size() - 1; ix >= 0; ix--) {
+    if (isInfeasible(ix)) literals.erase(literals.begin() + ix);
+  }
+  addConflict(literals);
+}
+
+bool HighsMipSolver::addConflict(
+    const std::vector<HighsConflictLiteral>& literals) {
+  // Guard against numerical trouble: the incumbent cannot satisfy
+  // all the literals of a valid conflict
+  const std::vector<double>& incumbent = tree_.getBestSolution();
+  if (incumbent.size() > 0) {
+    bool all_hold = true;
+    for (const HighsConflictLiteral& literal : literals) {
+      const double x = incumbent[literal.col];
+      const double tolerance = mip_heuristic_feasibility_tolerance;
+      if (literal.upper ? x > literal.value + tolerance
+                        : x < literal.value - tolerance) {
+        all_hold = false;
+        break;
+      }
+    }
+    if (all_hold) return false;
+  }
+  return conflict_pool_.addConflict(literals) >= 0;
+}
+
+void HighsMipSolver::runHeuristics(const Node& node, const bool root) {
+  const double effort = options_mip_.mip_heuristic_effort;
+  if (effort <= 0) return;
+  if ((int)mip_.integrality_.size() != mip_.numCol_) return;
+  if (node.objective_value >= tree_.getBestObjective()) return;
+
+  auto callHeuristic = [&](const HighsMipHeuristic heuristic) {
+    const double start_time = timer_.readRunHighsClock();
+    if (start_time > options_.time_limit) return;
+    if (!heuristic_stats_.allowCall(heuristic, effort, start_time)) return;
+    bool success = false;
+    switch (heuristic) {
+      case HighsMipHeuristic::kSimpleRounding:
+      case HighsMipHeuristic::kShiftRounding:
+        success = runRounding(node, heuristic);
+        break;
+      case HighsMipHeuristic::kFractionalDiving:
+      case HighsMipHeuristic::kCoefficientDiving:
+        success = runDive(node, heuristic);
+        break;
+      case HighsMipHeuristic::kRins:
+        success = runRins(node);
+        break;
+      default:
+        break;
+    }
+    heuristic_stats_.recordCall(
+        heuristic, timer_.readRunHighsClock() - start_time, success);
+  };
+
+  // Rounding is cheap so is tried at every node
+  callHeuristic(HighsMipHeuristic::kSimpleRounding);
+  callHeuristic(HighsMipHeuristic::kShiftRounding);
+  if (!root && num_nodes_solved % mip_heuristic_node_frequency != 0) return;
+  callHeuristic(HighsMipHeuristic::kFractionalDiving);
+  callHeuristic(HighsMipHeuristic::kCoefficientDiving);
+  if (tree_.getBestSolution().size() > 0)
+    callHeuristic(HighsMipHeuristic::kRins);
+}
+
+bool HighsMipSolver::runRounding(const Node& node,
+                                 const HighsMipHeuristic heuristic) {
+  std::vector<double> solution;
+  bool found;
+  if (heuristic == HighsMipHeuristic::kSimpleRounding) {
+    found = rounding_.simpleRounding(node.col_lower_bound, node.col_upper_bound,
+                                     node.primal_solution, solution);
+  } else {
+    found = rounding_.shiftRounding(node.col_lower_bound, node.col_upper_bound,
+                                    node.primal_solution, solution);
+  }
+  if (!found) return false;
+  return tree_.updateBestSolution(solution,
+                                  rounding_.objectiveValue(solution));
+}
+
+bool HighsMipSolver::runDive(const Node& node,
+                             const HighsMipHeuristic heuristic) {
+  // Repeatedly bound a fractional integer variable and re-solve the
+  // LP. Each LP is hot started from the basis of the previous one.
+  Node dive(node.id, node.objective_value, node.id, node.level);
+  dive.integer_variables = node.integer_variables;
+  dive.col_lower_bound = node.col_lower_bound;
+  dive.col_upper_bound = node.col_upper_bound;
+  dive.primal_solution = node.primal_solution;
+  dive.objective_value = node.objective_value;
+  const std::vector<int>& down_locks = rounding_.getDownLocks();
+  const std::vector<int>& up_locks = rounding_.getUpLocks();
+  bool backtracked = false;
+  std::vector<double> solution;
+  for (int lp_solve = 0; lp_solve < mip_dive_max_lp_solves; lp_solve++) {
+    if (dive.objective_value >= tree_.getBestObjective()) return false;
+    if (timer_.readRunHighsClock() > options_.time_limit) return false;
+    if (rounding_.simpleRounding(dive.col_lower_bound, dive.col_upper_bound,
+                                 dive.primal_solution, solution))
+      return tree_.updateBestSolution(solution,
+                                      rounding_.objectiveValue(solution));
+
+    // Fractional diving bounds the variable closest to integrality;
+    // coefficient diving the one with fewest locks in its direction
+    int dive_col = -1;
+    bool dive_up = false;
+    int best_locks = HIGHS_CONST_I_INF;
+    double best_fraction = HIGHS_CONST_INF;
+    for (int col = 0; col < mip_.numCol_; col++) {
+      if (!mip_.integrality_[col]) continue;
+      const double value = dive.primal_solution[col];
+      if (!HighsMipRounding::isFractional(value)) continue;
+      const double fraction = value - std::floor(value);
+      bool up;
+      int locks = 0;
+      if (heuristic == HighsMipHeuristic::kCoefficientDiving) {
+        up = up_locks[col] < down_locks[col] ||
+             (up_locks[col] == down_locks[col] && fraction >= 0.5);
+        locks = up ? up_locks[col] : down_locks[col];
+      } else {
+        up = fraction >= 0.5;
+      }
+      const double distance = up ? 1 - fraction : fraction;
+      if (locks < best_locks ||
+          (locks == best_locks && distance < best_fraction)) {
+        dive_col = col;
+        dive_up = up;
+        best_locks = locks;
+        best_fraction = distance;
+      }
+    }
+    // An integer LP solution would have been accepted by rounding
+    if (dive_col < 0) return false;
+
+    const double value = dive.primal_solution[dive_col];
+    const double save_lower = dive.col_lower_bound[dive_col];
+    const double save_upper = dive.col_upper_bound[dive_col];
+    if (dive_up) {
+      dive.col_lower_bound[dive_col] = std::ceil(value);
+    } else {
+      dive.col_upper_bound[dive_col] = std::floor(value);
+    }
+    HighsMipStatus dive_status = solveNode(dive);
+    if (dive_status == HighsMipStatus::kNodeInfeasible && !backtracked) {
+      // Try the other direction once
+      backtracked = true;
+      dive.col_lower_bound[dive_col] = save_lower;
+      dive.col_upper_bound[dive_col] = save_upper;
+      if (dive_up) {
+        dive.col_upper_bound[dive_col] = std::floor(value);
+      } else {
+        dive.col_lower_bound[dive_col] = std::ceil(value);
+      }
+      dive_status = solveNode(dive);
+    }
+    if (dive_status != HighsMipStatus::kNodeOptimal) return false;
+  }
+  return false;
+}
+
+bool HighsMipSolver::runRins(const Node& node) {
+  // Fix the integer variables on which the node LP solution and the
+  // incumbent agree, and solve the remaining sub-MIP with a node limit
+  const std::vector<double>& incumbent = tree_.getBestSolution();
+  if (incumbent.size() == 0) return false;
+  HighsLp sub_mip = mip_;
+  int num_integer = 0;
+  int num_fixed = 0;
+  for (int col = 0; col < mip_.numCol_; col++) {
+    if (!mip_.integrality_[col]) continue;
+    num_integer++;
+    if (std::fabs(node.primal_solution[col] - incumbent[col]) >
+        mip_heuristic_integrality_tolerance)
+      continue;
+    const double value = std::floor(incumbent[col] + 0.5);
+    sub_mip.colLower_[col] = value;
+    sub_mip.colUpper_[col] = value;
+    num_fixed++;
+  }
+  if (num_fixed == num_integer) return false;
+  if (num_fixed < mip_rins_min_fixed_fraction * num_integer) return false;
+
+  HighsOptions sub_options = options_mip_;
+  sub_options.message_level = 0;
+  sub_options.logfile = NULL;
+  sub_options.output = NULL;
+  sub_options.mip_report_level = 0;
+  sub_options.mip_heuristic_effort = 0;
+  sub_options.mip_cut_rounds = 0;
+  sub_options.mip_max_nodes = options_mip_.mip_rins_max_nodes;
+  // The sub-MIP must not read, overwrite or remove the checkpoint of
+  // this MIP
+  sub_options.mip_checkpoint_file = "";
+  sub_options.time_limit = options_.time_limit - timer_.readRunHighsClock();
+  if (sub_options.time_limit <= 0) return false;
+  HighsMipSolver sub_solver(sub_options, sub_mip);
+  sub_solver.runMipSolver();
+  const std::vector<double>& sub_solution = sub_solver.mip_solution_;
+  if (sub_solution.size() == 0) return false;
+  return tree_.updateBestSolution(sub_solution,
+                                  sub_solver.tree_.getBestObjective());
+}
+
 void HighsMipSolver::reportMipSolverProgress(const HighsMipStatus mip_status) {
   if (options_.mip_report_level == 1) {
     int report_frequency = 100;
@@ -12,6 +12,12 @@
 
 #include "Highs.h"
 #include "lp_data/HighsOptions.h"
+#include "mip/HighsConflictPool.h"
+#include "mip/HighsCutPool.h"
+#include "mip/HighsDomain.h"
+#include "mip/HighsMipCheckpoint.h"
+#include "mip/HighsMipHeuristics.h"
+#include "mip/HighsMipPresolve.h"
 #include "mip/SolveMip.h"
 
 enum class HighsMipStatus {
@@ -35,20 +41,57 @@ enum class HighsMipStatus {
 const double unscaled_primal_feasibility_tolerance = 1e-4;
 const double unscaled_dual_feasibility_tolerance = 1e-4;
 
+// The MIP is presolved again at the root if at least this fraction of
+// its integer columns are fixed there, at most this number of times
+const double mip_restart_min_fixed_fraction = 0.1;
+const int mip_max_root_restarts = 2;
+
 class HighsMipSolver : Highs {
  public:
   HighsMipSolver(const HighsOptions& options, const HighsLp& lp)
-      : options_mip_(options), mip_(lp) {}
+      : options_mip_(options),
+        original_mip_(lp),
+        mip_(lp),
+        mip_presolve_(timer_) {}
 
   HighsMipStatus runMipSolver();
 
+  // The incumbent for the original MIP, empty if none was found
+  const std::vector<double>& getMipSolution() const { return mip_solution_; }
+  const HighsMipHeuristicStats& getHeuristicStats() const {
+    return heuristic_stats_;
+  }
+  int getMaxNumLpCuts() const { return max_num_lp_cuts; }
+  int getNumNodeLpCutsRemoved() const { return num_node_lp_cuts_removed; }
+
  private:
 #ifdef HiGHSDEV
   void writeSolutionForIntegerVariables(Node& node);
 #endif
+  void setupMipModel();
+  HighsMipStatus setupRootNode(Node& root, bool& root_feasible);
+  int fixRootColumns(Node& root);
+  HighsMipStatus restartRoot(Node& root, bool& root_feasible);
   HighsMipStatus solveRootNode();
   HighsMipStatus solveNode(Node& node, bool hotstart = true);
   HighsMipStatus solveTree(Node& root);
+  HighsMipStatus separateRootCuts();
+  int generateGomoryCuts();
+  int addPoolCutsToLp(const std::vector<double>& col_value);
+  void tightenLpCut(const int cut);
+  int removeSlackLpCuts();
+  bool propagateNode(Node& node);
+  void analyzeLpConflict(const Node& node);
+  bool analyzeInfeasibilityProof(const Node& node,
+                                 const std::vector<double>& row_multiplier);
+  void analyzePropagationConflict(const Node& node);
+  bool addConflict(const std::vector<HighsConflictLiteral>& literals);
+  void writeCheckpoint(const bool final);
+  bool resumeFromCheckpoint();
+  void runHeuristics(const Node& node, const bool root);
+  bool runRounding(const Node& node, const HighsMipHeuristic heuristic);
+  bool runDive(const Node& node, const HighsMipHeuristic heuristic);
+  bool runRins(const Node& node);
   void reportMipSolverProgress(const HighsMipStatus mip_status);
   void reportMipSolverProgressLine(std::string message,
                                    const bool header = false);
@@ -56,7 +99,54 @@ class HighsMipSolver : Highs {
 
   Tree tree_;
   const HighsOptions options_mip_;
-  const HighsLp mip_;
+  const HighsLp original_mip_;
+  // The MIP solved by branch-and-bound, which is the original MIP
+  // unless it is reduced by presolve
+  HighsLp mip_;
+  HighsMipPresolve mip_presolve_;
+  bool mip_presolved_ = false;
+  // The incumbent for the original MIP
+  std::vector<double> mip_solution_;
+
+  HighsMipRounding rounding_;
+  HighsMipHeuristicStats heuristic_stats_;
+
+  HighsCutPool cut_pool_;
+  // Pool index of each cut in the LP, whose rows follow those of mip_
+  std::vector<int> lp_cut_index_;
+  int num_cut_rounds = 0;
+  int num_lp_cuts_tightened = 0;
+  int max_num_lp_cuts = 0;
+  // Slack cuts removed from node LPs when pool cuts are added at nodes
+  int num_node_lp_cuts_removed = 0;
+
+  HighsDomain domain_;
+  // Nodes found to be infeasible by propagation, so their LPs are
+  // not solved
+  int num_nodes_propagated_infeasible = 0;
+  double propagation_time = 0;
+
+  // Conflicts are learned relative to the bounds at the root, after
+  // propagation
+  bool use_conflicts_ = false;
+  HighsConflictPool conflict_pool_;
+  std::vector<double> global_col_lower_;
+  std::vector<double> global_col_upper_;
+  int num_nodes_pruned_by_conflicts = 0;
+
+  // Checkpoints of the tree search are written periodically when a
+  // checkpoint file is given
+  bool use_checkpoints_ = false;
+  uint64_t model_hash_ = 0;
+  HighsMipCheckpointWriter checkpoint_writer_;
+  double last_checkpoint_time_ = 0;
+  bool resumed_from_checkpoint_ = false;
+
+  // Reduced costs of the root LP solution, used to fix columns once
+  // there is an incumbent
+  std::vector<double> root_reduced_cost_;
+  int num_reduced_cost_fixings = 0;
+  int num_root_restarts = 0;
 
   int num_nodes_solved = 0;
   int num_nodes_pruned = 0;
@@ -131,6 +131,18 @@ bool Tree::branch(Node& node) {
   return true;
 }
 
+bool Tree::updateBestSolution(const std::vector<double>& solution,
+                              const double objective) {
+  // Assuming minimization.
+  if (objective >= best_objective_) return false;
+  num_integer_solutions++;
+  best_objective_ = objective;
+  best_solution_ = solution;
+  if (mip_report_level > 1)
+    printf("Heuristic solution: !! Updating best !! %10.4g\n", objective);
+  return true;
+}
+
 double Tree::getBestBound(int& best_node) {
   int stack_size = nodes_.size();
   double best_bound = HIGHS_CONST_INF;
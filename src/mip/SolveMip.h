@@ -14,6 +14,7 @@
 #include <functional>
 #include <memory>
 #include <stack>
+#include <utility>
 #include <vector>
 
 #include "lp_data/HConst.h"
@@ -70,10 +71,21 @@ class Tree {
   bool branch(Node& node);
 
   Node& next() { return nodes_[nodes_.size() - 1]; }
+  const Node& getNode(const int entry) const { return nodes_[entry]; }
+  // Add an open node that is not the child of a node in the tree, for
+  // example when resuming from a checkpoint
+  void pushNode(std::unique_ptr<Node> node) {
+    nodes_.push_back(std::reference_wrapper<Node>(*node));
+    detached_nodes_.push_back(std::move(node));
+  }
   void pop() { nodes_.erase(nodes_.end() - 1); }
   bool empty() { return (nodes_.size() == 0); }
 
   const std::vector<double>& getBestSolution() const { return best_solution_; }
+  // Offer a solution found other than at a leaf of the tree, for
+  // example by a primal heuristic. Returns true if it is the new best.
+  bool updateBestSolution(const std::vector<double>& solution,
+                          const double objective);
 
   double getBestObjective() { return best_objective_; }
   double getBestBound(int& best_node);
@@ -82,12 +94,19 @@ class Tree {
     return 1 + num_nodes;
   }  // Root node plus nodes formed by branching
   int getNumNodesLeft() { return (int)nodes_.size(); }
+  void setNumNodesFormed(const int num_nodes_formed) {
+    num_nodes = num_nodes_formed - 1;
+  }
+  void setNumIntegerSolutions(const int num_integer_solutions_) {
+    num_integer_solutions = num_integer_solutions_;
+  }
   void setMipReportLevel(const int mip_report_level_) {
     mip_report_level = mip_report_level_;
   }
 
  private:
   std::vector<std::reference_wrapper<Node> > nodes_;
+  std::vector<std::unique_ptr<Node> > detached_nodes_;
   std::vector<double> best_solution_;
   double best_objective_ = HIGHS_CONST_INF;
 
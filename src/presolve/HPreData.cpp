@@ -13,6 +13,18 @@
  */
 #include "presolve/HPreData.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+
+#ifndef _WIN32
+#define HIGHS_POSTSOLVE_LOG_MMAP
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 using std::cout;
 using std::endl;
 using std::setw;
@@ -96,6 +108,292 @@ void HPreData::makeACopy() {
   for (int i = 0; i < numColOriginal; i++) Aend[i] = Astart[i + 1];
 }
 
+void ChangeQueue::setup(const int size) {
+  log_.resize(size);
+  logged_at_.resize(size);
+  for (int index = 0; index < size; index++) {
+    log_[index] = index;
+    logged_at_[index] = index;
+  }
+  marked_at_.assign(size, -1);
+  taken_.assign(size, -1);
+  touched_at_.assign(size, 0);
+  num_touches_ = 0;
+  latest_take_ = 0;
+  num_takes_ = 0;
+}
+
+bool ChangeQueue::mark(const int index) {
+  if (marked_at_[index] >= latest_take_) return false;
+  marked_at_[index] = (int)log_.size();
+  log(index);
+  return true;
+}
+
+void ChangeQueue::log(const int index) {
+  touch(index);
+  // Rules take all of the log from where they last took it, so an
+  // entry logged since the latest take will be seen by every rule
+  if (logged_at_[index] >= latest_take_) return;
+  logged_at_[index] = (int)log_.size();
+  log_.push_back(index);
+}
+
+void ChangeQueue::take(int& rule_position, vector<int>& entries) {
+  entries.clear();
+  num_takes_++;
+  const int log_size = (int)log_.size();
+  for (int position = rule_position; position < log_size; position++) {
+    const int index = log_[position];
+    if (taken_[index] == num_takes_) continue;
+    taken_[index] = num_takes_;
+    entries.push_back(index);
+  }
+  rule_position = log_size;
+  latest_take_ = log_size;
+}
+
+void LiveEntries::setup(const int size) {
+  next_.resize(size);
+  for (int k = 0; k < size; k++) next_[k] = k;
+}
+
+void LiveEntries::extend(const int size) {
+  const int from = (int)next_.size();
+  next_.resize(size);
+  for (int k = from; k < size; k++) next_[k] = k;
+}
+
+void LiveEntries::reset(const int from, const int to) {
+  for (int k = from; k < to; k++) next_[k] = k;
+}
+
+int LiveEntries::first(const int from, const int to, const vector<int>& index,
+                       const vector<int>& flag) {
+  // A position linking to itself has not been found dead. The links
+  // never pass the end of the row or column they were followed in
+  int live = from;
+  while (live < to) {
+    if (next_[live] != live) {
+      live = next_[live];
+    } else if (flag[index[live]]) {
+      break;
+    } else {
+      next_[live] = live + 1;
+      live++;
+    }
+  }
+  for (int k = from; k < live;) {
+    const int next = next_[k];
+    next_[k] = live;
+    k = next;
+  }
+  return live;
+}
+
+void PostsolveBoundsStack::push(const int index,
+                                std::initializer_list<double> value) {
+  push(index, value.begin(), (int)value.size());
+}
+
+void PostsolveBoundsStack::push(const int index, const vector<double>& value) {
+  push(index, value.data(), (int)value.size());
+}
+
+void PostsolveBoundsStack::push(const int index, const double* value,
+                                const int size) {
+  // The values follow the index and size, aligned as the payload is
+  char* payload =
+      log_->append(channel_, 2 * sizeof(int) + size * sizeof(double));
+  std::memcpy(payload, &index, sizeof(int));
+  std::memcpy(payload + sizeof(int), &size, sizeof(int));
+  if (size)
+    std::memcpy(payload + 2 * sizeof(int), value, size * sizeof(double));
+}
+
+PostsolveBounds PostsolveBoundsStack::top() const {
+  const char* payload = log_->top(channel_);
+  PostsolveBounds bounds;
+  std::memcpy(&bounds.index, payload, sizeof(int));
+  std::memcpy(&bounds.size, payload + sizeof(int), sizeof(int));
+  bounds.value = reinterpret_cast<const double*>(payload + 2 * sizeof(int));
+  return bounds;
+}
+
+void PostsolveBoundsStack::pop() { log_->pop(channel_); }
+
+bool PostsolveBoundsStack::empty() const { return log_->empty(channel_); }
+
+size_t PostsolveBoundsStack::size() const { return log_->size(channel_); }
+
+size_t PostsolveBoundsStack::topValuePosition(const int k) const {
+  return log_->position(channel_) + 2 * sizeof(int) + k * sizeof(double);
+}
+
+PostsolveLog::PostsolveLog()
+    : chng(this, kChange), postValue(this, kValue), oldBounds(this, kBounds) {
+  clear();
+}
+
+PostsolveLog::PostsolveLog(const PostsolveLog& other)
+    : chng(this, kChange), postValue(this, kValue), oldBounds(this, kBounds) {
+  clear();
+  copy(other);
+}
+
+PostsolveLog& PostsolveLog::operator=(const PostsolveLog& other) {
+  if (this != &other) {
+    clear();
+    copy(other);
+  }
+  return *this;
+}
+
+PostsolveLog::~PostsolveLog() { release(); }
+
+void PostsolveLog::clear() {
+  release();
+  last_ = kNone;
+  for (int channel = 0; channel < kNumChannel; channel++) {
+    top_[channel] = kNone;
+    count_[channel] = 0;
+  }
+}
+
+char* PostsolveLog::append(const int channel, const size_t payload_size) {
+  const size_t header_words = sizeof(RecordHeader) / kWord;
+  const size_t payload_words = (payload_size + kWord - 1) / kWord;
+  if (payload_words > kMaxRecordWords - header_words)
+    throw std::length_error("Postsolve log record too large");
+  const size_t words = header_words + payload_words;
+  reserve(size_ + words * kWord);
+  const int64_t offset = (int64_t)size_;
+  RecordHeader* record = header(offset);
+  if (top_[channel] == kNone) {
+    record->previous = 0;
+  } else {
+    record->previous = (uint64_t)((offset - top_[channel]) / kWord);
+  }
+  record->size = (uint32_t)words;
+  record->preceding_size = last_ == kNone ? 0 : header(last_)->size;
+  last_ = offset;
+  top_[channel] = offset;
+  count_[channel]++;
+  size_ += words * kWord;
+  return data_ + offset + sizeof(RecordHeader);
+}
+
+const char* PostsolveLog::top(const int channel) const {
+  assert(count_[channel] > 0);
+  return data_ + top_[channel] + sizeof(RecordHeader);
+}
+
+void PostsolveLog::pop(const int channel) {
+  assert(count_[channel] > 0);
+  RecordHeader* record = header(top_[channel]);
+  if (record->previous == 0) {
+    top_[channel] = kNone;
+  } else {
+    top_[channel] -= (int64_t)record->previous * kWord;
+  }
+  record->previous = kPopped;
+  count_[channel]--;
+  // Truncate the buffer behind any popped records at its end. The
+  // memory is kept, so the payload of the popped record can still be
+  // read
+  while (last_ != kNone && header(last_)->previous == kPopped) {
+    size_ = (size_t)last_;
+    last_ = last_ == 0 ? kNone
+                       : last_ - (int64_t)header(last_)->preceding_size * kWord;
+  }
+}
+
+void PostsolveLog::copy(const PostsolveLog& other) {
+  spill_size_ = other.spill_size_;
+  reserve(other.size_);
+  if (other.size_) std::memcpy(data_, other.data_, other.size_);
+  size_ = other.size_;
+  last_ = other.last_;
+  for (int channel = 0; channel < kNumChannel; channel++) {
+    top_[channel] = other.top_[channel];
+    count_[channel] = other.count_[channel];
+  }
+}
+
+void PostsolveLog::reserve(const size_t size) {
+  if (size <= capacity_) return;
+  const size_t capacity = std::max(std::max(size, 2 * capacity_), (size_t)4096);
+  if (spilled() || (spill_size_ > 0 && capacity > spill_size_)) {
+    if (spill(capacity)) return;
+  }
+  // Keep the log on the heap if it cannot be spilled
+  char* data;
+  if (spilled()) {
+    data = static_cast<char*>(std::malloc(capacity));
+    if (data != nullptr) {
+      std::memcpy(data, data_, size_);
+      const size_t size_used = size_;
+      release();
+      size_ = size_used;
+    }
+  } else {
+    data = static_cast<char*>(std::realloc(data_, capacity));
+  }
+  if (data == nullptr) throw std::bad_alloc();
+  data_ = data;
+  capacity_ = capacity;
+}
+
+bool PostsolveLog::spill(const size_t capacity) {
+#ifdef HIGHS_POSTSOLVE_LOG_MMAP
+  int fd = spill_fd_;
+  if (fd < 0) {
+    const char* dir = std::getenv("TMPDIR");
+    string filename = string(dir != nullptr && *dir ? dir : "/tmp") +
+                      "/highs_postsolve_XXXXXX";
+    fd = mkstemp(&filename[0]);
+    if (fd < 0) return false;
+    // The file is removed once it is closed
+    unlink(filename.c_str());
+  }
+  void* map = MAP_FAILED;
+  if (ftruncate(fd, (off_t)capacity) == 0)
+    map = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (map == MAP_FAILED) {
+    if (fd != spill_fd_) close(fd);
+    return false;
+  }
+  if (spilled()) {
+    // The records are already in the file
+    munmap(data_, capacity_);
+  } else {
+    if (size_) std::memcpy(map, data_, size_);
+    std::free(data_);
+  }
+  data_ = static_cast<char*>(map);
+  capacity_ = capacity;
+  spill_fd_ = fd;
+  return true;
+#else
+  return false;
+#endif
+}
+
+void PostsolveLog::release() {
+  if (spilled()) {
+#ifdef HIGHS_POSTSOLVE_LOG_MMAP
+    munmap(data_, capacity_);
+    close(spill_fd_);
+#endif
+    spill_fd_ = -1;
+  } else {
+    std::free(data_);
+  }
+  data_ = nullptr;
+  size_ = 0;
+  capacity_ = 0;
+}
+
 void initPresolve(PresolveStats& stats) {
   std::cout << "Init Presolve form HiGHS" << std::endl;
 }
@@ -14,7 +14,10 @@
 #ifndef PRESOLVE_HPREDATA_H_
 #define PRESOLVE_HPREDATA_H_
 
+#include <cassert>
+#include <cstdint>
 #include <cstring>
+#include <initializer_list>
 #include <list>
 #include <stack>
 #include <utility>
@@ -35,6 +38,179 @@ struct change {
   int col;
 };
 
+// The index and values of a record of the bounds channel of the
+// postsolve log, valid until a record is next appended to the log
+struct PostsolveBounds {
+  int index;
+  int size;
+  const double* value;
+};
+
+class PostsolveLog;
+
+// A channel of the postsolve log used as a stack of values of a type
+// that can be copied bytewise
+template <typename T>
+class PostsolveLogStack {
+ public:
+  PostsolveLogStack(PostsolveLog* log, const int channel)
+      : log_(log), channel_(channel) {}
+
+  void push(const T& value);
+  T top() const;
+  void pop();
+  bool empty() const;
+  size_t size() const;
+  // Position in the log of the value at the top of the stack
+  size_t topPosition() const;
+
+ private:
+  friend class PostsolveLog;
+  PostsolveLog* log_;
+  int channel_;
+};
+
+// The channel of the postsolve log holding an index with the old
+// bounds of a row or column and other values needed to undo a
+// reduction
+class PostsolveBoundsStack {
+ public:
+  PostsolveBoundsStack(PostsolveLog* log, const int channel)
+      : log_(log), channel_(channel) {}
+
+  void push(const int index, std::initializer_list<double> value);
+  void push(const int index, const vector<double>& value);
+  PostsolveBounds top() const;
+  void pop();
+  bool empty() const;
+  size_t size() const;
+  // Position in the log of a value of the top record
+  size_t topValuePosition(const int k) const;
+
+ private:
+  void push(const int index, const double* value, const int size);
+
+  friend class PostsolveLog;
+  PostsolveLog* log_;
+  int channel_;
+};
+
+// The reductions recorded by presolve and undone by postsolve. The
+// records of the changes, values and bounds are appended to one
+// contiguous buffer, each linked to the previous record in its
+// channel, so no record needs an allocation of its own. Postsolve
+// pops the records in reverse order, and the buffer is truncated
+// behind it. A log larger than the spill size is moved to a
+// memory-mapped temporary file, where the operating system pages it
+// out if memory is short.
+class PostsolveLog {
+ public:
+  enum Channel { kChange = 0, kValue, kBounds, kNumChannel };
+
+  PostsolveLog();
+  PostsolveLog(const PostsolveLog& other);
+  PostsolveLog& operator=(const PostsolveLog& other);
+  ~PostsolveLog();
+
+  // Size in bytes above which the log is spilled, or 0 for never
+  void setSpillSize(const size_t spill_size) { spill_size_ = spill_size; }
+  void clear();
+
+  // Append a record of the given size to the channel, returning where
+  // its payload is to be written. Throws std::length_error if the
+  // record is too large for the log
+  char* append(const int channel, const size_t payload_size);
+  const char* top(const int channel) const;
+  void pop(const int channel);
+  bool empty(const int channel) const { return count_[channel] == 0; }
+  size_t size(const int channel) const { return count_[channel]; }
+
+  size_t bytes() const { return size_; }
+  bool spilled() const { return spill_fd_ >= 0; }
+
+  // Position in the buffer of the payload of the top record of the
+  // channel, valid while the record is in the log, and overwrite a
+  // value there, so values recorded by presolve can be updated
+  size_t position(const int channel) const {
+    assert(count_[channel] > 0);
+    return (size_t)top_[channel] + sizeof(RecordHeader);
+  }
+  void write(const size_t position, const double value) {
+    assert(position + sizeof(double) <= size_);
+    std::memcpy(data_ + position, &value, sizeof(double));
+  }
+
+  PostsolveLogStack<change> chng;
+  PostsolveLogStack<double> postValue;
+  PostsolveBoundsStack oldBounds;
+
+ private:
+  // Records are measured in words of 8 bytes, so a record of one
+  // value takes three words. A record can be up to 32GB
+  struct RecordHeader {
+    // Words back to the previous record in the channel, 0 if there is
+    // none, or kPopped
+    uint64_t previous;
+    // Words in this record and in the one before it in the buffer,
+    // including their headers
+    uint32_t size;
+    uint32_t preceding_size;
+  };
+  static const int kWord = 8;
+  static const uint64_t kPopped = 0xFFFFFFFFFFFFFFFF;
+  static const size_t kMaxRecordWords = 0xFFFFFFFF;
+  static const int64_t kNone = -1;
+
+  RecordHeader* header(const int64_t offset) const {
+    return reinterpret_cast<RecordHeader*>(data_ + offset);
+  }
+  void copy(const PostsolveLog& other);
+  void reserve(const size_t size);
+  bool spill(const size_t capacity);
+  void release();
+
+  char* data_ = nullptr;
+  size_t size_ = 0;
+  size_t capacity_ = 0;
+  int64_t last_ = kNone;
+  int64_t top_[kNumChannel];
+  size_t count_[kNumChannel];
+  size_t spill_size_ = 0;
+  int spill_fd_ = -1;
+};
+
+template <typename T>
+void PostsolveLogStack<T>::push(const T& value) {
+  std::memcpy(log_->append(channel_, sizeof(T)), &value, sizeof(T));
+}
+
+template <typename T>
+T PostsolveLogStack<T>::top() const {
+  T value;
+  std::memcpy(&value, log_->top(channel_), sizeof(T));
+  return value;
+}
+
+template <typename T>
+void PostsolveLogStack<T>::pop() {
+  log_->pop(channel_);
+}
+
+template <typename T>
+bool PostsolveLogStack<T>::empty() const {
+  return log_->empty(channel_);
+}
+
+template <typename T>
+size_t PostsolveLogStack<T>::size() const {
+  return log_->size(channel_);
+}
+
+template <typename T>
+size_t PostsolveLogStack<T>::topPosition() const {
+  return log_->position(channel_);
+}
+
 class HPreData {
  public:
   HPreData();
@@ -98,16 +274,87 @@ class HPreData {
   bool isZeroA(int i, int j);
   double getRowValue(int i);
 
-  stack<double> postValue;
-
   // to match reduced solution to original
   vector<int> rIndex;
   vector<int> cIndex;
 
   dev_kkt_check::KktChStep chk2;
 
-  stack<change> chng;
-  stack<pair<int, vector<double>>> oldBounds;  //(j, l, u)
+  PostsolveLog postsolveLog;
+};
+
+// Rows or columns modified by reductions. Each presolve rule that
+// scans rows or columns takes the entries logged since it last ran,
+// so a pass costs time proportional to the changes since the previous
+// pass rather than to the size of the problem.
+class ChangeQueue {
+ public:
+  // Log every entry, so that each rule first scans them all
+  void setup(const int size);
+  // Log the entry unless every rule will already see it. Returns
+  // false if the entry was already marked since the latest rule ran,
+  // in which case its neighbours need not be logged again
+  bool mark(const int index);
+  void log(const int index);
+  // Get the entries logged since the rule last took them, each once
+  void take(int& rule_position, vector<int>& entries);
+  // Record that the entry has changed without logging it again, so
+  // that results computed for it before are known to be out of date
+  void touch(const int index) { touched_at_[index] = ++num_touches_; }
+  int numTouches() const { return num_touches_; }
+  bool touchedSince(const int index, const int num_touches) const {
+    return touched_at_[index] > num_touches;
+  }
+
+ private:
+  vector<int> log_;
+  // Position in the log of the latest entry for each index, and of
+  // the latest mark
+  vector<int> logged_at_;
+  vector<int> marked_at_;
+  vector<int> taken_;
+  // The count of touches when each entry was last logged or touched
+  vector<int> touched_at_;
+  int num_touches_ = 0;
+  // Log length when the latest rule took its entries
+  int latest_take_ = 0;
+  int num_takes_ = 0;
+};
+
+// Links past the dead entries of the rows or the columns of a matrix,
+// so iterating over a row or column costs time proportional to its
+// live entries rather than its length. An entry is dead once the
+// column or row of its index has been removed, which presolve never
+// undoes. Each position links to the next one that may be live, and
+// the links are shortened as they are followed, as in union-find. The
+// links of a row or column whose indices change in place are reset.
+class LiveEntries {
+ public:
+  void setup(const int size);
+  // Link the positions appended to the matrix
+  void extend(const int size);
+  void reset(const int from, const int to);
+  // The first live entry of the row or column ending at to, at or
+  // after from, or to if there is none. Concurrent calls are safe for
+  // distinct rows or columns
+  int first(const int from, const int to, const vector<int>& index,
+            const vector<int>& flag);
+
+ private:
+  vector<int> next_;
+};
+
+// Minimum and maximum activity of a row over the bounds of its
+// columns. The finite contributions are summed and the infinite ones
+// counted, so the activity of the row without one of its columns is
+// known in O(1)
+struct RowActivity {
+  double min_sum = 0;
+  double max_sum = 0;
+  int min_inf = 0;
+  int max_inf = 0;
+  double min() const { return min_inf ? -HIGHS_CONST_INF : min_sum; }
+  double max() const { return max_inf ? HIGHS_CONST_INF : max_sum; }
 };
 
 struct MainLoop {
@@ -116,6 +363,19 @@ struct MainLoop {
   int nnz;
 };
 
+// Cost and benefit of a presolver of the main loop. One whose
+// reductions are few for its work is skipped until the pass given,
+// with the interval doubling each time it falls short again
+struct PresolverRecord {
+  int calls = 0;
+  int skips = 0;
+  double time = 0;
+  double work = 0;
+  int reductions = 0;
+  int interval = 1;
+  int next_pass = 0;
+};
+
 struct DevStats {
   int n_loops = 0;
   std::vector<MainLoop> loops;
@@ -123,6 +383,10 @@ struct DevStats {
 
 struct PresolveStats {
   DevStats dev;
+  // Rows and columns scanned by the presolve rules in each pass of
+  // the main loop, counting their nonzeros, and in total
+  std::vector<int> pass_work;
+  double work = 0;
 
   int n_rows_removed = 0;
   int n_cols_removed = 0;
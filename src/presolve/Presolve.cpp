@@ -23,6 +23,7 @@
 #include <iterator>
 #include <queue>
 #include <sstream>
+#include <unordered_map>
 
 #include "io/HighsIO.h"
 #include "lp_data/HConst.h"
@@ -81,6 +82,7 @@ void Presolve::setNumericalTolerances() {
     empty_row_bound_tolerance = tol;
     dominated_column_tolerance = tol;
     weakly_dominated_column_tolerance = tol;
+    duplicate_tolerance = tol;
   } else {
     // Tolerance on bounds being inconsistent: should be twice
     // primal_feasibility_tolerance since bounds inconsistent by this
@@ -116,6 +118,12 @@ void Presolve::setNumericalTolerances() {
     empty_row_bound_tolerance = default_primal_feasiblility_tolerance;
     dominated_column_tolerance = default_dual_feasiblility_tolerance;
     weakly_dominated_column_tolerance = default_dual_feasiblility_tolerance;
+    // Relative tolerance on the coefficients of two rows or columns
+    // being in the same ratio, allowing them to be merged. Since the
+    // ratio is applied to the bounds of the row or column that is
+    // kept, it should be small enough to treat them as exactly
+    // parallel.
+    duplicate_tolerance = 1e-12;
   }
   timer.model_name = modelName;
   // Initialise the numerics records. JAJH thinks that this has to be
@@ -243,13 +251,27 @@ int Presolve::runPresolvers(const std::vector<Presolver>& order) {
   checkBoundsAreConsistent();
   if (status) return status;
 
+  const int pass = (int)stats.pass_work.size();
   for (Presolver main_loop_presolver : order) {
+    if (stats.work >= workLimit) {
+      workLimitReached = true;
+      break;
+    }
+    PresolverRecord& record = presolverRecords[main_loop_presolver];
+    if (throttlePresolvers && pass < record.next_pass) {
+      record.skips++;
+      presolverSkipped = true;
+      continue;
+    }
     double time_start = timer.timer_.readRunHighsClock();
+    const double work_start = stats.work;
+    const int changes_start = timer.numChanges();
     if (iPrint) std::cout << "----> ";
     auto it = kPresolverNames.find(main_loop_presolver);
     assert(it != kPresolverNames.end());
     if (iPrint) std::cout << (*it).second << std::endl;
 
+    PresolveRule rule = REMOVE_ROW_SINGLETONS;
     switch (main_loop_presolver) {
       case Presolver::kMainRowSingletons:
         timer.recordStart(REMOVE_ROW_SINGLETONS);
@@ -257,28 +279,59 @@ int Presolve::runPresolvers(const std::vector<Presolver>& order) {
         timer.recordFinish(REMOVE_ROW_SINGLETONS);
         break;
       case Presolver::kMainForcing:
+        rule = REMOVE_FORCING_CONSTRAINTS;
         timer.recordStart(REMOVE_FORCING_CONSTRAINTS);
         removeForcingConstraints();
         timer.recordFinish(REMOVE_FORCING_CONSTRAINTS);
         break;
       case Presolver::kMainColSingletons:
+        rule = REMOVE_COLUMN_SINGLETONS;
         timer.recordStart(REMOVE_COLUMN_SINGLETONS);
         removeColumnSingletons();
         timer.recordFinish(REMOVE_COLUMN_SINGLETONS);
         break;
       case Presolver::kMainDoubletonEq:
+        rule = REMOVE_DOUBLETON_EQUATIONS;
         timer.recordStart(REMOVE_DOUBLETON_EQUATIONS);
         removeDoubletonEquations();
         timer.recordFinish(REMOVE_DOUBLETON_EQUATIONS);
         break;
       case Presolver::kMainDominatedCols:
+        rule = REMOVE_DOMINATED_COLUMNS;
         timer.recordStart(REMOVE_DOMINATED_COLUMNS);
         removeDominatedColumns();
         timer.recordFinish(REMOVE_DOMINATED_COLUMNS);
         break;
+      case Presolver::kMainDuplicateRows:
+        rule = DUPLICATE_ROWS;
+        findDuplicateRows();
+        break;
+      case Presolver::kMainDuplicateCols:
+        rule = DUPLICATE_COLS;
+        findDuplicateColumns();
+        break;
+      case Presolver::kMainImpliedBounds:
+        rule = IMPLIED_BOUNDS;
+        tightenImpliedBounds();
+        break;
     }
 
     double time_end = timer.timer_.readRunHighsClock();
+    const double work = stats.work - work_start;
+    const int reductions = timer.numChanges() - changes_start;
+    timer.addWork(rule, work);
+    record.calls++;
+    record.time += time_end - time_start;
+    record.work += work;
+    record.reductions += reductions;
+    // A presolver that falls short of paying off is skipped for twice
+    // as many passes as the last time it did
+    if (reductions < min_reductions_per_work * work) {
+      record.interval *= 2;
+      record.next_pass = pass + record.interval;
+    } else {
+      record.interval = 1;
+    }
     if (iPrint)
       std::cout << (*it).second << " time: " << time_end - time_start
                 << std::endl;
@@ -290,6 +343,20 @@ int Presolve::runPresolvers(const std::vector<Presolver>& order) {
   return status;
 }
 
+void Presolve::reportPresolverRecords() {
+  HighsPrintMessage(output, message_level, ML_DETAILED,
+                    "%-20s %6s %6s %10s %12s %10s\n", "Presolver", "Calls",
+                    "Skips", "Time", "Work", "Reductions");
+  for (const auto& entry : presolverRecords) {
+    const PresolverRecord& record = entry.second;
+    HighsPrintMessage(output, message_level, ML_DETAILED,
+                      "%-20s %6d %6d %10.3g %12.6g %10d\n",
+                      kPresolverNames.at(entry.first).c_str(), record.calls,
+                      record.skips, record.time, record.work,
+                      record.reductions);
+  }
+}
+
 void Presolve::removeFixed() {
   timer.recordStart(FIXED_COL);
   for (int j = 0; j < numCol; ++j)
@@ -335,19 +402,25 @@ int Presolve::presolve(int print) {
     // pre_release_order:
     order.push_back(Presolver::kMainRowSingletons);
     order.push_back(Presolver::kMainForcing);
+    order.push_back(Presolver::kMainImpliedBounds);
     order.push_back(Presolver::kMainRowSingletons);
     order.push_back(Presolver::kMainDoubletonEq);
     order.push_back(Presolver::kMainRowSingletons);
     order.push_back(Presolver::kMainColSingletons);
     order.push_back(Presolver::kMainDominatedCols);
+    order.push_back(Presolver::kMainDuplicateRows);
+    order.push_back(Presolver::kMainDuplicateCols);
   }
   // Else: The order has been modified for experiments
 
+  workLimit = work_limit * (Avalue.size() + numRow + numCol);
   while (hasChange == 1) {
     if (max_iterations > 0 && iter > max_iterations) break;
     hasChange = false;
+    presolverSkipped = false;
 
     reportDevMainLoop();
+    stats.pass_work.push_back(0);
     timer.recordStart(RUN_PRESOLVERS);
     int run_status = runPresolvers(order);
     timer.recordFinish(RUN_PRESOLVERS);
@@ -355,6 +428,16 @@ int Presolve::presolve(int print) {
     if (run_status != status) {
     }
     if (status) return status;
+    if (workLimitReached) {
+      HighsPrintMessage(output, message_level, ML_VERBOSE,
+                        "Presolve stopped at its work limit of %g\n",
+                        workLimit);
+      break;
+    }
+    // The main loop only ends after a pass in which every presolver
+    // has run and found nothing
+    throttlePresolvers = hasChange || !presolverSkipped;
+    if (!hasChange && presolverSkipped) hasChange = true;
 
     // todo: next
     // Exit check: less than 10 % of what we had before.
@@ -364,6 +447,12 @@ int Presolve::presolve(int print) {
 
   reportDevMainLoop();
 
+  for (int pass = 0; pass < (int)stats.pass_work.size(); pass++)
+    HighsPrintMessage(output, message_level, ML_DETAILED,
+                      "Presolve pass %d: work %d\n", pass + 1,
+                      stats.pass_work[pass]);
+  reportPresolverRecords();
+
   timer.recordStart(RESIZE_MATRIX);
   checkForChanges(iter);
   timer.recordFinish(RESIZE_MATRIX);
@@ -449,7 +538,7 @@ pair<int, int> Presolve::getXYDoubletonEquations(const int row) {
 
   int col1 = -1;
   int col2 = -1;
-  int kk = ARstart.at(row);
+  int kk = liveRowEntry(row, ARstart.at(row));
   while (kk < ARstart.at(row + 1)) {
     if (flagCol.at(ARindex.at(kk))) {
       if (col1 == -1)
@@ -462,9 +551,8 @@ pair<int, int> Presolve::getXYDoubletonEquations(const int row) {
         col2 = -2;
         break;
       }
-      ++kk;
-    } else
-      ++kk;
+    }
+    kk = liveRowEntry(row, kk + 1);
   }
   if (col2 == -1)
     cout << "ERROR: doubleton eq row" << row
@@ -501,9 +589,9 @@ void Presolve::processRowDoubletonEquation(const int row, const int x,
   // presolve::printCol(2, numRow, numCol, flagRow, flagCol, colLower,
   //                    colUpper, valueRowDual, Astart, Aend, Aindex, Avalue);
 
-  postValue.push(akx);
-  postValue.push(aky);
-  postValue.push(b);
+  postsolveLog.postValue.push(akx);
+  postsolveLog.postValue.push(aky);
+  postsolveLog.postValue.push(b);
 
   // modify bounds on variable x (j), variable y (col,k) is substituted out
   // double aik = Avalue.at(k);
@@ -526,19 +614,23 @@ void Presolve::processRowDoubletonEquation(const int row, const int x,
 
   vector<double> bnds({colLower.at(y), colUpper.at(y), colCost.at(y)});
   vector<double> bnds2({colLower.at(x), colUpper.at(x), colCost.at(x)});
-  oldBounds.push(make_pair(y, bnds));
-  oldBounds.push(make_pair(x, bnds2));
+  postsolveLog.oldBounds.push(y, bnds);
+  recordCostInLog(y, postsolveLog.oldBounds.topValuePosition(2));
+  postsolveLog.oldBounds.push(x, bnds2);
+  recordCostInLog(x, postsolveLog.oldBounds.topValuePosition(2));
 
   if (low > colLower.at(x)) colLower.at(x) = low;
   if (upp < colUpper.at(x)) colUpper.at(x) = upp;
 
   // modify cost of xj
   colCost.at(x) = colCost.at(x) - colCost.at(y) * akx / aky;
+  recordCostTransfer(x, y, akx, aky);
 
   // for postsolve: need the new bounds too
   assert(x >= 0 && x < numCol);
   vector<double> bnds3({colLower.at(x), colUpper.at(x), colCost.at(x)});
-  oldBounds.push(make_pair(x, bnds3));
+  postsolveLog.oldBounds.push(x, bnds3);
+  recordCostInLog(x, postsolveLog.oldBounds.topValuePosition(2));
 
   addChange(DOUBLETON_EQUATION, row, y);
 
@@ -547,6 +639,10 @@ void Presolve::processRowDoubletonEquation(const int row, const int x,
     cout << "PR: Doubleton equation removed. Row " << row << ", column " << y
          << ", column left is " << x << "    nzy=" << nzCol.at(y) << endl;
 
+  // The rows of y gain x, and x has new bounds and cost
+  markRowChanged(row);
+  markColChanged(x);
+  markColChanged(y);
   flagRow.at(row) = 0;
   nzCol.at(x)--;
 
@@ -573,8 +669,10 @@ void Presolve::removeDoubletonEquations() {
 
   int iter = 0;
 
-  for (int row = 0; row < numRow; row++) {
+  changedRows.take(doubletonRowPosition, queueEntries);
+  for (const int row : queueEntries) {
     if (flagRow.at(row)) {
+      countWork(1 + nzRow[row]);
       // Analyse dependency on numerical tolerance
       if (nzRow.at(row) == 2 && rowLower[row] > -HIGHS_CONST_INF &&
           rowUpper[row] < HIGHS_CONST_INF) {
@@ -610,7 +708,8 @@ void Presolve::removeDoubletonEquations() {
         // printRow(row, numRow, numCol, flagRow, flagCol, rowLower, rowUpper,
         //          valuePrimal, ARstart, ARindex, ARvalue);
 
-        for (int k = Astart.at(y); k < Aend.at(y); ++k)
+        for (int k = liveColEntry(y, Astart.at(y)); k < Aend.at(y);
+             k = liveColEntry(y, k + 1))
           if (flagRow.at(Aindex.at(k)) && Aindex.at(k) != row) {
             const int i = Aindex.at(k);
             const double aiy = Avalue.at(k);
@@ -644,6 +743,7 @@ void Presolve::removeDoubletonEquations() {
                                                          aky);
               // std::cout << "   . row " << i << " zero " << std::endl;
             }
+            markRowChanged(i);
           }
         if (Avalue.size() > 40000000) {
           trimA();
@@ -674,12 +774,13 @@ void Presolve::UpdateMatrixCoeffDoubletonEquationXzero(const int i, const int x,
 
   assert(ARvalue.at(ind) == aiy);
 
-  postValue.push(aiy);
-  postValue.push(y);
+  postsolveLog.postValue.push(aiy);
+  postsolveLog.postValue.push(y);
   addChange(DOUBLETON_EQUATION_X_ZERO_INITIALLY, i, x);
 
   ARindex.at(ind) = x;
   ARvalue.at(ind) = -aiy * akx / aky;
+  rowEntries.reset(ARstart.at(i), ARstart.at(i + 1));
 
   // update A: append X column to end of array
   const int st = Avalue.size();
@@ -691,6 +792,7 @@ void Presolve::UpdateMatrixCoeffDoubletonEquationXzero(const int i, const int x,
   Aindex.push_back(i);
   Astart.at(x) = st;
   Aend.at(x) = Avalue.size();
+  colEntries.extend((int)Aindex.size());
 
   nzCol.at(x)++;
   // nzRow does not change here.
@@ -722,7 +824,7 @@ void Presolve::UpdateMatrixCoeffDoubletonEquationXnonZero(
     // case new x != 0
     // cout<<"case: x still there row "<<i<<" "<<endl;
 
-    postValue.push(ARvalue.at(ind));
+    postsolveLog.postValue.push(ARvalue.at(ind));
     addChange(DOUBLETON_EQUATION_NEW_X_NONZERO, i, x);
     ARvalue.at(ind) = xNew;
 
@@ -751,7 +853,7 @@ void Presolve::UpdateMatrixCoeffDoubletonEquationXnonZero(
       // set ARindex of element for x to numCol
       // flagCol[numCol] = false
       // mind when resizing: should be OK
-      postValue.push(ARvalue.at(ind));
+      postsolveLog.postValue.push(ARvalue.at(ind));
 
       ARindex.at(ind) = numCol;
 
@@ -765,7 +867,7 @@ void Presolve::UpdateMatrixCoeffDoubletonEquationXnonZero(
       for (indi = Astart.at(x); indi < Aend.at(x); ++indi)
         if (Aindex.at(indi) == i) break;
 
-      postValue.push(Avalue.at(indi));
+      postsolveLog.postValue.push(Avalue.at(indi));
 
       // if indi is not Aend-1 swap elements indi and Aend-1
       if (indi != Aend.at(x) - 1) {
@@ -828,6 +930,7 @@ void Presolve::trimA() {
   }
   Avalue.resize(iPut);
   Aindex.resize(iPut);
+  colEntries.setup(iPut);
 }
 
 void Presolve::resizeProblem() {
@@ -964,6 +1067,23 @@ void Presolve::initializeVectors() {
 
   flagCol.assign(numCol, 1);
   flagRow.assign(numRow, 1);
+  changedRows.setup(numRow);
+  changedCols.setup(numCol);
+  forcingRowPosition = 0;
+  doubletonRowPosition = 0;
+  dominatedColPosition = 0;
+  duplicateRowPosition = 0;
+  duplicateColPosition = 0;
+  impliedBoundPosition = 0;
+  rowActivity.resize(numRow);
+  rowActivityValid.assign(numRow, 0);
+  rowHash.assign(numRow, 0);
+  colHash.assign(numCol, 0);
+  rowBuckets.clear();
+  colBuckets.clear();
+  rowInBucket.assign(numRow, 0);
+  colInBucket.assign(numCol, 0);
+  duplicateWork.assign(max(numRow, numCol) + 1, 0);
 
   if (iKKTcheck) setKKTcheckerData();
 
@@ -982,6 +1102,8 @@ void Presolve::initializeVectors() {
   }
 
   Aend.resize(numCol + 1);
+  rowEntries.setup((int)ARindex.size());
+  colEntries.setup((int)Aindex.size());
   for (int i = 0; i < numCol; ++i) {
     Aend.at(i) = Astart.at(i + 1);
     nzCol.at(i) = Aend.at(i) - Astart.at(i);
@@ -1028,7 +1150,8 @@ void Presolve::removeFixedCol(int j) {
 
   countRemovedCols(FIXED_COL);
 
-  for (int k = Astart.at(j); k < Aend.at(j); ++k) {
+  for (int k = liveColEntry(j, Astart.at(j)); k < Aend.at(j);
+       k = liveColEntry(j, k + 1)) {
     if (flagRow.at(Aindex.at(k))) {
       int i = Aindex.at(k);
 
@@ -1069,6 +1192,7 @@ void Presolve::removeEmptyColumn(int j) {
     return;
   }
 
+  recordCostSign(j);
   if (colCost.at(j) > 0)
     value = colLower.at(j);
   else if (colCost.at(j) < 0)
@@ -1082,6 +1206,7 @@ void Presolve::removeEmptyColumn(int j) {
 
   setPrimalValue(j, value);
   valueColDual.at(j) = colCost.at(j);
+  recordColDual(j);
 
   addChange(EMPTY_COL, 0, j);
 
@@ -1155,7 +1280,8 @@ pair<double, double> Presolve::getImpliedColumnBounds(int j) {
   double d = 0;
 
   int i;
-  for (int k = Astart.at(j); k < Aend.at(j); ++k) {
+  for (int k = liveColEntry(j, Astart.at(j)); k < Aend.at(j);
+       k = liveColEntry(j, k + 1)) {
     i = Aindex.at(k);
     if (flagRow.at(i)) {
       if (Avalue.at(k) < 0) {
@@ -1176,7 +1302,8 @@ pair<double, double> Presolve::getImpliedColumnBounds(int j) {
     }
   }
 
-  for (int k = Astart.at(j); k < Aend.at(j); ++k) {
+  for (int k = liveColEntry(j, Astart.at(j)); k < Aend.at(j);
+       k = liveColEntry(j, k + 1)) {
     i = Aindex.at(k);
     if (flagRow.at(i)) {
       if (Avalue.at(k) < 0) {
@@ -1215,9 +1342,18 @@ void Presolve::removeDominatedColumns() {
     status = stat::Timeout;
     return;
   }
-  for (int j = 0; j < numCol; ++j)
+  changedCols.take(dominatedColPosition, queueEntries);
+  detectImpliedColumnBounds();
+  for (int ix = 0; ix < (int)queueEntries.size(); ix++) {
+    const int j = queueEntries[ix];
     if (flagCol.at(j)) {
-      p = getImpliedColumnBounds(j);
+      countWork(1 + nzCol[j]);
+      // The bounds are out of date if a reduction applied since they
+      // were computed changed the column
+      if (changedCols.touchedSince(j, queueBoundsTouches))
+        p = getImpliedColumnBounds(j);
+      else
+        p = queueBounds[ix];
       d = p.first;
       e = p.second;
 
@@ -1267,6 +1403,19 @@ void Presolve::removeDominatedColumns() {
       }
       if (status) return;
     }
+  }
+}
+
+void Presolve::detectImpliedColumnBounds() {
+  const int num_entries = (int)queueEntries.size();
+  queueBounds.resize(num_entries);
+#pragma omp parallel for schedule(dynamic, 256) \
+    if (num_entries >= presolve_parallel_min_entries)
+  for (int ix = 0; ix < num_entries; ix++) {
+    const int j = queueEntries[ix];
+    if (flagCol[j]) queueBounds[ix] = getImpliedColumnBounds(j);
+  }
+  queueBoundsTouches = changedCols.numTouches();
 }
 
 void Presolve::removeIfWeaklyDominated(const int j, const double d,
@@ -1311,7 +1460,8 @@ void Presolve::removeIfWeaklyDominated(const int j, const double d,
       // calculate new bounds
       if (colLower.at(j) > -HIGHS_CONST_INF ||
           colUpper.at(j) >= HIGHS_CONST_INF)
-        for (int kk = Astart.at(j); kk < Aend.at(j); ++kk)
+        for (int kk = liveColEntry(j, Astart.at(j)); kk < Aend.at(j);
+             kk = liveColEntry(j, kk + 1))
           if (flagRow.at(Aindex.at(kk)) && d < HIGHS_CONST_INF) {
             i = Aindex.at(kk);
             if (Avalue.at(kk) > 0 &&
@@ -1319,42 +1469,346 @@ void Presolve::removeIfWeaklyDominated(const int j, const double d,
               bnd =
                   -(colCost.at(j) + d) / Avalue.at(kk) + implRowDualLower.at(i);
               if (bnd < implRowDualUpper.at(i) &&
-                  !(bnd < implRowDualLower.at(i)))
+                  !(bnd < implRowDualLower.at(i))) {
                 implRowDualUpper.at(i) = bnd;
+                markRowChanged(i);
+              }
             } else if (Avalue.at(kk) < 0 &&
                        implRowDualUpper.at(i) < HIGHS_CONST_INF) {
               bnd =
                   -(colCost.at(j) + d) / Avalue.at(kk) + implRowDualUpper.at(i);
               if (bnd > implRowDualLower.at(i) &&
-                  !(bnd > implRowDualUpper.at(i)))
+                  !(bnd > implRowDualUpper.at(i))) {
                 implRowDualLower.at(i) = bnd;
+                markRowChanged(i);
+              }
             }
           }
 
       if (colLower.at(j) <= -HIGHS_CONST_INF ||
           colUpper.at(j) < HIGHS_CONST_INF)
-        for (int kk = Astart.at(j); kk < Aend.at(j); ++kk)
+        for (int kk = liveColEntry(j, Astart.at(j)); kk < Aend.at(j);
+             kk = liveColEntry(j, kk + 1))
           if (flagRow.at(Aindex.at(kk)) && e > -HIGHS_CONST_INF) {
             i = Aindex.at(kk);
             if (Avalue.at(kk) > 0 && implRowDualUpper.at(i) < HIGHS_CONST_INF) {
               bnd =
                   -(colCost.at(j) + e) / Avalue.at(kk) + implRowDualUpper.at(i);
               if (bnd > implRowDualLower.at(i) &&
-                  !(bnd > implRowDualUpper.at(i)))
+                  !(bnd > implRowDualUpper.at(i))) {
                 implRowDualLower.at(i) = bnd;
+                markRowChanged(i);
+              }
             } else if (Avalue.at(kk) < 0 &&
                        implRowDualLower.at(i) > -HIGHS_CONST_INF) {
               bnd =
                   -(colCost.at(j) + e) / Avalue.at(kk) + implRowDualLower.at(i);
               if (bnd < implRowDualUpper.at(i) &&
-                  !(bnd < implRowDualLower.at(i)))
+                  !(bnd < implRowDualLower.at(i))) {
                 implRowDualUpper.at(i) = bnd;
+                markRowChanged(i);
+              }
             }
           }
     }
   }
 }
 
+// Hash of an entry of a row or column, with its value scaled by that
+// of the first entry rounded to about six significant figures, so
+// that parallel rows or columns have the same hash unless a scaled
+// value lies on a rounding boundary. Entries are combined by summing
+// their hashes, which does not depend on the order of the entries.
+static uint64_t getEntryHash(const int index, const double scaled_value) {
+  int exponent;
+  const double mantissa = std::frexp(scaled_value, &exponent);
+  const int64_t rounded = std::llround(mantissa * (1 << 20));
+  uint64_t hash = (uint64_t)index * 0x9E3779B97F4A7C15ull;
+  hash ^= ((uint64_t)rounded + ((uint64_t)exponent << 32)) *
+          0xC2B2AE3D27D4EB4Full;
+  hash ^= hash >> 29;
+  return hash * 0x165667B19E3779F9ull;
+}
+
+uint64_t Presolve::getRowHash(const int row) {
+  // Scale by the value of the entry with the least column index
+  int first = -1;
+  for (int k = liveRowEntry(row, ARstart.at(row)); k < ARstart.at(row + 1);
+       k = liveRowEntry(row, k + 1))
+    if (flagCol.at(ARindex.at(k)) &&
+        (first < 0 || ARindex.at(k) < ARindex.at(first)))
+      first = k;
+  uint64_t hash = 0;
+  if (first < 0) return hash;
+  for (int k = liveRowEntry(row, ARstart.at(row)); k < ARstart.at(row + 1);
+       k = liveRowEntry(row, k + 1))
+    if (flagCol.at(ARindex.at(k)))
+      hash += getEntryHash(ARindex.at(k), ARvalue.at(k) / ARvalue.at(first));
+  return hash;
+}
+
+uint64_t Presolve::getColumnHash(const int col) {
+  // Scale by the value of the entry with the least row index. The
+  // cost is hashed as an entry in an extra row
+  int first = -1;
+  for (int k = liveColEntry(col, Astart.at(col)); k < Aend.at(col);
+       k = liveColEntry(col, k + 1))
+    if (flagRow.at(Aindex.at(k)) &&
+        (first < 0 || Aindex.at(k) < Aindex.at(first)))
+      first = k;
+  uint64_t hash = 0;
+  if (first < 0) return hash;
+  for (int k = liveColEntry(col, Astart.at(col)); k < Aend.at(col);
+       k = liveColEntry(col, k + 1))
+    if (flagRow.at(Aindex.at(k)))
+      hash += getEntryHash(Aindex.at(k), Avalue.at(k) / Avalue.at(first));
+  hash += getEntryHash(numRow, colCost.at(col) / Avalue.at(first));
+  return hash;
+}
+
+// Returns true if row k is v times row i
+bool Presolve::checkDuplicateRows(const int i, const int k, double& v) {
+  if (nzRow.at(i) != nzRow.at(k)) return false;
+  for (int kk = liveRowEntry(i, ARstart.at(i)); kk < ARstart.at(i + 1);
+       kk = liveRowEntry(i, kk + 1))
+    if (flagCol.at(ARindex.at(kk)))
+      duplicateWork[ARindex.at(kk)] = ARvalue.at(kk);
+
+  bool parallel = true;
+  v = 0;
+  for (int kk = liveRowEntry(k, ARstart.at(k)); kk < ARstart.at(k + 1);
+       kk = liveRowEntry(k, kk + 1)) {
+    const int j = ARindex.at(kk);
+    if (!flagCol.at(j)) continue;
+    const double aij = duplicateWork[j];
+    const double akj = ARvalue.at(kk);
+    if (aij == 0) {
+      parallel = false;
+      break;
+    }
+    if (v == 0) {
+      v = akj / aij;
+    } else if (fabs(akj - v * aij) >
+               duplicate_tolerance * max(1.0, fabs(akj))) {
+      parallel = false;
+      break;
+    }
+  }
+
+  for (int kk = liveRowEntry(i, ARstart.at(i)); kk < ARstart.at(i + 1);
+       kk = liveRowEntry(i, kk + 1))
+    duplicateWork[ARindex.at(kk)] = 0;
+  return parallel && v != 0;
+}
+
+// Returns true if column k and its cost are v times column j
+bool Presolve::checkDuplicateColumns(const int j, const int k, double& v) {
+  if (nzCol.at(j) != nzCol.at(k)) return false;
+  for (int kk = liveColEntry(j, Astart.at(j)); kk < Aend.at(j);
+       kk = liveColEntry(j, kk + 1))
+    if (flagRow.at(Aindex.at(kk)))
+      duplicateWork[Aindex.at(kk)] = Avalue.at(kk);
+
+  bool parallel = true;
+  v = 0;
+  for (int kk = liveColEntry(k, Astart.at(k)); kk < Aend.at(k);
+       kk = liveColEntry(k, kk + 1)) {
+    const int i = Aindex.at(kk);
+    if (!flagRow.at(i)) continue;
+    const double aij = duplicateWork[i];
+    const double aik = Avalue.at(kk);
+    if (aij == 0) {
+      parallel = false;
+      break;
+    }
+    if (v == 0) {
+      v = aik / aij;
+    } else if (fabs(aik - v * aij) >
+               duplicate_tolerance * max(1.0, fabs(aik))) {
+      parallel = false;
+      break;
+    }
+  }
+  if (parallel && v != 0)
+    parallel = fabs(colCost.at(k) - v * colCost.at(j)) <=
+               duplicate_tolerance * max(1.0, fabs(colCost.at(k)));
+
+  for (int kk = liveColEntry(j, Astart.at(j)); kk < Aend.at(j);
+       kk = liveColEntry(j, kk + 1))
+    duplicateWork[Aindex.at(kk)] = 0;
+  return parallel && v != 0;
+}
+
+// Remove an entry from the bucket of its previous hash
+static void removeFromBucket(
+    std::unordered_map<uint64_t, vector<int>>& buckets, const uint64_t hash,
+    const int index) {
+  auto bucket = buckets.find(hash);
+  assert(bucket != buckets.end());
+  vector<int>& entries = bucket->second;
+  for (int& entry : entries)
+    if (entry == index) {
+      entry = entries.back();
+      entries.pop_back();
+      break;
+    }
+  if (entries.empty()) buckets.erase(bucket);
+}
+
+void Presolve::findDuplicateRows() {
+  if (timer.reachLimit()) {
+    status = stat::Timeout;
+    return;
+  }
+  changedRows.take(duplicateRowPosition, queueEntries);
+  if (queueEntries.empty()) return;
+  timer.recordStart(DUPLICATE_ROWS);
+
+  // Move the changed rows to the buckets of their new hashes, so only
+  // the rows in the bucket of a changed row are compared with it.
+  // Removed rows are also in the queue, so leave their buckets
+  for (const int i : queueEntries) {
+    if (rowInBucket[i]) removeFromBucket(rowBuckets, rowHash[i], i);
+    rowInBucket[i] = flagRow.at(i) && nzRow.at(i) > 1;
+    if (!rowInBucket[i]) continue;
+    countWork(1 + nzRow[i]);
+    rowHash[i] = getRowHash(i);
+    rowBuckets[rowHash[i]].push_back(i);
+  }
+
+  double v;
+  for (const int i : queueEntries) {
+    if (!rowInBucket[i] || !flagRow.at(i)) continue;
+    for (const int k : rowBuckets[rowHash[i]]) {
+      if (k == i || !flagRow.at(k) || !checkDuplicateRows(k, i, v)) continue;
+      removeDuplicateRow(k, i, v);
+      if (status) {
+        timer.recordFinish(DUPLICATE_ROWS);
+        return;
+      }
+      break;
+    }
+  }
+  timer.recordFinish(DUPLICATE_ROWS);
+}
+
+void Presolve::findDuplicateColumns() {
+  if (timer.reachLimit()) {
+    status = stat::Timeout;
+    return;
+  }
+  changedCols.take(duplicateColPosition, queueEntries);
+  if (queueEntries.empty()) return;
+  timer.recordStart(DUPLICATE_COLS);
+
+  for (const int j : queueEntries) {
+    if (colInBucket[j]) removeFromBucket(colBuckets, colHash[j], j);
+    colInBucket[j] = flagCol.at(j) && nzCol.at(j) > 0;
+    if (!colInBucket[j]) continue;
+    countWork(1 + nzCol[j]);
+    colHash[j] = getColumnHash(j);
+    colBuckets[colHash[j]].push_back(j);
+  }
+
+  double v;
+  for (const int j : queueEntries) {
+    if (!colInBucket[j] || !flagCol.at(j)) continue;
+    for (const int k : colBuckets[colHash[j]]) {
+      if (k == j || !flagCol.at(k) || !checkDuplicateColumns(k, j, v))
+        continue;
+      removeDuplicateColumn(k, j, v);
+      break;
+    }
+  }
+  timer.recordFinish(DUPLICATE_COLS);
+}
+
+// Row k is v times row i, so its bounds are transferred to row i and
+// it is removed
+void Presolve::removeDuplicateRow(const int i, const int k, const double v) {
+  const double lower = v > 0 ? rowLower.at(k) / v : rowUpper.at(k) / v;
+  const double upper = v > 0 ? rowUpper.at(k) / v : rowLower.at(k) / v;
+  double new_lower = max(rowLower.at(i), lower);
+  double new_upper = min(rowUpper.at(i), upper);
+
+  // Analyse dependency on numerical tolerance
+  timer.updateNumericsRecord(INCONSISTENT_BOUNDS, new_lower - new_upper);
+  if (new_lower - new_upper > inconsistent_bounds_tolerance) {
+    if (iPrint > 0) cout << "PR: Problem infeasible." << endl;
+    status = Infeasible;
+    return;
+  }
+  if (new_lower > new_upper) new_lower = new_upper;
+
+  if (iPrint > 0)
+    cout << "PR: Duplicate row " << k << " removed. Row " << i
+         << " kept, ratio = " << v << endl;
+
+  postsolveLog.oldBounds.push(
+      i, {rowLower.at(i), rowUpper.at(i), lower, upper, v});
+  markRowChanged(i);
+  rowLower.at(i) = new_lower;
+  rowUpper.at(i) = new_upper;
+
+  // Bounds on the dual of row i no longer hold once it carries that
+  // of row k, and implied column bounds from row k now come from row i
+  implRowDualLower.at(i) = -HIGHS_CONST_INF;
+  implRowDualUpper.at(i) = HIGHS_CONST_INF;
+  if (rowLower.at(i) <= -HIGHS_CONST_INF) implRowDualUpper.at(i) = 0;
+  if (rowUpper.at(i) >= HIGHS_CONST_INF) implRowDualLower.at(i) = 0;
+  for (int kk = liveRowEntry(k, ARstart.at(k)); kk < ARstart.at(k + 1);
+       kk = liveRowEntry(k, kk + 1)) {
+    const int j = ARindex.at(kk);
+    if (!flagCol.at(j)) continue;
+    if (implColLowerRowIndex.at(j) == k) implColLowerRowIndex.at(j) = i;
+    if (implColUpperRowIndex.at(j) == k) implColUpperRowIndex.at(j) = i;
+  }
+
+  addChange(DUPLICATE_ROWS, k, 0);
+  removeRow(k);
+  countRemovedRows(DUPLICATE_ROWS);
+}
+
+// Column k and its cost are v times column j, so x_j + v x_k replaces
+// x_j and column k is removed
+void Presolve::removeDuplicateColumn(const int j, const int k, const double v) {
+  const double new_lower = v > 0 ? colLower.at(j) + v * colLower.at(k)
+                                 : colLower.at(j) + v * colUpper.at(k);
+  const double new_upper = v > 0 ? colUpper.at(j) + v * colUpper.at(k)
+                                 : colUpper.at(j) + v * colLower.at(k);
+
+  if (iPrint > 0)
+    cout << "PR: Duplicate column " << k << " removed. Column " << j
+         << " kept, ratio = " << v << endl;
+
+  postsolveLog.oldBounds.push(j, {colLower.at(j), colUpper.at(j),
+                                  colLower.at(k), colUpper.at(k), v});
+  markColChanged(j);
+  colLower.at(j) = new_lower;
+  colUpper.at(j) = new_upper;
+  // Implied bounds on x_j do not hold for x_j + v x_k
+  implColLower.at(j) = new_lower;
+  implColUpper.at(j) = new_upper;
+  implColLowerRowIndex.at(j) = -1;
+  implColUpperRowIndex.at(j) = -1;
+
+  markColChanged(k);
+  flagCol.at(k) = 0;
+  hasChange = true;
+  valuePrimal.at(k) = 0;
+  for (int kk = liveColEntry(k, Astart.at(k)); kk < Aend.at(k);
+       kk = liveColEntry(k, kk + 1)) {
+    const int row = Aindex.at(kk);
+    if (flagRow.at(row)) {
+      nzRow.at(row)--;
+      if (nzRow.at(row) == 1) singRow.push_back(row);
+    }
+  }
+
+  addChange(DUPLICATE_COLS, 0, k);
+  countRemovedCols(DUPLICATE_COLS);
+}
+
 void Presolve::setProblemStatus(const int s) {
   if (s == Infeasible)
     cout << "NOT-OPT status = 1, returned from solver after presolve: Problem "
@@ -1427,22 +1881,26 @@ void Presolve::removeFreeColumnSingleton(const int col, const int row,
   // modify costs
   vector<pair<int, double>> newCosts;
   int j;
-  for (int kk = ARstart.at(row); kk < ARstart.at(row + 1); ++kk) {
+  for (int kk = liveRowEntry(row, ARstart.at(row)); kk < ARstart.at(row + 1);
+       kk = liveRowEntry(row, kk + 1)) {
     j = ARindex.at(kk);
     if (flagCol.at(j) && j != col) {
       newCosts.push_back(make_pair(j, colCost.at(j)));
       colCost.at(j) =
           colCost.at(j) - colCost.at(col) * ARvalue.at(kk) / Avalue.at(k);
+      recordCostTransfer(j, col, ARvalue.at(kk), Avalue.at(k));
     }
   }
   if (iKKTcheck == 1) chk2.costs.push(newCosts);
 
   flagCol.at(col) = 0;
-  postValue.push(colCost.at(col));
+  postsolveLog.postValue.push(colCost.at(col));
+  recordCostInLog(col, postsolveLog.postValue.topPosition());
   fillStackRowBounds(row);
 
   valueColDual.at(col) = 0;
   valueRowDual.at(row) = -colCost.at(col) / Avalue.at(k);
+  recordRowDual(row, col, Avalue.at(k));
 
   addChange(FREE_SING_COL, row, col);
   removeRow(row);
@@ -1459,13 +1917,13 @@ bool Presolve::removeColumnSingletonInDoubletonInequality(const int col,
   int j = -1;
 
   // count
-  int kk = ARstart.at(i);
+  int kk = liveRowEntry(i, ARstart.at(i));
   while (kk < ARstart.at(i + 1)) {
     j = ARindex.at(kk);
     if (flagCol.at(j) && j != col)
       break;
     else
-      ++kk;
+      kk = liveRowEntry(i, kk + 1);
   }
   if (kk == ARstart.at(i + 1))
     cout << "ERROR: nzRow[" << i << "]=2, but no second variable in row. \n";
@@ -1491,8 +1949,8 @@ bool Presolve::removeColumnSingletonInDoubletonInequality(const int col,
     return false;
   }
 
-  postValue.push(ARvalue.at(kk));
-  postValue.push(Avalue.at(k));
+  postsolveLog.postValue.push(ARvalue.at(kk));
+  postsolveLog.postValue.push(Avalue.at(k));
 
   // modify bounds on variable j, variable col (k) is substituted out
   // double aik = Avalue.at(k);
@@ -1514,23 +1972,28 @@ bool Presolve::removeColumnSingletonInDoubletonInequality(const int col,
 
   vector<double> bndsCol({colLower.at(col), colUpper.at(col), colCost.at(col)});
   vector<double> bndsJ({colLower.at(j), colUpper.at(j), colCost.at(j)});
-  oldBounds.push(make_pair(col, bndsCol));
-  oldBounds.push(make_pair(j, bndsJ));
+  postsolveLog.oldBounds.push(col, bndsCol);
+  recordCostInLog(col, postsolveLog.oldBounds.topValuePosition(2));
+  postsolveLog.oldBounds.push(j, bndsJ);
+  recordCostInLog(j, postsolveLog.oldBounds.topValuePosition(2));
 
   // modify bounds of xj
   if (low > colLower.at(j)) colLower.at(j) = low;
   if (upp < colUpper.at(j)) colUpper.at(j) = upp;
+  markColChanged(j);
 
   // modify cost of xj
   colCost.at(j) =
       colCost.at(j) - colCost.at(col) * ARvalue.at(kk) / Avalue.at(k);
+  recordCostTransfer(j, col, ARvalue.at(kk), Avalue.at(k));
 
   // for postsolve: need the new bounds too
   // oldBounds.push_back(colLower.at(j)); oldBounds.push_back(colUpper.at(j));
   bndsJ.at(0) = (colLower.at(j));
   bndsJ.at(1) = (colUpper.at(j));
   bndsJ.at(2) = (colCost.at(j));
-  oldBounds.push(make_pair(j, bndsJ));
+  postsolveLog.oldBounds.push(j, bndsJ);
+  recordCostInLog(j, postsolveLog.oldBounds.topValuePosition(2));
 
   // remove col as free column singleton
   if (iPrint > 0)
@@ -1547,6 +2010,7 @@ bool Presolve::removeColumnSingletonInDoubletonInequality(const int col,
   valueRowDual.at(i) =
       -colCost.at(col) /
       Avalue.at(k);  // may be changed later, depending on bounds.
+  recordRowDual(i, col, Avalue.at(k));
   addChange(SING_COL_DOUBLETON_INEQ, i, col);
 
   // if not special case two column singletons
@@ -1563,7 +2027,9 @@ void Presolve::removeSecondColumnSingletonInDoubletonRow(const int j,
   // case two singleton columns
   // when we get here bounds on xj are updated so we can choose low/upper one
   // depending on the cost of xj
+  markRowChanged(i);
   flagRow.at(i) = 0;
+  recordCostSign(j);
   double value;
   if (colCost.at(j) > 0) {
     if (colLower.at(j) <= -HIGHS_CONST_INF) {
@@ -1614,6 +2080,7 @@ void Presolve::removeColumnSingletons() {
       }
       assert(k < (int)Aindex.size());
       const int i = Aindex.at(k);
+      countWork(1 + nzCol[col] + nzRow[i]);
 
       // free
       if (colLower.at(col) <= -HIGHS_CONST_INF &&
@@ -1661,7 +2128,8 @@ pair<double, double> Presolve::getBoundsImpliedFree(double lowInit,
   // if at any stage low becomes  or upp becomes inf break loop
   // can't use bounds for variables generated by the same row.
   // low
-  for (int kk = ARstart.at(i); kk < ARstart.at(i + 1); ++kk) {
+  for (int kk = liveRowEntry(i, ARstart.at(i)); kk < ARstart.at(i + 1);
+       kk = liveRowEntry(i, kk + 1)) {
     j = ARindex.at(kk);
     if (flagCol.at(j) && j != col) {
       // check if new bounds are precisely implied bounds from same row
@@ -1689,7 +2157,8 @@ pair<double, double> Presolve::getBoundsImpliedFree(double lowInit,
     }
   }
   // upp
-  for (int kk = ARstart.at(i); kk < ARstart.at(i + 1); ++kk) {
+  for (int kk = liveRowEntry(i, ARstart.at(i)); kk < ARstart.at(i + 1);
+       kk = liveRowEntry(i, kk + 1)) {
     j = ARindex.at(kk);
     if (flagCol.at(j) && j != col) {
       // check if new bounds are precisely implied bounds from same row
@@ -1732,22 +2201,26 @@ void Presolve::removeImpliedFreeColumn(const int col, const int i,
   // modify costs
   int j;
   vector<pair<int, double>> newCosts;
-  for (int kk = ARstart.at(i); kk < ARstart.at(i + 1); ++kk) {
+  for (int kk = liveRowEntry(i, ARstart.at(i)); kk < ARstart.at(i + 1);
+       kk = liveRowEntry(i, kk + 1)) {
     j = ARindex.at(kk);
     if (flagCol.at(j) && j != col) {
       newCosts.push_back(make_pair(j, colCost.at(j)));
       colCost.at(j) =
           colCost.at(j) - colCost.at(col) * ARvalue.at(kk) / Avalue.at(k);
+      recordCostTransfer(j, col, ARvalue.at(kk), Avalue.at(k));
     }
   }
   if (iKKTcheck == 1) chk2.costs.push(newCosts);
 
   flagCol.at(col) = 0;
-  postValue.push(colCost.at(col));
+  postsolveLog.postValue.push(colCost.at(col));
+  recordCostInLog(col, postsolveLog.postValue.topPosition());
   fillStackRowBounds(i);
 
   valueColDual.at(col) = 0;
   valueRowDual.at(i) = -colCost.at(col) / Avalue.at(k);
+  recordRowDual(i, col, Avalue.at(k));
   addChange(IMPLIED_FREE_SING_COL, i, col);
   removeRow(i);
 }
@@ -1772,6 +2245,9 @@ bool Presolve::removeIfImpliedFree(int col, int i, int k) {
     low = rowLower.at(i);
     upp = rowUpper.at(i);
   }
+  // Both the removal and any implied bounds depend on the row bound
+  // chosen by the sign of the cost
+  if (yi != 0) recordCostSign(col);
 
   pair<double, double> p = getBoundsImpliedFree(low, upp, col, i, k);
   low = p.first;
@@ -1806,8 +2282,10 @@ bool Presolve::removeIfImpliedFree(int col, int i, int k) {
 // used to remove column too, now possible to just modify bounds
 void Presolve::removeRow(int i) {
   hasChange = true;
+  markRowChanged(i);
   flagRow.at(i) = 0;
-  for (int k = ARstart.at(i); k < ARstart.at(i + 1); ++k) {
+  for (int k = liveRowEntry(i, ARstart.at(i)); k < ARstart.at(i + 1);
+       k = liveRowEntry(i, k + 1)) {
     int j = ARindex.at(k);
     if (flagCol.at(j)) {
       nzCol.at(j)--;
@@ -1828,57 +2306,37 @@ void Presolve::removeRow(int i) {
 }
 
 void Presolve::fillStackRowBounds(int row) {
-  postValue.push(rowUpper.at(row));
-  postValue.push(rowLower.at(row));
+  postsolveLog.postValue.push(rowUpper.at(row));
+  postsolveLog.postValue.push(rowLower.at(row));
 }
 
 pair<double, double> Presolve::getImpliedRowBounds(int row) {
-  double g = 0;
-  double h = 0;
-
-  int col;
-  for (int k = ARstart.at(row); k < ARstart.at(row + 1); ++k) {
-    col = ARindex.at(k);
-    if (flagCol.at(col)) {
-      if (ARvalue.at(k) < 0) {
-        if (colUpper.at(col) < HIGHS_CONST_INF)
-          g += ARvalue.at(k) * colUpper.at(col);
-        else {
-          g = -HIGHS_CONST_INF;
-          break;
-        }
-      } else {
-        if (colLower.at(col) > -HIGHS_CONST_INF)
-          g += ARvalue.at(k) * colLower.at(col);
-        else {
-          g = -HIGHS_CONST_INF;
-          break;
-        }
-      }
-    }
-  }
+  const RowActivity& activity = getRowActivity(row);
+  return make_pair(activity.min(), activity.max());
+}
 
-  for (int k = ARstart.at(row); k < ARstart.at(row + 1); ++k) {
-    col = ARindex.at(k);
-    if (flagCol.at(col)) {
-      if (ARvalue.at(k) < 0) {
-        if (colLower.at(col) > -HIGHS_CONST_INF)
-          h += ARvalue.at(k) * colLower.at(col);
-        else {
-          h = HIGHS_CONST_INF;
-          break;
-        }
-      } else {
-        if (colUpper.at(col) < HIGHS_CONST_INF)
-          h += ARvalue.at(k) * colUpper.at(col);
-        else {
-          h = HIGHS_CONST_INF;
-          break;
-        }
-      }
-    }
+const RowActivity& Presolve::getRowActivity(const int row) {
+  RowActivity& activity = rowActivity[row];
+  if (rowActivityValid[row]) return activity;
+  activity = RowActivity();
+  for (int k = liveRowEntry(row, ARstart.at(row)); k < ARstart.at(row + 1);
+       k = liveRowEntry(row, k + 1)) {
+    const int col = ARindex.at(k);
+    if (!flagCol.at(col)) continue;
+    const double value = ARvalue.at(k);
+    const double min_bound = value < 0 ? colUpper.at(col) : colLower.at(col);
+    const double max_bound = value < 0 ? colLower.at(col) : colUpper.at(col);
+    if (fabs(min_bound) < HIGHS_CONST_INF)
+      activity.min_sum += value * min_bound;
+    else
+      activity.min_inf++;
+    if (fabs(max_bound) < HIGHS_CONST_INF)
+      activity.max_sum += value * max_bound;
+    else
+      activity.max_inf++;
   }
-  return make_pair(g, h);
+  rowActivityValid[row] = 1;
+  return activity;
 }
 
 void Presolve::setVariablesToBoundForForcingRow(const int row,
@@ -1891,7 +2349,7 @@ void Presolve::setVariablesToBoundForForcingRow(const int row,
 
   flagRow.at(row) = 0;
   addChange(FORCING_ROW, row, 0);
-  k = ARstart.at(row);
+  k = liveRowEntry(row, ARstart.at(row));
   while (k < ARstart.at(row + 1)) {
     col = ARindex.at(k);
     if (flagCol.at(col)) {
@@ -1903,15 +2361,16 @@ void Presolve::setVariablesToBoundForForcingRow(const int row,
 
       setPrimalValue(col, value);
       valueColDual.at(col) = colCost.at(col);
+      recordColDual(col);
       vector<double> bnds({colLower.at(col), colUpper.at(col)});
-      oldBounds.push(make_pair(col, bnds));
+      postsolveLog.oldBounds.push(col, bnds);
       addChange(FORCING_ROW_VARIABLE, 0, col);
 
       if (iPrint > 0)
         cout << "PR:      Variable  " << col << " := " << value << endl;
       countRemovedCols(FORCING_ROW);
     }
-    ++k;
+    k = liveRowEntry(row, k + 1);
   }
 
   // if (nzRow.at(row) == 1) singRow.remove(row);
@@ -1928,10 +2387,14 @@ void Presolve::dominatedConstraintProcedure(const int i, const double g,
     if (h < implRowValueUpper.at(i)) {
       implRowValueUpper.at(i) = h;
     }
-    if (h <= rowUpper.at(i)) implRowDualLower.at(i) = 0;
+    if (h <= rowUpper.at(i) && implRowDualLower.at(i) != 0) {
+      implRowDualLower.at(i) = 0;
+      markRowChanged(i);
+    }
 
     // calculate implied bounds for discovering free column singletons
-    for (int k = ARstart.at(i); k < ARstart.at(i + 1); ++k) {
+    for (int k = liveRowEntry(i, ARstart.at(i)); k < ARstart.at(i + 1);
+         k = liveRowEntry(i, k + 1)) {
       j = ARindex.at(k);
       if (flagCol.at(j)) {
         if (ARvalue.at(k) < 0 && colLower.at(j) > -HIGHS_CONST_INF) {
@@ -1955,10 +2418,14 @@ void Presolve::dominatedConstraintProcedure(const int i, const double g,
     if (g > implRowValueLower.at(i)) {
       implRowValueLower.at(i) = g;
     }
-    if (g >= rowLower.at(i)) implRowDualUpper.at(i) = 0;
+    if (g >= rowLower.at(i) && implRowDualUpper.at(i) != 0) {
+      implRowDualUpper.at(i) = 0;
+      markRowChanged(i);
+    }
 
     // calculate implied bounds for discovering free column singletons
-    for (int k = ARstart.at(i); k < ARstart.at(i + 1); ++k) {
+    for (int k = liveRowEntry(i, ARstart.at(i)); k < ARstart.at(i + 1);
+         k = liveRowEntry(i, k + 1)) {
       int j = ARindex.at(k);
       if (flagCol.at(j)) {
         if (ARvalue.at(k) < 0 && colUpper.at(j) < HIGHS_CONST_INF) {
@@ -1987,49 +2454,130 @@ void Presolve::removeForcingConstraints() {
     status = stat::Timeout;
     return;
   }
-  for (int i = 0; i < numRow; ++i)
-    if (flagRow.at(i)) {
-      if (status) return;
-      if (nzRow.at(i) == 0) {
-        removeEmptyRow(i);
-        countRemovedRows(EMPTY_ROW);
-        continue;
-      }
-
-      // removeRowSingletons will handle just after removeForcingConstraints
-      if (nzRow.at(i) == 1) continue;
+  // Rows changed by the reductions below are taken again, so that
+  // forcing rows propagate to each other within the pass
+  changedRows.take(forcingRowPosition, queueEntries);
+  while (!queueEntries.empty()) {
+    detectImpliedRowBounds();
+    for (int ix = 0; ix < (int)queueEntries.size(); ix++) {
+      const int i = queueEntries[ix];
+      if (flagRow.at(i)) {
+        if (status) return;
+        countWork(1 + nzRow[i]);
+        if (nzRow.at(i) == 0) {
+          removeEmptyRow(i);
+          countRemovedRows(EMPTY_ROW);
+          continue;
+        }
 
-      implBounds = getImpliedRowBounds(i);
+        // removeRowSingletons will handle just after removeForcingConstraints
+        if (nzRow.at(i) == 1) continue;
 
-      g = implBounds.first;
-      h = implBounds.second;
+        implBounds = getImpliedRowBounds(i);
+        g = implBounds.first;
+        h = implBounds.second;
 
-      // Infeasible row
-      if (g > rowUpper.at(i) || h < rowLower.at(i)) {
-        if (iPrint > 0) cout << "PR: Problem infeasible." << endl;
-        status = Infeasible;
-        return;
-      }
-      // Forcing row
-      else if (g == rowUpper.at(i)) {
-        setVariablesToBoundForForcingRow(i, true);
-      } else if (h == rowLower.at(i)) {
-        setVariablesToBoundForForcingRow(i, false);
+        // Infeasible row
+        if (g > rowUpper.at(i) || h < rowLower.at(i)) {
+          if (iPrint > 0) cout << "PR: Problem infeasible." << endl;
+          status = Infeasible;
+          return;
+        }
+        // Forcing row
+        else if (g == rowUpper.at(i)) {
+          setVariablesToBoundForForcingRow(i, true);
+        } else if (h == rowLower.at(i)) {
+          setVariablesToBoundForForcingRow(i, false);
+        }
+        // Redundant row
+        else if (g >= rowLower.at(i) && h <= rowUpper.at(i)) {
+          removeRow(i);
+          addChange(REDUNDANT_ROW, i, 0);
+          if (iPrint > 0)
+            cout << "PR: Redundant row " << i << " removed." << endl;
+          countRemovedRows(REDUNDANT_ROW);
+        }
+        // Dominated constraints
+        else {
+          dominatedConstraintProcedure(i, g, h);
+          continue;
+        }
       }
-      // Redundant row
-      else if (g >= rowLower.at(i) && h <= rowUpper.at(i)) {
-        removeRow(i);
-        addChange(REDUNDANT_ROW, i, 0);
-        if (iPrint > 0)
-          cout << "PR: Redundant row " << i << " removed." << endl;
-        countRemovedRows(REDUNDANT_ROW);
+    }
+    changedRows.take(forcingRowPosition, queueEntries);
+  }
+}
+
+void Presolve::detectImpliedRowBounds() {
+  const int num_entries = (int)queueEntries.size();
+#pragma omp parallel for schedule(dynamic, 256) \
+    if (num_entries >= presolve_parallel_min_entries)
+  for (int ix = 0; ix < num_entries; ix++) {
+    const int i = queueEntries[ix];
+    if (flagRow[i] && nzRow[i] > 1) getRowActivity(i);
+  }
+}
+
+void Presolve::tightenImpliedBounds() {
+  if (timer.reachLimit()) {
+    status = stat::Timeout;
+    return;
+  }
+  changedRows.take(impliedBoundPosition, queueEntries);
+  if (queueEntries.empty()) return;
+  timer.recordStart(IMPLIED_BOUNDS);
+  detectImpliedRowBounds();
+  for (const int i : queueEntries) {
+    if (!flagRow.at(i) || nzRow.at(i) < 2) continue;
+    countWork(1 + nzRow[i]);
+    const RowActivity& activity = getRowActivity(i);
+    // A row bound implies a bound on each column when the opposite
+    // activity of the other columns is finite
+    const bool use_upper =
+        rowUpper.at(i) < HIGHS_CONST_INF && activity.min_inf <= 1;
+    const bool use_lower =
+        rowLower.at(i) > -HIGHS_CONST_INF && activity.max_inf <= 1;
+    if (!use_upper && !use_lower) continue;
+    for (int k = liveRowEntry(i, ARstart.at(i)); k < ARstart.at(i + 1);
+         k = liveRowEntry(i, k + 1)) {
+      const int j = ARindex.at(k);
+      if (!flagCol.at(j)) continue;
+      const double a = ARvalue.at(k);
+      if (use_upper) {
+        const double bound = a < 0 ? colUpper.at(j) : colLower.at(j);
+        const double slack = (rowUpper.at(i) - activity.min_sum) / a;
+        if (fabs(bound) < HIGHS_CONST_INF) {
+          if (!activity.min_inf) setImpliedColBound(j, i, a > 0, slack + bound);
+        } else {
+          setImpliedColBound(j, i, a > 0, slack);
+        }
       }
-      // Dominated constraints
-      else {
-        dominatedConstraintProcedure(i, g, h);
-        continue;
+      if (use_lower) {
+        const double bound = a < 0 ? colLower.at(j) : colUpper.at(j);
+        const double slack = (rowLower.at(i) - activity.max_sum) / a;
+        if (fabs(bound) < HIGHS_CONST_INF) {
+          if (!activity.max_inf) setImpliedColBound(j, i, a < 0, slack + bound);
+        } else {
+          setImpliedColBound(j, i, a < 0, slack);
+        }
       }
     }
+  }
+  timer.recordFinish(IMPLIED_BOUNDS);
+}
+
+void Presolve::setImpliedColBound(const int col, const int row,
+                                  const bool upper, const double value) {
+  if (upper) {
+    if (value >= implColUpper.at(col)) return;
+    implColUpper.at(col) = value;
+    implColUpperRowIndex.at(col) = row;
+  } else {
+    if (value <= implColLower.at(col)) return;
+    implColLower.at(col) = value;
+    implColLowerRowIndex.at(col) = row;
+  }
+  timer.addChange(IMPLIED_BOUNDS);
 }
 
 void Presolve::removeRowSingletons() {
@@ -2053,6 +2601,7 @@ void Presolve::removeRowSingletons() {
       }
 
       const int j = ARindex.at(k);
+      countWork(1 + nzRow[i] + nzCol[j]);
 
       // add old bounds OF X to checker and for postsolve
       if (iKKTcheck == 1) {
@@ -2068,7 +2617,7 @@ void Presolve::removeRowSingletons() {
 
       vector<double> bnds(
           {colLower.at(j), colUpper.at(j), rowLower.at(i), rowUpper.at(i)});
-      oldBounds.push(make_pair(j, bnds));
+      postsolveLog.oldBounds.push(j, bnds);
 
       double aij = ARvalue.at(k);
       /*		//before update bounds of x take it out of rows with
@@ -2122,6 +2671,8 @@ void Presolve::removeRowSingletons() {
               }
       }*/
 
+      markColChanged(j);
+
       // check for feasibility
       // Analyse dependency on numerical tolerance
       timer.updateNumericsRecord(INCONSISTENT_BOUNDS,
@@ -2138,7 +2689,8 @@ void Presolve::removeRowSingletons() {
              << " u=" << colUpper.at(j) << ", aij = " << aij << endl;
 
       addChange(SING_ROW, i, j);
-      postValue.push(colCost.at(j));
+      postsolveLog.postValue.push(colCost.at(j));
+      recordCostInLog(j, postsolveLog.postValue.topPosition());
       removeRow(i);
 
       if (flagCol.at(j)) {
@@ -2167,20 +2719,183 @@ void Presolve::addChange(PresolveRule type, int row, int col) {
   ch.type = type;
   ch.row = row;
   ch.col = col;
-  chng.push(ch);
+  postsolveLog.chng.push(ch);
 
   if (type < PRESOLVE_RULES_COUNT) timer.addChange(type);
+  // These reductions compare the costs with other values
+  if (type == DOMINATED_COLS || type == WEAKLY_DOMINATED_COLS ||
+      type == DUPLICATE_COLS)
+    costDependent = true;
+}
+
+void Presolve::recordCostTransfer(const int col, const int source,
+                                  const double value, const double divisor) {
+  if (!recordCostSteps) return;
+  costSteps.push_back(
+      CostStep{CostStep::kTransfer, col, source, value, divisor, 0});
+}
+
+void Presolve::recordCostInLog(const int col, const size_t position) {
+  if (!recordCostSteps) return;
+  costSteps.push_back(CostStep{CostStep::kLogValue, col, -1, 0, 1, position});
+}
+
+void Presolve::recordColDual(const int col) {
+  if (!recordCostSteps) return;
+  costSteps.push_back(CostStep{CostStep::kColDual, col, -1, 0, 1, 0});
+}
+
+void Presolve::recordRowDual(const int row, const int col,
+                             const double divisor) {
+  if (!recordCostSteps) return;
+  costSteps.push_back(CostStep{CostStep::kRowDual, row, col, 0, divisor, 0});
+}
+
+void Presolve::recordCostSign(const int col) {
+  if (!recordCostSteps) return;
+  costSteps.push_back(
+      CostStep{CostStep::kSign, col, -1, colCost.at(col), 1, 0});
+}
+
+static int costSign(const double cost) { return (cost > 0) - (cost < 0); }
+
+bool Presolve::replayCosts(const vector<double>& cost,
+                           vector<double>& reduced_cost) {
+  assert(recordCostSteps);
+  // The KKT checker keeps copies of the costs of its own
+  if (costDependent || iKKTcheck) return false;
+  assert((int)cost.size() == numColOriginal);
+  vector<double> work = cost;
+  for (const CostStep& step : costSteps) {
+    switch (step.type) {
+      case CostStep::kTransfer:
+        work[step.index] =
+            work[step.index] - work[step.source] * step.value / step.divisor;
+        break;
+      case CostStep::kLogValue:
+        postsolveLog.write(step.position, work[step.index]);
+        break;
+      case CostStep::kColDual:
+        valueColDual[step.index] = work[step.index];
+        break;
+      case CostStep::kRowDual:
+        valueRowDual[step.index] = -work[step.source] / step.divisor;
+        break;
+      case CostStep::kSign:
+        if (costSign(work[step.index]) != costSign(step.value)) return false;
+        break;
+    }
+  }
+  colCostOriginal = cost;
+  reduced_cost.clear();
+  for (int col = 0; col < numColOriginal; col++)
+    if (flagCol[col]) reduced_cost.push_back(work[col]);
+  colCostAtEl = std::move(work);
+  return true;
+}
+
+bool Presolve::replayColBounds(const HighsLp& lp, HighsLp& reduced_lp) {
+  if (iKKTcheck) return false;
+  assert(lp.numCol_ == numColOriginal && lp.numRow_ == numRowOriginal);
+  if (reduced_lp.numCol_ == 0) return false;
+  // A column is untouched if it is in the reduced LP with its bounds
+  // before presolve, and its implied bounds were never tightened
+  auto untouchedCol = [&](const int col) {
+    if (!flagCol[col]) return false;
+    const int reduced_col = cIndex[col];
+    return reduced_lp.colLower_[reduced_col] == colLowerOriginal[col] &&
+           reduced_lp.colUpper_[reduced_col] == colUpperOriginal[col] &&
+           implColLower[reduced_col] <= colLowerOriginal[col] &&
+           implColUpper[reduced_col] >= colUpperOriginal[col];
+  };
+  auto untouchedRow = [&](const int row) {
+    if (!flagRow[row]) return false;
+    const int reduced_row = rIndex[row];
+    return reduced_lp.rowLower_[reduced_row] == rowLowerOriginal[row] &&
+           reduced_lp.rowUpper_[reduced_row] == rowUpperOriginal[row];
+  };
+
+  vector<int> changed_cols;
+  for (int col = 0; col < numColOriginal; col++)
+    if (lp.colLower_[col] != colLowerOriginal[col] ||
+        lp.colUpper_[col] != colUpperOriginal[col])
+      changed_cols.push_back(col);
+  if (changed_cols.empty()) return true;
+
+  // Row-wise copy of the matrix, to reach the columns in the rows of
+  // the changed columns
+  vector<int> row_start(numRowOriginal + 1, 0);
+  vector<int> row_index(lp.Astart_[numColOriginal]);
+  for (int k = 0; k < lp.Astart_[numColOriginal]; k++)
+    row_start[lp.Aindex_[k] + 1]++;
+  for (int row = 0; row < numRowOriginal; row++)
+    row_start[row + 1] += row_start[row];
+  vector<int> row_fill(row_start.begin(), row_start.end() - 1);
+  for (int col = 0; col < numColOriginal; col++)
+    for (int k = lp.Astart_[col]; k < lp.Astart_[col + 1]; k++)
+      row_index[row_fill[lp.Aindex_[k]]++] = col;
+
+  for (int col : changed_cols) {
+    if (!untouchedCol(col)) return false;
+    for (int k = lp.Astart_[col]; k < lp.Astart_[col + 1]; k++) {
+      const int row = lp.Aindex_[k];
+      if (!untouchedRow(row)) return false;
+      for (int r = row_start[row]; r < row_start[row + 1]; r++)
+        if (!untouchedCol(row_index[r])) return false;
+    }
+  }
+  for (int col : changed_cols) {
+    reduced_lp.colLower_[cIndex[col]] = lp.colLower_[col];
+    reduced_lp.colUpper_[cIndex[col]] = lp.colUpper_[col];
+    implColLower[cIndex[col]] = lp.colLower_[col];
+    implColUpper[cIndex[col]] = lp.colUpper_[col];
+    colLowerOriginal[col] = lp.colLower_[col];
+    colUpperOriginal[col] = lp.colUpper_[col];
+  }
+  return true;
+}
+
+// Neighbours already logged since the latest rule ran are only
+// touched, so that their implied bounds are recomputed
+void Presolve::markRowChanged(const int row) {
+  rowActivityValid[row] = 0;
+  const bool marked = changedRows.mark(row);
+  for (int k = liveRowEntry(row, ARstart.at(row)); k < ARstart.at(row + 1);
+       k = liveRowEntry(row, k + 1)) {
+    const int col = ARindex.at(k);
+    if (!flagCol.at(col)) continue;
+    if (marked)
+      changedCols.log(col);
+    else
+      changedCols.touch(col);
+  }
+}
+
+void Presolve::markColChanged(const int col) {
+  const bool marked = changedCols.mark(col);
+  for (int k = liveColEntry(col, Astart.at(col)); k < Aend.at(col);
+       k = liveColEntry(col, k + 1)) {
+    const int row = Aindex.at(k);
+    if (!flagRow.at(row)) continue;
+    rowActivityValid[row] = 0;
+    if (marked)
+      changedRows.log(row);
+    else
+      changedRows.touch(row);
+  }
 }
 
 // when setting a value to a primal variable and eliminating row update b,
 // singleton Rows linked list, number of nonzeros in rows
 void Presolve::setPrimalValue(int j, double value) {
+  markColChanged(j);
   flagCol.at(j) = 0;
   if (!hasChange) hasChange = true;
   valuePrimal.at(j) = value;
 
   // update nonzeros
-  for (int k = Astart.at(j); k < Aend.at(j); ++k) {
+  for (int k = liveColEntry(j, Astart.at(j)); k < Aend.at(j);
+       k = liveColEntry(j, k + 1)) {
     int row = Aindex.at(k);
     if (flagRow.at(row)) {
       nzRow.at(row)--;
@@ -2197,7 +2912,8 @@ void Presolve::setPrimalValue(int j, double value) {
     // RHS
     vector<pair<int, double>> bndsL, bndsU;
 
-    for (int k = Astart.at(j); k < Aend.at(j); ++k)
+    for (int k = liveColEntry(j, Astart.at(j)); k < Aend.at(j);
+         k = liveColEntry(j, k + 1))
       if (flagRow.at(Aindex.at(k))) {
         const int row = Aindex[k];
 
@@ -2395,13 +3111,11 @@ void Presolve::resizeImpliedBounds() {
 
 int Presolve::getSingRowElementIndexInAR(int i) {
   assert(i >= 0 && i < numRow);
-  int k = ARstart.at(i);
-  while (k < ARstart[i + 1] && !flagCol.at(ARindex.at(k))) k++;
+  int k = liveRowEntry(i, ARstart.at(i));
   if (k >= ARstart.at(i + 1)) {
     return -1;
   }
-  int rest = k + 1;
-  while (rest < ARstart.at(i + 1) && !flagCol.at(ARindex.at(rest))) ++rest;
+  int rest = liveRowEntry(i, k + 1);
   if (rest < ARstart.at(i + 1)) {
     return -1;
   }
@@ -2409,13 +3123,11 @@ int Presolve::getSingRowElementIndexInAR(int i) {
 }
 
 int Presolve::getSingColElementIndexInA(int j) {
-  int k = Astart.at(j);
-  while (!flagRow.at(Aindex.at(k))) ++k;
+  int k = liveColEntry(j, Astart.at(j));
   if (k >= Aend.at(j)) {
     return -1;
   }
-  int rest = k + 1;
-  while (rest < Aend.at(j) && !flagRow.at(Aindex.at(rest))) ++rest;
+  int rest = liveColEntry(j, k + 1);
   if (rest < Aend.at(j)) {
     // Occurs if a singleton column is no longer singleton.
     return -1;
@@ -2554,9 +3266,9 @@ HighsPostsolveStatus Presolve::postsolve(const HighsSolution& reduced_solution,
   }
 
   vector<int> fRjs;
-  while (!chng.empty()) {
-    change c = chng.top();
-    chng.pop();
+  while (!postsolveLog.chng.empty()) {
+    change c = postsolveLog.chng.top();
+    postsolveLog.chng.pop();
     // cout<<"chng.pop:       "<<c.col<<"       "<<c.row << endl;
 
     setBasisElement(c);
@@ -2589,14 +3301,14 @@ HighsPostsolveStatus Presolve::postsolve(const HighsSolution& reduced_solution,
         int indi;
         for (indi = ARstart[c.row]; indi < ARstart[c.row + 1]; ++indi)
           if (ARindex.at(indi) == c.col) break;
-        ARvalue.at(indi) = postValue.top();
+        ARvalue.at(indi) = postsolveLog.postValue.top();
         for (indi = Astart[c.col]; indi < Aend[c.col]; ++indi)
           if (Aindex.at(indi) == c.row) break;
-        Avalue.at(indi) = postValue.top();
+        Avalue.at(indi) = postsolveLog.postValue.top();
 
         if (iKKTcheck == 1)
-          chk2.addChange(172, c.row, c.col, postValue.top(), 0, 0);
-        postValue.pop();
+          chk2.addChange(172, c.row, c.col, postsolveLog.postValue.top(), 0, 0);
+        postsolveLog.postValue.pop();
 
         break;
       }
@@ -2605,14 +3317,14 @@ HighsPostsolveStatus Presolve::postsolve(const HighsSolution& reduced_solution,
         // case when row does not have x initially: entries for row i swap x and
         // y cols
 
-        const int yindex = (int)postValue.top();
-        postValue.pop();
+        const int yindex = (int)postsolveLog.postValue.top();
+        postsolveLog.postValue.pop();
 
         // reverse AR for case when x is zero and y entry has moved
         int indi;
         for (indi = ARstart[c.row]; indi < ARstart[c.row + 1]; ++indi)
           if (ARindex.at(indi) == c.col) break;
-        ARvalue.at(indi) = postValue.top();
+        ARvalue.at(indi) = postsolveLog.postValue.top();
         ARindex.at(indi) = yindex;
 
         // reverse A for case when x is zero and y entry has moved
@@ -2638,13 +3350,13 @@ HighsPostsolveStatus Presolve::postsolve(const HighsSolution& reduced_solution,
           Avalue.push_back(Avalue.at(ind));
           Aindex.push_back(Aindex.at(ind));
         }
-        Avalue.push_back(postValue.top());
+        Avalue.push_back(postsolveLog.postValue.top());
         Aindex.push_back(c.row);
         Astart[yindex] = st;
         Aend[yindex] = Avalue.size();
 
-        double topp = postValue.top();
-        postValue.pop();
+        double topp = postsolveLog.postValue.top();
+        postsolveLog.postValue.pop();
         if (iKKTcheck == 1) {
           chk2.addChange(173, c.row, c.col, topp, (double)yindex, 0);
         }
@@ -2657,9 +3369,9 @@ HighsPostsolveStatus Presolve::postsolve(const HighsSolution& reduced_solution,
         for (indi = ARstart[c.row]; indi < ARstart[c.row + 1]; ++indi)
           if (ARindex.at(indi) == numColOriginal) break;
         ARindex.at(indi) = c.col;
-        ARvalue.at(indi) = postValue.top();
+        ARvalue.at(indi) = postsolveLog.postValue.top();
 
-        postValue.pop();
+        postsolveLog.postValue.pop();
 
         break;
       }
@@ -2667,8 +3379,8 @@ HighsPostsolveStatus Presolve::postsolve(const HighsSolution& reduced_solution,
         // sp case x disappears column representation change
         // here A is copied from AR array at end of presolve so need to expand x
         // column  Aend[c.col]++; wouldn't do because old value is overriden
-        double oldXvalue = postValue.top();
-        postValue.pop();
+        double oldXvalue = postsolveLog.postValue.top();
+        postsolveLog.postValue.pop();
         int x = c.col;
 
         // update A: append X column to end of array
@@ -2756,10 +3468,10 @@ HighsPostsolveStatus Presolve::postsolve(const HighsSolution& reduced_solution,
           if (flagCol.at(ARindex.at(k)))
             sum += valuePrimal.at(ARindex.at(k)) * ARvalue.at(k);
 
-        double rowlb = postValue.top();
-        postValue.pop();
-        double rowub = postValue.top();
-        postValue.pop();
+        double rowlb = postsolveLog.postValue.top();
+        postsolveLog.postValue.pop();
+        double rowub = postsolveLog.postValue.top();
+        postsolveLog.postValue.pop();
 
         // calculate xj
         if (valueRowDual[c.row] < 0) {
@@ -2812,8 +3524,8 @@ HighsPostsolveStatus Presolve::postsolve(const HighsSolution& reduced_solution,
         }
         sum = sum + valuePrimal[c.col] * aij;
 
-        double costAtTimeOfElimination = postValue.top();
-        postValue.pop();
+        double costAtTimeOfElimination = postsolveLog.postValue.top();
+        postsolveLog.postValue.pop();
         objShift += (costAtTimeOfElimination * sum) / aij;
 
         flagRow[c.row] = 1;
@@ -2840,36 +3552,36 @@ HighsPostsolveStatus Presolve::postsolve(const HighsSolution& reduced_solution,
         // rowDual depending on bounds. old bounds kept in oldBounds. variables
         // j,k : we eliminated j and are left with changed bounds on k and no
         // row. c.col is column COL (K) - eliminated, j is with new bounds
-        pair<int, vector<double>> p = oldBounds.top();
-        oldBounds.pop();
-        const int j = p.first;
-        vector<double> v = p.second;
+        PostsolveBounds p = postsolveLog.oldBounds.top();
+        postsolveLog.oldBounds.pop();
+        const int j = p.index;
+        const double* v = p.value;
         // double lbNew = v[0];
         // double ubNew = v[1];
         double cjNew = v[2];
 
-        p = oldBounds.top();
-        oldBounds.pop();
-        v = p.second;
+        p = postsolveLog.oldBounds.top();
+        postsolveLog.oldBounds.pop();
+        v = p.value;
         double ubOld = v[1];
         double lbOld = v[0];
         double cjOld = v[2];
 
-        p = oldBounds.top();
-        oldBounds.pop();
-        v = p.second;
+        p = postsolveLog.oldBounds.top();
+        postsolveLog.oldBounds.pop();
+        v = p.value;
         double ubCOL = v[1];
         double lbCOL = v[0];
         double ck = v[2];
 
-        double rowlb = postValue.top();
-        postValue.pop();
-        double rowub = postValue.top();
-        postValue.pop();
-        double aik = postValue.top();
-        postValue.pop();
-        double aij = postValue.top();
-        postValue.pop();
+        double rowlb = postsolveLog.postValue.top();
+        postsolveLog.postValue.pop();
+        double rowub = postsolveLog.postValue.top();
+        postsolveLog.postValue.pop();
+        double aik = postsolveLog.postValue.top();
+        postsolveLog.postValue.pop();
+        double aij = postsolveLog.postValue.top();
+        postsolveLog.postValue.pop();
         double xj = valuePrimal.at(j);
 
         // calculate xk, depending on signs of coeff and cost
@@ -3023,6 +3735,14 @@ HighsPostsolveStatus Presolve::postsolve(const HighsSolution& reduced_solution,
         break;
       }
 
+      case DUPLICATE_ROWS: {
+        getDualsDuplicateRow(c.row);
+        break;
+      }
+      case DUPLICATE_COLS: {
+        getPrimalsDuplicateColumn(c.col);
+        break;
+      }
       case FIXED_COL: {
         // got valuePrimal, need colDual
         valueColDual[c.col] = getColumnDualPost(c.col);
@@ -3116,6 +3836,8 @@ HighsPostsolveStatus Presolve::postsolve(const HighsSolution& reduced_solution,
     checkKkt(true);
   }
 
+  setNonbasicBoundStatus();
+
   // Save solution to PresolveComponentData.
   recovered_solution.col_value = colValue;
   recovered_solution.col_dual = colDual;
@@ -3150,6 +3872,30 @@ void Presolve::checkKkt(bool final) {
   std::cout << "~~~~~~~~ " << std::endl;
 }
 
+// Status of a nonbasic variable with the given value and bounds. A
+// boxed variable is at the nearer of its bounds
+static HighsBasisStatus nonbasicBoundStatus(const double value,
+                                            const double lower,
+                                            const double upper) {
+  if (lower <= -HIGHS_CONST_INF && upper >= HIGHS_CONST_INF)
+    return HighsBasisStatus::ZERO;
+  if (upper >= HIGHS_CONST_INF) return HighsBasisStatus::LOWER;
+  if (lower <= -HIGHS_CONST_INF) return HighsBasisStatus::UPPER;
+  if (value < 0.5 * (lower + upper)) return HighsBasisStatus::LOWER;
+  return HighsBasisStatus::UPPER;
+}
+
+void Presolve::setNonbasicBoundStatus() {
+  for (int j = 0; j < numColOriginal; ++j)
+    if (col_status[j] == HighsBasisStatus::NONBASIC)
+      col_status[j] =
+          nonbasicBoundStatus(colValue[j], colLower[j], colUpper[j]);
+  for (int i = 0; i < numRowOriginal; ++i)
+    if (row_status[i] == HighsBasisStatus::NONBASIC)
+      row_status[i] =
+          nonbasicBoundStatus(rowValue[i], rowLower[i], rowUpper[i]);
+}
+
 void Presolve::setBasisElement(change c) {
   // col_status starts off as [numCol] and has already been increased to
   // [numColOriginal] and row_status starts off as [numRow] and has already been
@@ -3203,8 +3949,8 @@ void Presolve::setBasisElement(change c) {
     }
     case FIXED_COL: {  // fixed variable:
       // check if it was NOT after singRow
-      if (chng.size() > 0)
-        if (chng.top().type != SING_ROW) {
+      if (postsolveLog.chng.size() > 0)
+        if (postsolveLog.chng.top().type != SING_ROW) {
           if (report_postsolve) {
             printf(
                 "2.8 : Recover column %3d (nonbasic): weakly dominated "
@@ -3432,9 +4178,9 @@ string Presolve::getDualsForcingRow(int row, vector<int>& fRjs) {
   for (size_t jj = 0; jj < fRjs.size(); ++jj) {
     j = fRjs[jj];
 
-    pair<int, vector<double>> p = oldBounds.top();
-    vector<double> v = get<1>(p);
-    oldBounds.pop();
+    PostsolveBounds p = postsolveLog.oldBounds.top();
+    const double* v = p.value;
+    postsolveLog.oldBounds.pop();
     double colLow = v[0];
     double colUpp = v[1];
 
@@ -3501,20 +4247,20 @@ string Presolve::getDualsForcingRow(int row, vector<int>& fRjs) {
 }
 
 void Presolve::getDualsSingletonRow(const int row, const int col) {
-  pair<int, vector<double>> bnd = oldBounds.top();
-  oldBounds.pop();
+  PostsolveBounds bnd = postsolveLog.oldBounds.top();
+  postsolveLog.oldBounds.pop();
 
   valueRowDual.at(row) = 0;
 
-  const double cost = postValue.top();
-  postValue.pop();
+  const double cost = postsolveLog.postValue.top();
+  postsolveLog.postValue.pop();
   colCostAtEl[col] = cost;
 
   const double aij = getaij(row, col);
-  const double l = (get<1>(bnd))[0];
-  const double u = (get<1>(bnd))[1];
-  const double lrow = (get<1>(bnd))[2];
-  const double urow = (get<1>(bnd))[3];
+  const double l = bnd.value[0];
+  const double u = bnd.value[1];
+  const double lrow = bnd.value[2];
+  const double urow = bnd.value[3];
 
   flagRow.at(row) = 1;
 
@@ -3566,42 +4312,145 @@ void Presolve::getDualsSingletonRow(const int row, const int col) {
   }
 }
 
+void Presolve::getDualsDuplicateRow(const int k) {
+  // The dual of row i is that of the merged row, so it is moved to
+  // row k if the active bound of the merged row came from row k
+  PostsolveBounds p = postsolveLog.oldBounds.top();
+  postsolveLog.oldBounds.pop();
+  const int i = p.index;
+  const double* bnds = p.value;
+  const double lower_i = bnds[0];
+  const double upper_i = bnds[1];
+  const double lower_k = bnds[2];
+  const double upper_k = bnds[3];
+  const double v = bnds[4];
+
+  flagRow.at(k) = 1;
+  valueRowDual.at(k) = 0;
+  row_status.at(k) = HighsBasisStatus::BASIC;
+  if (row_status.at(i) == HighsBasisStatus::BASIC) return;
+
+  const double y = valueRowDual.at(i);
+  bool at_lower;
+  if (y != 0) {
+    at_lower = y < 0;
+  } else {
+    double activity = 0;
+    for (int kk = ARstart.at(i); kk < ARstart.at(i + 1); ++kk)
+      if (flagCol.at(ARindex.at(kk)))
+        activity += ARvalue.at(kk) * valuePrimal.at(ARindex.at(kk));
+    at_lower = fabs(activity - max(lower_i, lower_k)) <=
+               fabs(activity - min(upper_i, upper_k));
+  }
+  const bool from_k = at_lower ? lower_k > lower_i : upper_k < upper_i;
+  if (!from_k) return;
+
+  if (report_postsolve) {
+    printf("2.9 : Make row %3d basic and duplicate row %3d nonbasic\n", i, k);
+  }
+  row_status.at(k) = HighsBasisStatus::NONBASIC;
+  valueRowDual.at(k) = y / v;
+  row_status.at(i) = HighsBasisStatus::BASIC;
+  valueRowDual.at(i) = 0;
+}
+
+void Presolve::getPrimalsDuplicateColumn(const int k) {
+  // The value of column j is that of x_j + v x_k, which is split so
+  // that at most one of x_j and x_k is basic
+  PostsolveBounds p = postsolveLog.oldBounds.top();
+  postsolveLog.oldBounds.pop();
+  const int j = p.index;
+  const double* bnds = p.value;
+  const double lower_j = bnds[0];
+  const double upper_j = bnds[1];
+  const double lower_k = bnds[2];
+  const double upper_k = bnds[3];
+  const double v = bnds[4];
+
+  flagCol.at(k) = 1;
+  const double x = valuePrimal.at(j);
+  const double z = valueColDual.at(j);
+  valueColDual.at(k) = v * z;
+  col_status.at(k) = HighsBasisStatus::NONBASIC;
+
+  if (col_status.at(j) != HighsBasisStatus::BASIC) {
+    // Both columns are at the bounds giving the merged bound
+    const double lower = v > 0 ? lower_j + v * lower_k : lower_j + v * upper_k;
+    const double upper = v > 0 ? upper_j + v * upper_k : upper_j + v * lower_k;
+    const bool at_lower =
+        z != 0 ? z > 0 : fabs(x - lower) <= fabs(x - upper);
+    const double value_j = at_lower ? lower_j : upper_j;
+    const double value_k = at_lower == (v > 0) ? lower_k : upper_k;
+    if (fabs(value_j) < HIGHS_CONST_INF && fabs(value_k) < HIGHS_CONST_INF) {
+      valuePrimal.at(j) = value_j;
+      valuePrimal.at(k) = value_k;
+      return;
+    }
+  }
+
+  // Put x_k at a bound if x_j is then within its bounds
+  for (const double value_k : {lower_k, upper_k}) {
+    if (fabs(value_k) >= HIGHS_CONST_INF) continue;
+    const double value_j = x - v * value_k;
+    if (value_j >= lower_j - tol && value_j <= upper_j + tol) {
+      valuePrimal.at(j) = value_j;
+      valuePrimal.at(k) = value_k;
+      return;
+    }
+  }
+  // Otherwise put x_j at a bound and x_k takes its status
+  for (const double value_j : {lower_j, upper_j}) {
+    if (fabs(value_j) >= HIGHS_CONST_INF) continue;
+    const double value_k = (x - value_j) / v;
+    if (value_k >= lower_k - tol && value_k <= upper_k + tol) {
+      valuePrimal.at(j) = value_j;
+      valuePrimal.at(k) = value_k;
+      col_status.at(k) = col_status.at(j);
+      col_status.at(j) = HighsBasisStatus::NONBASIC;
+      return;
+    }
+  }
+  // Both columns are free
+  valuePrimal.at(k) = max(lower_k, min(0.0, upper_k));
+  valuePrimal.at(j) = x - v * valuePrimal.at(k);
+}
+
 void Presolve::getDualsDoubletonEquation(const int row, const int col) {
   // colDual already set. need valuePrimal from stack. maybe change rowDual
   // depending on bounds. old bounds kept in oldBounds. variables j,k : we
   // eliminated col(k)(c.col) and are left with changed bounds on j and no row.
   //                               y x
 
-  pair<int, vector<double>> p = oldBounds.top();
-  oldBounds.pop();
-  vector<double> v = get<1>(p);
-  int x = get<0>(p);
+  PostsolveBounds p = postsolveLog.oldBounds.top();
+  postsolveLog.oldBounds.pop();
+  const double* v = p.value;
+  int x = p.index;
   double ubxNew = v[1];
   double lbxNew = v[0];
   double cxNew = v[2];
 
-  p = oldBounds.top();
-  oldBounds.pop();
-  v = get<1>(p);
+  p = postsolveLog.oldBounds.top();
+  postsolveLog.oldBounds.pop();
+  v = p.value;
   double ubxOld = v[1];
   double lbxOld = v[0];
   double cxOld = v[2];
 
-  p = oldBounds.top();
-  oldBounds.pop();
-  v = get<1>(p);
+  p = postsolveLog.oldBounds.top();
+  postsolveLog.oldBounds.pop();
+  v = p.value;
   double uby = v[1];
   double lby = v[0];
   double cy = v[2];
 
   int y = col;
 
-  double b = postValue.top();
-  postValue.pop();
-  double aky = postValue.top();
-  postValue.pop();
-  double akx = postValue.top();
-  postValue.pop();
+  double b = postsolveLog.postValue.top();
+  postsolveLog.postValue.pop();
+  double aky = postsolveLog.postValue.top();
+  postsolveLog.postValue.pop();
+  double akx = postsolveLog.postValue.top();
+  postsolveLog.postValue.pop();
   double valueX = valuePrimal.at(x);
 
   // primal value and objective shift
@@ -3661,15 +4510,22 @@ void Presolve::getDualsDoubletonEquation(const int row, const int col) {
   //     if (report_postsolve) printf("4.4 : Make row    %3d basic\n", row);
   //   }
   HighsBasisStatus local_status;
+  double dualX = 0;
   if (x < numColOriginal) {
     local_status = col_status.at(x);
+    dualX = valueColDual.at(x);
   } else {
     local_status = row_status.at(x - numColOriginal);
   }
-  if ((local_status != HighsBasisStatus::BASIC && valueX == ubxNew &&
-       ubxNew < ubxOld) ||
-      (local_status != HighsBasisStatus::BASIC && valueX == lbxNew &&
-       lbxNew > lbxOld)) {
+  // x is held by a bound that comes from y if it is nonbasic at a
+  // tightened bound. When x is fixed in the reduced LP, the sign of
+  // its dual gives the bound that holds it
+  const bool fixedX = lbxNew == ubxNew;
+  const bool atNewUpper = valueX == ubxNew && ubxNew < ubxOld &&
+                          !(fixedX && dualX > 0 && lbxNew <= lbxOld);
+  const bool atNewLower = valueX == lbxNew && lbxNew > lbxOld &&
+                          !(fixedX && dualX < 0 && ubxNew >= ubxOld);
+  if (local_status != HighsBasisStatus::BASIC && (atNewUpper || atNewLower)) {
     if (x < numColOriginal) {
       col_status.at(x) = HighsBasisStatus::BASIC;
       // transfer dual of x to dual of row
@@ -14,11 +14,13 @@
 #ifndef PRESOLVE_PRESOLVE_H_
 #define PRESOLVE_PRESOLVE_H_
 
+#include <cstdint>
 #include <list>
 #include <map>
 #include <stack>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -61,6 +63,9 @@ enum class Presolver {
   kMainColSingletons,
   kMainDoubletonEq,
   kMainDominatedCols,
+  kMainDuplicateRows,
+  kMainDuplicateCols,
+  kMainImpliedBounds,
 };
 
 const std::map<Presolver, std::string> kPresolverNames{
@@ -68,7 +73,20 @@ const std::map<Presolver, std::string> kPresolverNames{
     {Presolver::kMainForcing, "Forcing rows ()"},
     {Presolver::kMainColSingletons, "Col singletons ()"},
     {Presolver::kMainDoubletonEq, "Doubleton eq ()"},
-    {Presolver::kMainDominatedCols, "Dominated Cols()"}};
+    {Presolver::kMainDominatedCols, "Dominated Cols()"},
+    {Presolver::kMainDuplicateRows, "Duplicate rows ()"},
+    {Presolver::kMainDuplicateCols, "Duplicate cols ()"},
+    {Presolver::kMainImpliedBounds, "Implied bounds ()"}};
+
+// Queues with fewer entries than this are checked by one thread
+const int presolve_parallel_min_entries = 1000;
+// Presolve stops once the entries it has visited reach this multiple
+// of the size of the LP, which keeps its cost a small fraction of a
+// solve, since each simplex iteration visits a comparable number
+const double presolve_work_limit = 100;
+// Presolvers whose reductions per entry visited fall below this are
+// called in fewer passes of the main loop, until they pay off again
+const double presolve_min_reductions_per_work = 1e-3;
 
 class Presolve : public HPreData {
  public:
@@ -83,6 +101,31 @@ class Presolve : public HPreData {
 
   void setNumericalTolerances();
   void load(const HighsLp& lp);
+
+  // Replace the costs of the LP presolved, in the sense of a
+  // minimization, updating the costs recorded for postsolve and
+  // giving those of the reduced LP. Returns false if a reduction that
+  // depends on the costs does not hold for the new ones. Requires the
+  // cost steps to have been recorded
+  bool replayCosts(const vector<double>& cost, vector<double>& reduced_cost);
+  // Replace the column bounds of the LP presolved by those of lp, which
+  // has the same matrix, updating those of the reduced LP. Returns
+  // false if a column with new bounds is not untouched: it, its rows
+  // and the other columns in them must be in the reduced LP with the
+  // bounds they had before presolve, and no implied bound of those
+  // columns may have been tightened, so no reduction depends on its
+  // bounds
+  bool replayColBounds(const HighsLp& lp, HighsLp& reduced_lp);
+  bool recordCostSteps = false;
+  int numCostSteps() const { return (int)costSteps.size(); }
+  // Work done by the main loop, the passes it made, whether it stopped
+  // at the work limit, and the cost and benefit of each presolver
+  double getWork() const { return stats.work; }
+  int numPasses() const { return (int)stats.pass_work.size(); }
+  bool reachedWorkLimit() const { return workLimitReached; }
+  const std::map<Presolver, PresolverRecord>& getPresolverRecords() const {
+    return presolverRecords;
+  }
   // todo: clear the public from below.
   string modelName;
 
@@ -90,6 +133,10 @@ class Presolve : public HPreData {
   std::vector<Presolver> order;
 
   int max_iterations = 0;
+  // Multiple of the size of the LP on the work of presolve, and the
+  // reductions per work below which a presolver is throttled
+  double work_limit = presolve_work_limit;
+  double min_reductions_per_work = presolve_min_reductions_per_work;
 
   void setTimeLimit(const double limit) {
     assert(limit < inf && limit > 0);
@@ -97,8 +144,8 @@ class Presolve : public HPreData {
   }
 
   int iPrint = 0;
-  int message_level;
-  FILE* output;
+  int message_level = 0;
+  FILE* output = NULL;
 
  private:
   int iKKTcheck = 0;
@@ -148,6 +195,94 @@ class Presolve : public HPreData {
   list<int> singRow;  // singleton rows
   list<int> singCol;  // singleton columns
 
+  // Rows and columns modified since each rule last scanned them, and
+  // the position of each rule in the queues
+  ChangeQueue changedRows;
+  ChangeQueue changedCols;
+  // Links past the dead entries of the rows of AR and the columns of A
+  LiveEntries rowEntries;
+  LiveEntries colEntries;
+  int liveRowEntry(const int row, const int k) {
+    return rowEntries.first(k, ARstart[row + 1], ARindex, flagCol);
+  }
+  int liveColEntry(const int col, const int k) {
+    return colEntries.first(k, Aend[col], Aindex, flagRow);
+  }
+  // Work done, and the limit on it, and the cost and benefit of each
+  // presolver of the main loop
+  double workLimit = 0;
+  bool workLimitReached = false;
+  bool throttlePresolvers = true;
+  bool presolverSkipped = false;
+  std::map<Presolver, PresolverRecord> presolverRecords;
+  void countWork(const int work) {
+    if (!stats.pass_work.empty()) stats.pass_work.back() += work;
+    stats.work += work;
+  }
+  void reportPresolverRecords();
+  int forcingRowPosition = 0;
+  int doubletonRowPosition = 0;
+  int dominatedColPosition = 0;
+  int duplicateRowPosition = 0;
+  int duplicateColPosition = 0;
+  int impliedBoundPosition = 0;
+  vector<int> queueEntries;
+  // Activities of the rows, valid until a bound or coefficient of one
+  // of their columns changes, when they are recomputed on the next
+  // query. The rows taken from a queue are computed by several threads
+  // before the reductions are applied in order by one
+  vector<RowActivity> rowActivity;
+  vector<char> rowActivityValid;
+  const RowActivity& getRowActivity(const int row);
+  // Implied bounds of the columns taken from a queue, computed by
+  // several threads, and the count of queue touches when they were
+  // computed
+  vector<pair<double, double>> queueBounds;
+  int queueBoundsTouches = 0;
+  void detectImpliedRowBounds();
+  void detectImpliedColumnBounds();
+  // Hash of the pattern and scaled values of each row and column,
+  // updated when they are taken from the queues, and a dense work
+  // vector for checking that two of them are parallel
+  vector<uint64_t> rowHash;
+  vector<uint64_t> colHash;
+  vector<double> duplicateWork;
+  // Rows and columns with equal hashes share a bucket. Buckets persist
+  // between passes, and only the entries taken from the queues are
+  // moved between them
+  std::unordered_map<uint64_t, vector<int>> rowBuckets;
+  std::unordered_map<uint64_t, vector<int>> colBuckets;
+  vector<char> rowInBucket;
+  vector<char> colInBucket;
+  // Log the row or column and its neighbours, whose reductions may
+  // depend on it
+  void markRowChanged(const int row);
+  void markColChanged(const int col);
+
+  // A step of presolve that depends on the costs. Each transfer
+  // subtracts a multiple of the cost of a column substituted out from
+  // the cost of another, and the other steps record a cost, or a dual
+  // derived from it, at the time of a reduction, or require its sign
+  // to be unchanged for the reduction to hold
+  struct CostStep {
+    enum Type { kTransfer, kLogValue, kColDual, kRowDual, kSign };
+    Type type;
+    int index;
+    int source;
+    double value;
+    double divisor;
+    size_t position;
+  };
+  vector<CostStep> costSteps;
+  // Set by a reduction that depends on more than the signs of costs
+  bool costDependent = false;
+  void recordCostTransfer(const int col, const int source, const double value,
+                          const double divisor);
+  void recordCostInLog(const int col, const size_t position);
+  void recordColDual(const int col);
+  void recordRowDual(const int row, const int col, const double divisor);
+  void recordCostSign(const int col);
+
   // original data
  public:
   vector<double> colCostOriginal;
@@ -184,6 +319,11 @@ class Presolve : public HPreData {
   void dominatedConstraintProcedure(const int i, const double g,
                                     const double h);
 
+  // implied bounds of columns from the activities of rows
+  void tightenImpliedBounds();
+  void setImpliedColBound(const int col, const int row, const bool upper,
+                          const double value);
+
   // doubleton equations
   void removeDoubletonEquations();
   pair<int, int> getXYDoubletonEquations(const int row);
@@ -219,14 +359,17 @@ class Presolve : public HPreData {
   pair<double, double> getImpliedColumnBounds(int j);
   void removeIfWeaklyDominated(const int j, const double d, const double e);
 
-  //    void findDuplicateRows();
-  //    void findDuplicateColumns();
-  //    void removeDuplicateRows(int i, int k, double v);
-  //    int makeCheckForDuplicateRows(int k, int i, vector<double>& coeff,
-  //    vector<int>& colIndex, double v, int whichIsFirst); void
-  //    removeDuplicateColumns(int j,int k, double v); bool
-  //    checkDuplicateRows(int i, int k) ;
-  //	  bool checkDuplicateColumns(int i, int k) ;
+  // duplicate rows and columns
+  void findDuplicateRows();
+  void findDuplicateColumns();
+  uint64_t getRowHash(const int row);
+  uint64_t getColumnHash(const int col);
+  bool checkDuplicateRows(const int i, const int k, double& v);
+  bool checkDuplicateColumns(const int j, const int k, double& v);
+  void removeDuplicateRow(const int i, const int k, const double v);
+  void removeDuplicateColumn(const int j, const int k, const double v);
+  void getDualsDuplicateRow(const int k);
+  void getPrimalsDuplicateColumn(const int k);
 
   // old or test
   // void updateRemovedColRow(int dim);
@@ -248,6 +391,7 @@ class Presolve : public HPreData {
   double empty_row_bound_tolerance;
   double dominated_column_tolerance;
   double weakly_dominated_column_tolerance;
+  double duplicate_tolerance;
 
   // postsolve
   bool noPostSolve = false;
@@ -267,6 +411,10 @@ class Presolve : public HPreData {
   void trimA();
 
   void setBasisElement(const change c);
+  // Replace NONBASIC by the bound at which each nonbasic column and
+  // row is, so that the simplex solver starts from the recovered
+  // values rather than placing boxed variables at their lower bound
+  void setNonbasicBoundStatus();
 
   // test basis matrix singularity
   //
@@ -45,6 +45,15 @@ void initializePresolveRuleInfo(std::vector<PresolveRuleInfo>& rules) {
   rules.push_back(
       PresolveRuleInfo(DOMINATED_COL_BOUNDS, "Dom col bounds", "DCB"));
   rules.push_back(PresolveRuleInfo(EMPTY_COL, "Empty col", "EMC"));
+  rules.push_back(
+      PresolveRuleInfo(MIP_BOUND_ROUNDING, "MIP bound round", "MBR"));
+  rules.push_back(
+      PresolveRuleInfo(MIP_COEFFICIENT_TIGHTENING, "MIP coef tighten", "MCT"));
+  rules.push_back(PresolveRuleInfo(MIP_PROBING, "MIP probing", "MPR"));
+  rules.push_back(PresolveRuleInfo(MIP_CLIQUE, "MIP clique", "MCL"));
+  rules.push_back(PresolveRuleInfo(DUPLICATE_ROWS, "Duplicate row", "DPR"));
+  rules.push_back(PresolveRuleInfo(DUPLICATE_COLS, "Duplicate col", "DPC"));
+  rules.push_back(PresolveRuleInfo(IMPLIED_BOUNDS, "Implied bounds", "IMB"));
   rules.push_back(PresolveRuleInfo(MATRIX_COPY, "Initialize matrix", "INM"));
   rules.push_back(PresolveRuleInfo(RESIZE_MATRIX, "Resize matrix", "RSM"));
   //
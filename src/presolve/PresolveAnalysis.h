@@ -47,8 +47,14 @@ enum PresolveRule {
   WEAKLY_DOMINATED_COLS,
   DOMINATED_COL_BOUNDS,
   EMPTY_COL,
-  // HTICK_PRE_DUPLICATE_ROWS,
-  // HTICK_PRE_DUPLICATE_COLUMNS,
+  // Integer-aware rules of the MIP presolve
+  MIP_BOUND_ROUNDING,
+  MIP_COEFFICIENT_TIGHTENING,
+  MIP_PROBING,
+  MIP_CLIQUE,
+  DUPLICATE_ROWS,
+  DUPLICATE_COLS,
+  IMPLIED_BOUNDS,
 
   // For timing.
   MATRIX_COPY,
@@ -98,6 +104,9 @@ struct PresolveRuleInfo {
   int count_applied = 0;
   int rows_removed = 0;
   int cols_removed = 0;
+  // Entries of the matrix visited, counting the nonzeros of each row
+  // or column scanned
+  double work = 0;
 
   int clock_id = 0;
   double total_time = 0;
@@ -150,6 +159,18 @@ class PresolveTimer {
     rules_[rule].count_applied++;
   }
 
+  void addWork(PresolveRule rule, const double work) {
+    assert(rule >= 0 && rule < PRESOLVE_RULES_COUNT);
+    rules_[rule].work += work;
+  }
+
+  int numChanges() const {
+    int num_changes = 0;
+    for (const PresolveRuleInfo& rule : rules_)
+      num_changes += rule.count_applied;
+    return num_changes;
+  }
+
   void increaseCount(bool row_count, PresolveRule rule) {
     assert(rule >= 0 && rule < PRESOLVE_RULES_COUNT);
     assert((int)rules_.size() == (int)PRESOLVE_RULES_COUNT);
@@ -288,6 +309,10 @@ class PresolveTimer {
 
   void updateInfo();
   double getTotalTime() { return total_time_; }
+  const PresolveRuleInfo& getRuleInfo(const PresolveRule rule) const {
+    assert(rule >= 0 && rule < PRESOLVE_RULES_COUNT);
+    return rules_[rule];
+  }
 
   HighsTimer& timer_;
 
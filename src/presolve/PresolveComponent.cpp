@@ -65,6 +65,11 @@ HighsPresolveStatus PresolveComponent::run() {
     if (options_.iteration_strategy == "num_limit")
       data_.presolve_[0].max_iterations = options_.max_iterations;
 
+    // work limit and throttling of presolvers
+    data_.presolve_[0].work_limit = options_.work_limit;
+    data_.presolve_[0].min_reductions_per_work =
+        options_.min_reductions_per_work;
+
     // time limit
     if (options_.time_limit < presolve::inf && options_.time_limit > 0)
       data_.presolve_[0].setTimeLimit(options_.time_limit);
@@ -109,6 +114,74 @@ HighsPresolveStatus PresolveComponent::run() {
   return presolve_status_;
 }
 
+void PresolveComponent::saveForReuse(const HighsLp& lp,
+                                     const double presolve_time) {
+  reuse_.clear();
+  if (presolve_status_ != HighsPresolveStatus::Reduced &&
+      presolve_status_ != HighsPresolveStatus::ReducedToEmpty)
+    return;
+  reuse_.valid = true;
+  reuse_.lp = lp;
+  reuse_.presolve.push_back(data_.presolve_[0]);
+  reuse_.reduced_lp = data_.reduced_lp_;
+  reuse_.presolve_status = presolve_status_;
+  reuse_.presolve_time = presolve_time;
+}
+
+bool PresolveComponent::reuse(const HighsLp& lp, std::string& decision) {
+  if (!reuse_.valid) {
+    decision = "no earlier presolve";
+    return false;
+  }
+  const HighsLp& saved = reuse_.lp;
+  if (lp.numCol_ != saved.numCol_ || lp.numRow_ != saved.numRow_ ||
+      lp.sense_ != saved.sense_ || lp.Astart_ != saved.Astart_ ||
+      lp.Aindex_ != saved.Aindex_ || lp.Avalue_ != saved.Avalue_ ||
+      lp.rowLower_ != saved.rowLower_ || lp.rowUpper_ != saved.rowUpper_ ||
+      lp.integrality_ != saved.integrality_) {
+    decision = "the matrix or row bounds have changed";
+    reuse_.clear();
+    return false;
+  }
+  const bool new_bounds =
+      lp.colLower_ != saved.colLower_ || lp.colUpper_ != saved.colUpper_;
+  const bool new_costs = lp.colCost_ != saved.colCost_;
+
+  // Postsolve consumes the state of presolve, so work on a copy
+  data_.clear();
+  data_.presolve_.push_back(reuse_.presolve[0]);
+  data_.reduced_lp_ = reuse_.reduced_lp;
+  // New bounds are only taken for columns that no reduction depends
+  // on. Otherwise the kept state is still valid for the LP presolved,
+  // which may be passed again
+  if (new_bounds &&
+      !data_.presolve_[0].replayColBounds(lp, data_.reduced_lp_)) {
+    decision = "a reduction depends on column bounds that have changed";
+    data_.clear();
+    return false;
+  }
+  if (new_costs) {
+    std::vector<double> cost = lp.colCost_;
+    if (lp.sense_ == ObjSense::MAXIMIZE)
+      for (double& value : cost) value = -value;
+    if (!data_.presolve_[0].replayCosts(cost,
+                                        data_.reduced_lp_.colCost_)) {
+      decision = "a reduction depends on the costs that have changed";
+      data_.clear();
+      return false;
+    }
+    decision = new_bounds ? "only the costs and untouched column bounds "
+                            "have changed"
+                          : "only the costs have changed";
+  } else {
+    decision = new_bounds ? "only untouched column bounds have changed"
+                          : "the LP is unchanged";
+  }
+  has_run_ = true;
+  presolve_status_ = reuse_.presolve_status;
+  return true;
+}
+
 void PresolveComponent::clear() {
   has_run_ = false;
   data_.clear();
@@ -46,6 +46,27 @@ struct PresolveComponentData : public HighsComponentData {
   }
 };
 
+// The LP given to the last presolve and the state of presolve before
+// the reduced LP was solved, kept so that the next run can reuse the
+// reductions
+struct PresolveComponentReuse {
+  bool valid = false;
+  HighsLp lp;
+  std::vector<presolve::Presolve> presolve;
+  HighsLp reduced_lp;
+  HighsPresolveStatus presolve_status = HighsPresolveStatus::NotPresolved;
+  double presolve_time = 0;
+
+  void clear() {
+    valid = false;
+    clearLp(lp);
+    presolve.clear();
+    clearLp(reduced_lp);
+    presolve_status = HighsPresolveStatus::NotPresolved;
+    presolve_time = 0;
+  }
+};
+
 // HighsComponentInfo is a placeholder for details we want to query from outside
 // of HiGHS like execution information. Times are recorded at the end of
 // Highs::run()
@@ -70,6 +91,8 @@ struct PresolveComponentOptions : public HighsComponentOptions {
 
   std::string iteration_strategy = "smart";
   int max_iterations = 0;
+  double work_limit = presolve::presolve_work_limit;
+  double min_reductions_per_work = presolve::presolve_min_reductions_per_work;
 
   double time_limit = -1;
   bool dev = false;
@@ -90,11 +113,23 @@ class PresolveComponent : public HighsComponent {
   void negateReducedLpColDuals(bool reduced);
   void negateReducedLpCost();
 
+  // Keep the state of presolve of the LP, so that the next run can
+  // reuse it
+  void saveForReuse(const HighsLp& lp, const double presolve_time);
+  // Restore the state of the last presolve if the LP differs from the
+  // one presolved then in at most its costs, which are replayed
+  // through the reductions, and the bounds of columns that no
+  // reduction depends on. Returns whether the reductions are reused,
+  // and why
+  bool reuse(const HighsLp& lp, std::string& decision);
+
   bool has_run_ = false;
 
   PresolveComponentInfo info_;
   PresolveComponentData data_;
   PresolveComponentOptions options_;
+  // Not cleared with the rest, since the LP may be passed again
+  PresolveComponentReuse reuse_;
 
   HighsPresolveStatus presolve_status_ = HighsPresolveStatus::NotPresolved;
   HighsPostsolveStatus postsolve_status_ = HighsPostsolveStatus::NotPresolved;
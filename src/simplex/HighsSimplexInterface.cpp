@@ -91,7 +91,7 @@ HighsStatus HighsSimplexInterface::addCols(
   // Now consider scaling
   scale.col_.resize(newNumCol);
   for (int col = 0; col < XnumNewCol; col++)
-    scale.col_[simplex_lp.numCol_ + col] = 1.0;
+    scale.col_[lp.numCol_ + col] = 1.0;
 
   if (apply_row_scaling) {
     // Determine scaling multipliers for this set of columns
@@ -342,6 +342,13 @@ HighsStatus HighsSimplexInterface::addRows(int XnumNewRow,
     if (return_status == HighsStatus::Error) return return_status;
   }
   if (lc_XnumNewNZ) {
+    // The simplex LP matrix has scaled columns so, with unit scaling
+    // for the new rows, their entries must be scaled by the column
+    // scale factors
+    if (valid_simplex_lp && scale.is_scaled_) {
+      for (int el = 0; el < lc_XnumNewNZ; el++)
+        lc_XARvalue[el] *= scale.col_[lc_XARindex[el]];
+    }
     appendRowsToLpMatrix(simplex_lp, XnumNewRow, lc_XnumNewNZ, lc_XARstart,
                          lc_XARindex, lc_XARvalue);
   }
@@ -370,7 +377,11 @@ HighsStatus HighsSimplexInterface::addRows(int XnumNewRow,
 
   // Increase the number of rows in the LPs
   lp.numRow_ += XnumNewRow;
-  if (valid_simplex_lp) simplex_lp.numRow_ += XnumNewRow;
+  if (valid_simplex_lp) {
+    simplex_lp.numRow_ += XnumNewRow;
+    // The random vectors are indexed over all variables
+    initialiseSimplexLpRandomVectors(highs_model_object);
+  }
 
 #ifdef HiGHSDEV
   if (valid_basis) {
@@ -449,9 +460,9 @@ HighsStatus HighsSimplexInterface::deleteRowsGeneral(
     //    scale.row_[row] = scale.row_[row + numDeleteRow];
     assert(simplex_lp.numRow_ <= original_num_row);
     if (simplex_lp.numRow_ < original_num_row) {
-      // Nontrivial deletion so invalidate all data relating to the simplex
-      // basis
-      invalidateSimplexLpBasis(simplex_lp_status);
+      // Nontrivial deletion so invalidate the simplex LP, since the
+      // row scale factors and random vectors are not updated
+      invalidateSimplexLp(simplex_lp_status);
     }
   }
   if (mask) {